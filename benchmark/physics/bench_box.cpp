@@ -0,0 +1,96 @@
+/*****************************************************************************
+<GPL_HEADER>
+
+    mstd library
+    Copyright (C) 2025-now  Jakob Gamper
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+<GPL_HEADER>
+******************************************************************************/
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <cmath>
+#include <cstddef>
+#include <random>
+#include <vector>
+
+#include "mstd/physics/box.hpp"
+#include "mstd/physics/potentials/static_lie_potential.hpp"
+
+TEST_CASE("minimum image cost vs potential evaluation", "[!benchmark]")
+{
+    // one pair batch worth of displacements, kept in L1
+    constexpr size_t nPairs = 1024;
+    constexpr double length = 20.0;
+    constexpr double cutoff = 2.5;
+
+    std::mt19937_64                        engine(42);
+    std::uniform_real_distribution<double> coord(-length, length);
+    std::uniform_real_distribution<double> distance(0.9, cutoff);
+
+    std::vector<double> dx(nPairs);
+    std::vector<double> dy(nPairs);
+    std::vector<double> dz(nPairs);
+    std::vector<double> r2(nPairs);
+    std::vector<double> energy(nPairs);
+    std::vector<double> fOverR(nPairs);
+
+    for (size_t i = 0; i < nPairs; ++i)
+    {
+        dx[i] = coord(engine);
+        dy[i] = coord(engine);
+        dz[i] = coord(engine);
+
+        const auto r = distance(engine);
+        r2[i]        = r * r;
+    }
+
+    const mstd::OrthorhombicBox<double> ortho(length, length, length);
+    const mstd::TriclinicBox<double>    tri(length, length, length, 4, -3, 5);
+
+    const mstd::StaticLJShiftedPotential<double> potential(1.0, 1.0, cutoff);
+
+    BENCHMARK("minimum image, scalar std::nearbyint")
+    {
+        double sum = 0.0;
+        for (size_t i = 0; i < nPairs; ++i)
+        {
+            const auto mx = dx[i] - length * std::nearbyint(dx[i] / length);
+            const auto my = dy[i] - length * std::nearbyint(dy[i] / length);
+            const auto mz = dz[i] - length * std::nearbyint(dz[i] / length);
+            sum          += mx * mx + my * my + mz * mz;
+        }
+        return sum;
+    };
+
+    BENCHMARK("minimum image, orthorhombic batch")
+    {
+        ortho.minimumImageBatch(dx, dy, dz);
+        return dx[0];
+    };
+
+    BENCHMARK("minimum image, triclinic batch")
+    {
+        tri.minimumImageBatch(dx, dy, dz);
+        return dx[0];
+    };
+
+    BENCHMARK("LJ evalBatchFromR2")
+    {
+        potential.evalBatchFromR2(r2, energy, fOverR);
+        return energy[0];
+    };
+}
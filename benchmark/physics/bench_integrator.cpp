@@ -0,0 +1,109 @@
+/*****************************************************************************
+<GPL_HEADER>
+
+    mstd library
+    Copyright (C) 2025-now  Jakob Gamper
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+<GPL_HEADER>
+******************************************************************************/
+
+#include <array>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <cstddef>
+#include <span>
+
+#include "bench_utils.hpp"
+#include "mstd/physics/integrator.hpp"
+#include "mstd/physics/pair_forces.hpp"
+#include "mstd/physics/particles.hpp"
+#include "mstd/physics/potentials/static_lie_potential.hpp"
+#include "mstd/physics/verlet_list.hpp"
+
+namespace
+{
+    /// keeps the forces untouched, so a step measures integration only
+    struct FrozenForces
+    {
+        double operator()(
+            std::span<const double>,
+            std::span<const double>,
+            std::span<const double>,
+            std::span<double>,
+            std::span<double>,
+            std::span<double>
+        ) const
+        {
+            return 0.0;
+        }
+    };
+
+}   // namespace
+
+TEST_CASE("integration vs force evaluation per step", "[!benchmark]")
+{
+    constexpr size_t nParticles = 1000000;
+    constexpr double density    = 0.8;
+    constexpr double cutoff     = 2.5;
+    constexpr double dt         = 1e-9;
+
+    const auto boxLength = bench::boxLengthForDensity(nParticles, density);
+    const auto positions = bench::randomPositions(nParticles, boxLength);
+
+    const std::array<double, 3> box{boxLength, boxLength, boxLength};
+
+    mstd::ParticleArrays<double> particles(nParticles);
+    particles.x.assign(positions.x.begin(), positions.x.end());
+    particles.y.assign(positions.y.begin(), positions.y.end());
+    particles.z.assign(positions.z.begin(), positions.z.end());
+
+    const mstd::StaticLJShiftedPotential<double> potential(1.0, 1.0, cutoff);
+
+    mstd::VerletList<double> verletList(box, cutoff, 0.3);
+    verletList.update(positions.x, positions.y, positions.z);
+
+    const mstd::VelocityVerlet<double> verlet(dt);
+    const mstd::Leapfrog<double>       leapfrog(dt);
+
+    BENCHMARK("force evaluation, Verlet list, SIMD")
+    {
+        return mstd::computePairForces(
+            verletList,
+            potential,
+            positions.x,
+            positions.y,
+            positions.z,
+            particles.fx,
+            particles.fy,
+            particles.fz
+        );
+    };
+
+    BENCHMARK("velocity Verlet integration only")
+    {
+        return verlet.step(particles, FrozenForces{});
+    };
+
+    BENCHMARK("leapfrog integration only")
+    {
+        return leapfrog.step(particles, FrozenForces{});
+    };
+
+    BENCHMARK("kinetic energy")
+    {
+        return particles.kineticEnergy();
+    };
+}
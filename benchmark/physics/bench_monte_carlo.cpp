@@ -0,0 +1,199 @@
+/*****************************************************************************
+<GPL_HEADER>
+
+    mstd library
+    Copyright (C) 2025-now  Jakob Gamper
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+<GPL_HEADER>
+******************************************************************************/
+
+#include <array>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <cmath>
+#include <cstddef>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "bench_utils.hpp"
+#include "mstd/physics/monte_carlo.hpp"
+#include "mstd/physics/potentials/lie_potential.hpp"
+#include "mstd/physics/potentials/static_lie_potential.hpp"
+
+namespace
+{
+    constexpr double density = 0.8;
+    constexpr double cutoff  = 2.5;
+    constexpr size_t nMoves  = 1000;
+
+    /// pre-drawn trial moves, so the loops time the energies only
+    struct Moves
+    {
+        std::vector<size_t>                particle;
+        std::vector<std::array<double, 3>> displacement;
+        std::vector<double>                uniform;
+    };
+
+    Moves randomMoves(const size_t nParticles)
+    {
+        std::mt19937_64                        engine(7);
+        std::uniform_int_distribution<size_t>  pick(0, nParticles - 1);
+        std::uniform_real_distribution<double> unit(0.0, 1.0);
+
+        Moves moves;
+        for (size_t move = 0; move < nMoves; ++move)
+        {
+            moves.particle.push_back(pick(engine));
+            moves.displacement.push_back(
+                {0.2 * (unit(engine) - 0.5),
+                 0.2 * (unit(engine) - 0.5),
+                 0.2 * (unit(engine) - 0.5)}
+            );
+            moves.uniform.push_back(unit(engine));
+        }
+
+        return moves;
+    }
+
+    /// energy of one particle against all others via evalEnergy
+    double allPartnersEnergy(
+        const mstd::LJShiftedPotential<double>& potential,
+        const bench::Positions&                 p,
+        const double                            boxLength,
+        const size_t                            i,
+        const std::array<double, 3>&            r
+    )
+    {
+        double energy = 0.0;
+
+        for (size_t j = 0; j < p.x.size(); ++j)
+        {
+            auto dx = r[0] - p.x[j];
+            auto dy = r[1] - p.y[j];
+            auto dz = r[2] - p.z[j];
+            dx     -= boxLength * std::nearbyint(dx / boxLength);
+            dy     -= boxLength * std::nearbyint(dy / boxLength);
+            dz     -= boxLength * std::nearbyint(dz / boxLength);
+
+            const auto dist = std::sqrt(dx * dx + dy * dy + dz * dz);
+            if (j != i && dist < cutoff)
+                energy += potential.evalEnergy(dist);
+        }
+
+        return energy;
+    }
+
+}   // namespace
+
+TEST_CASE("Monte Carlo trial moves vs particle count", "[!benchmark]")
+{
+    const mstd::StaticLJShiftedPotential<double> potential(1.0, 1.0, cutoff);
+    const mstd::LJShiftedPotential<double> virtualPotential(1.0, 1.0, cutoff);
+
+    for (const size_t nParticles : std::vector<size_t>{1000, 10000, 100000})
+    {
+        const auto boxLength = bench::boxLengthForDensity(nParticles, density);
+        auto       positions = bench::randomPositions(nParticles, boxLength);
+        const auto moves     = randomMoves(nParticles);
+
+        const std::array<double, 3> box{boxLength, boxLength, boxLength};
+
+        mstd::MonteCarloCellList<double> cells(box, cutoff);
+        cells.build(positions.x, positions.y, positions.z);
+
+        const auto suffix = ", N = " + std::to_string(nParticles);
+
+        BENCHMARK(std::to_string(nMoves) + " moves, cell list" + suffix)
+        {
+            double energy = 0.0;
+
+            for (size_t move = 0; move < nMoves; ++move)
+            {
+                const auto i = moves.particle[move];
+                const auto r = cells.position(i);
+                const auto d = moves.displacement[move];
+
+                const auto delta = cells.trialMove(
+                    potential,
+                    i,
+                    r[0] + d[0],
+                    r[1] + d[1],
+                    r[2] + d[2]
+                );
+
+                if (mstd::metropolisAccept(delta, 1.0, moves.uniform[move]))
+                {
+                    cells.accept();
+                    energy += delta;
+                }
+                else
+                    cells.reject();
+            }
+
+            return energy;
+        };
+
+        if (nParticles > 10000)
+            continue;
+
+        const auto energyOf =
+            [&](const size_t i, const std::array<double, 3>& r)
+        {
+            return allPartnersEnergy(
+                virtualPotential,
+                positions,
+                boxLength,
+                i,
+                r
+            );
+        };
+
+        BENCHMARK(std::to_string(nMoves) + " moves, all partners" + suffix)
+        {
+            double energy = 0.0;
+
+            for (size_t move = 0; move < nMoves; ++move)
+            {
+                const auto i = moves.particle[move];
+                const auto d = moves.displacement[move];
+
+                const std::array<double, 3> r{
+                    positions.x[i],
+                    positions.y[i],
+                    positions.z[i]
+                };
+                const std::array<double, 3> trial{
+                    r[0] + d[0],
+                    r[1] + d[1],
+                    r[2] + d[2]
+                };
+
+                const auto delta = energyOf(i, trial) - energyOf(i, r);
+
+                if (mstd::metropolisAccept(delta, 1.0, moves.uniform[move]))
+                {
+                    positions.x[i] = trial[0];
+                    positions.y[i] = trial[1];
+                    positions.z[i] = trial[2];
+                    energy        += delta;
+                }
+            }
+
+            return energy;
+        };
+    }
+}
@@ -0,0 +1,525 @@
+/*****************************************************************************
+<GPL_HEADER>
+
+    mstd library
+    Copyright (C) 2025-now  Jakob Gamper
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+<GPL_HEADER>
+******************************************************************************/
+
+#include <algorithm>
+#include <array>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <cmath>
+#include <numbers>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "bench_utils.hpp"
+#include "mstd/physics/cell_list.hpp"
+#include "mstd/physics/pair_forces.hpp"
+#include "mstd/physics/parallel_pair_forces.hpp"
+#include "mstd/physics/potentials/charged_pair_potential.hpp"
+#include "mstd/physics/potentials/coulomb_potential.hpp"
+#include "mstd/physics/potentials/exponential_potential.hpp"
+#include "mstd/physics/potentials/mixed_precision.hpp"
+#include "mstd/physics/potentials/species_pair_table.hpp"
+#include "mstd/physics/potentials/static_lie_potential.hpp"
+#include "mstd/physics/potentials/sum_potential.hpp"
+#include "mstd/physics/verlet_list.hpp"
+#include "mstd/physics/virial.hpp"
+
+TEST_CASE("scalar vs SIMD pair force kernel", "[!benchmark]")
+{
+    using mstd::PairKernelPath;
+
+    constexpr size_t nParticles = 20000;
+    constexpr double density    = 0.8;
+    constexpr double cutoff     = 2.5;
+
+    const auto boxLength = bench::boxLengthForDensity(nParticles, density);
+    const auto positions = bench::randomPositions(nParticles, boxLength);
+
+    const std::array<double, 3> box{boxLength, boxLength, boxLength};
+
+    std::vector<double> fx(nParticles);
+    std::vector<double> fy(nParticles);
+    std::vector<double> fz(nParticles);
+
+    const mstd::StaticLJShiftedPotential<double> potential(1.0, 1.0, cutoff);
+
+    mstd::CellList<double> cellList(box, cutoff);
+    cellList.build(positions.x, positions.y, positions.z);
+
+    mstd::VerletList<double> verletList(box, cutoff, 0.3);
+    verletList.update(positions.x, positions.y, positions.z);
+
+    const auto run = [&]<PairKernelPath Path>(const auto& source)
+    {
+        return mstd::computePairForces<Path>(
+            source,
+            potential,
+            positions.x,
+            positions.y,
+            positions.z,
+            fx,
+            fy,
+            fz
+        );
+    };
+
+    BENCHMARK("cell list, scalar")
+    {
+        return run.template operator()<PairKernelPath::Scalar>(cellList);
+    };
+
+    BENCHMARK("cell list, SIMD")
+    {
+        return run.template operator()<PairKernelPath::Simd>(cellList);
+    };
+
+    BENCHMARK("Verlet list, scalar")
+    {
+        return run.template operator()<PairKernelPath::Scalar>(verletList);
+    };
+
+    BENCHMARK("Verlet list, SIMD")
+    {
+        return run.template operator()<PairKernelPath::Simd>(verletList);
+    };
+}
+
+TEST_CASE("thread scaling of the parallel pair force kernel", "[!benchmark]")
+{
+    constexpr size_t nParticles = 1000000;
+    constexpr double density    = 0.8;
+    constexpr double cutoff     = 2.5;
+
+    const auto boxLength = bench::boxLengthForDensity(nParticles, density);
+    const auto positions = bench::randomPositions(nParticles, boxLength);
+
+    const std::array<double, 3> box{boxLength, boxLength, boxLength};
+
+    std::vector<double> fx(nParticles);
+    std::vector<double> fy(nParticles);
+    std::vector<double> fz(nParticles);
+
+    const mstd::StaticLJShiftedPotential<double> potential(1.0, 1.0, cutoff);
+
+    mstd::VerletList<double> verletList(box, cutoff, 0.3);
+    verletList.update(positions.x, positions.y, positions.z);
+
+    const auto maxThreads = std::max(1U, std::thread::hardware_concurrency());
+
+    for (size_t nThreads = 1; nThreads <= maxThreads; nThreads *= 2)
+    {
+        mstd::ParallelPairForces<double> kernel(nThreads);
+
+        BENCHMARK(std::to_string(nThreads) + " threads")
+        {
+            return kernel.compute(
+                verletList,
+                potential,
+                positions.x,
+                positions.y,
+                positions.z,
+                fx,
+                fy,
+                fz
+            );
+        };
+    }
+}
+
+TEST_CASE("double vs mixed precision pair force kernel", "[!benchmark]")
+{
+    constexpr size_t nParticles = 20000;
+    constexpr double density    = 0.8;
+    constexpr double cutoff     = 2.5;
+
+    const auto boxLength = bench::boxLengthForDensity(nParticles, density);
+    const auto positions = bench::randomPositions(nParticles, boxLength);
+
+    const std::array<double, 3> box{boxLength, boxLength, boxLength};
+
+    std::vector<double> fx(nParticles);
+    std::vector<double> fy(nParticles);
+    std::vector<double> fz(nParticles);
+
+    const mstd::StaticLJShiftedPotential<double> potential(1.0, 1.0, cutoff);
+    const mstd::StaticLJShiftedPotential<float>  floatPotential(
+        1.0F,
+        1.0F,
+        static_cast<float>(cutoff)
+    );
+
+    mstd::VerletList<double> verletList(box, cutoff, 0.3);
+    verletList.update(positions.x, positions.y, positions.z);
+
+    const auto run = [&](const auto& pairPotential)
+    {
+        return mstd::computePairForces(
+            verletList,
+            pairPotential,
+            positions.x,
+            positions.y,
+            positions.z,
+            fx,
+            fy,
+            fz
+        );
+    };
+
+    BENCHMARK("Verlet list, double") { return run(potential); };
+
+    BENCHMARK("Verlet list, float evaluation, double accumulation")
+    {
+        return run(floatPotential);
+    };
+
+    // the potential evaluation alone, one pair batch worth of distances
+    constexpr size_t    nPairs = 1024;
+    std::vector<double> r2(nPairs);
+    std::vector<double> energy(nPairs);
+    std::vector<double> forceOverR(nPairs);
+    for (size_t i = 0; i < nPairs; ++i)
+        r2[i] = 0.8 + 5.4 * static_cast<double>(i) / nPairs;
+
+    BENCHMARK("evalBatchFromR2, double")
+    {
+        potential.evalBatchFromR2(r2, energy, forceOverR);
+        return energy[0];
+    };
+
+    BENCHMARK("evalBatchFromR2Mixed, float evaluation")
+    {
+        mstd::evalBatchFromR2Mixed(floatPotential, r2, energy, forceOverR);
+        return energy[0];
+    };
+}
+
+TEST_CASE("single potential vs 20 species parameter table", "[!benchmark]")
+{
+    constexpr size_t nParticles = 20000;
+    constexpr size_t nSpecies   = 20;
+    constexpr double density    = 0.8;
+    constexpr double cutoff     = 2.5;
+
+    const auto boxLength = bench::boxLengthForDensity(nParticles, density);
+    const auto positions = bench::randomPositions(nParticles, boxLength);
+
+    const std::array<double, 3> box{boxLength, boxLength, boxLength};
+
+    std::vector<double> fx(nParticles);
+    std::vector<double> fy(nParticles);
+    std::vector<double> fz(nParticles);
+
+    std::vector<double> sigma(nSpecies);
+    std::vector<double> epsilon(nSpecies);
+    for (size_t s = 0; s < nSpecies; ++s)
+    {
+        sigma[s]   = 0.9 + 0.01 * static_cast<double>(s);
+        epsilon[s] = 0.5 + 0.05 * static_cast<double>(s);
+    }
+
+    std::vector<size_t> species(nParticles);
+    for (size_t i = 0; i < nParticles; ++i)
+        species[i] = i % nSpecies;
+
+    const mstd::StaticLJShiftedPotential<double> potential(1.0, 1.0, cutoff);
+    const mstd::LJSpeciesPairTable<double>       table(sigma, epsilon, cutoff);
+    const mstd::SpeciesPairPotential             mixture(table, species);
+
+    mstd::VerletList<double> verletList(box, cutoff, 0.3);
+    verletList.update(positions.x, positions.y, positions.z);
+
+    const auto run = [&](const auto& pairPotential)
+    {
+        return mstd::computePairForces(
+            verletList,
+            pairPotential,
+            positions.x,
+            positions.y,
+            positions.z,
+            fx,
+            fy,
+            fz
+        );
+    };
+
+    BENCHMARK("Verlet list, single potential") { return run(potential); };
+
+    BENCHMARK("Verlet list, 20 species table") { return run(mixture); };
+}
+
+TEST_CASE("fused vs separate Coulomb and LJ pair forces", "[!benchmark]")
+{
+    constexpr size_t nParticles = 20000;
+    constexpr double density    = 0.8;
+    constexpr double cutoff     = 2.5;
+
+    const auto boxLength = bench::boxLengthForDensity(nParticles, density);
+    const auto positions = bench::randomPositions(nParticles, boxLength);
+
+    const std::array<double, 3> box{boxLength, boxLength, boxLength};
+
+    std::vector<double> fx(nParticles);
+    std::vector<double> fy(nParticles);
+    std::vector<double> fz(nParticles);
+
+    std::vector<double> charges(nParticles);
+    for (size_t i = 0; i < nParticles; ++i)
+        charges[i] = i % 2 == 0 ? 0.5 : -0.5;
+
+    const mstd::StaticLJShiftedPotential<double> lj(1.0, 1.0, cutoff);
+    const mstd::CoulombDSFPotential<double>      dsf(1.0, 0.3, cutoff);
+
+    const mstd::ChargedPairPotential coulomb(dsf, charges);
+    const mstd::ChargedPairPotential fused(dsf, charges, lj);
+
+    mstd::VerletList<double> verletList(box, cutoff, 0.3);
+    verletList.update(positions.x, positions.y, positions.z);
+
+    const auto run = [&](const auto& pairPotential)
+    {
+        return mstd::computePairForces(
+            verletList,
+            pairPotential,
+            positions.x,
+            positions.y,
+            positions.z,
+            fx,
+            fy,
+            fz
+        );
+    };
+
+    BENCHMARK("Verlet list, LJ only") { return run(lj); };
+
+    BENCHMARK("Verlet list, DSF Coulomb and LJ in two passes")
+    {
+        return run(coulomb) + run(lj);
+    };
+
+    BENCHMARK("Verlet list, DSF Coulomb and LJ fused") { return run(fused); };
+
+    // erfc dominated evaluation alone, vectorized vs std::erfc
+    constexpr size_t    nPairs = 1024;
+    std::vector<double> r2(nPairs);
+    std::vector<double> energy(nPairs);
+    std::vector<double> forceOverR(nPairs);
+    for (size_t i = 0; i < nPairs; ++i)
+        r2[i] = 0.8 + 5.4 * static_cast<double>(i) / nPairs;
+
+    BENCHMARK("DSF evalBatchFromR2, vectorized erfc")
+    {
+        dsf.evalBatchFromR2(r2, energy, forceOverR);
+        return energy[0];
+    };
+
+    BENCHMARK("DSF closed form, std::erfc")
+    {
+        for (size_t i = 0; i < nPairs; ++i)
+        {
+            const auto r = std::sqrt(r2[i]);
+            energy[i]    = std::erfc(0.3 * r) / r;
+            forceOverR[i] =
+                -(energy[i] + 0.3 * 2 * std::numbers::inv_sqrtpi *
+                                  std::exp(-0.09 * r2[i])) /
+                r2[i];
+        }
+        return energy[0];
+    };
+}
+
+TEST_CASE("LJ vs exponential pair potentials", "[!benchmark]")
+{
+    constexpr size_t nParticles = 20000;
+    constexpr double density    = 0.8;
+    constexpr double cutoff     = 2.5;
+
+    const auto boxLength = bench::boxLengthForDensity(nParticles, density);
+    const auto positions = bench::randomPositions(nParticles, boxLength);
+
+    const std::array<double, 3> box{boxLength, boxLength, boxLength};
+
+    std::vector<double> fx(nParticles);
+    std::vector<double> fy(nParticles);
+    std::vector<double> fz(nParticles);
+
+    const mstd::StaticLJShiftedPotential<double> lj(1.0, 1.0, cutoff);
+    const mstd::MorseShiftedPotential<double>    morse(1.0, 3.0, 1.1, cutoff);
+    const mstd::BuckinghamShiftedPotential<double> buckingham(
+        1000.0,
+        0.2,
+        1.0,
+        cutoff
+    );
+
+    mstd::VerletList<double> verletList(box, cutoff, 0.3);
+    verletList.update(positions.x, positions.y, positions.z);
+
+    const auto run = [&](const auto& pairPotential)
+    {
+        return mstd::computePairForces(
+            verletList,
+            pairPotential,
+            positions.x,
+            positions.y,
+            positions.z,
+            fx,
+            fy,
+            fz
+        );
+    };
+
+    BENCHMARK("Verlet list, shifted LJ") { return run(lj); };
+    BENCHMARK("Verlet list, shifted Morse") { return run(morse); };
+    BENCHMARK("Verlet list, shifted Buckingham") { return run(buckingham); };
+}
+
+TEST_CASE("separate vs summed pair potentials", "[!benchmark]")
+{
+    constexpr size_t nParticles = 20000;
+    constexpr double density    = 0.8;
+    constexpr double cutoff     = 2.5;
+
+    const auto boxLength = bench::boxLengthForDensity(nParticles, density);
+    const auto positions = bench::randomPositions(nParticles, boxLength);
+
+    const std::array<double, 3> box{boxLength, boxLength, boxLength};
+
+    std::vector<double> fx(nParticles);
+    std::vector<double> fy(nParticles);
+    std::vector<double> fz(nParticles);
+
+    const mstd::StaticLJShiftedPotential<double>      lj(1.0, 1.0, cutoff);
+    const mstd::CoulombReactionFieldPotential<double> rf(0.5, cutoff, 78.0);
+    const mstd::BornMayerShiftedPotential<double> correction(10.0, 0.2, cutoff);
+
+    const mstd::SumPotential sum(lj, rf, correction);
+
+    mstd::VerletList<double> verletList(box, cutoff, 0.3);
+    verletList.update(positions.x, positions.y, positions.z);
+
+    const auto run = [&](const auto& pairPotential)
+    {
+        return mstd::computePairForces(
+            verletList,
+            pairPotential,
+            positions.x,
+            positions.y,
+            positions.z,
+            fx,
+            fy,
+            fz
+        );
+    };
+
+    BENCHMARK("Verlet list, LJ only") { return run(lj); };
+
+    BENCHMARK("Verlet list, LJ, RF Coulomb and Born-Mayer in three passes")
+    {
+        return run(lj) + run(rf) + run(correction);
+    };
+
+    BENCHMARK("Verlet list, LJ, RF Coulomb and Born-Mayer summed")
+    {
+        return run(sum);
+    };
+}
+
+TEST_CASE("pair forces with and without virial", "[!benchmark]")
+{
+    constexpr size_t nParticles = 20000;
+    constexpr double density    = 0.8;
+    constexpr double cutoff     = 2.5;
+
+    const auto boxLength = bench::boxLengthForDensity(nParticles, density);
+    const auto positions = bench::randomPositions(nParticles, boxLength);
+
+    const std::array<double, 3> box{boxLength, boxLength, boxLength};
+
+    std::vector<double> fx(nParticles);
+    std::vector<double> fy(nParticles);
+    std::vector<double> fz(nParticles);
+
+    const mstd::StaticLJShiftedPotential<double> potential(1.0, 1.0, cutoff);
+
+    mstd::VerletList<double> verletList(box, cutoff, 0.3);
+    verletList.update(positions.x, positions.y, positions.z);
+
+    mstd::VirialTensor<double> virial;
+
+    BENCHMARK("Verlet list, forces only")
+    {
+        return mstd::computePairForces(
+            verletList,
+            potential,
+            positions.x,
+            positions.y,
+            positions.z,
+            fx,
+            fy,
+            fz
+        );
+    };
+
+    BENCHMARK("Verlet list, forces and virial in one pass")
+    {
+        const auto energy = mstd::computePairForces(
+            verletList,
+            potential,
+            positions.x,
+            positions.y,
+            positions.z,
+            fx,
+            fy,
+            fz,
+            virial
+        );
+        return energy + virial.trace();
+    };
+
+    BENCHMARK("Verlet list, forces and a second virial pass")
+    {
+        const auto energy = mstd::computePairForces(
+            verletList,
+            potential,
+            positions.x,
+            positions.y,
+            positions.z,
+            fx,
+            fy,
+            fz
+        );
+
+        mstd::VirialTensor<double> secondPass;
+        verletList.forEachPair(
+            positions.x,
+            positions.y,
+            positions.z,
+            [&](size_t, size_t, double dx, double dy, double dz, double r2)
+            {
+                const auto forceOverR = potential.evalFromR2(r2).second;
+                secondPass.addPair(forceOverR, dx, dy, dz);
+            }
+        );
+        return energy + secondPass.trace();
+    };
+}
@@ -0,0 +1,216 @@
+/*****************************************************************************
+<GPL_HEADER>
+
+    mstd library
+    Copyright (C) 2025-now  Jakob Gamper
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+<GPL_HEADER>
+******************************************************************************/
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <cmath>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "bench_utils.hpp"
+#include "mstd/physics/potentials/any_potential.hpp"
+#include "mstd/physics/potentials/lie_potential.hpp"
+#include "mstd/physics/potentials/static_lie_potential.hpp"
+#include "mstd/physics/potentials/tabulated_potential.hpp"
+
+namespace
+{
+    /**
+     * @brief force loop over a fixed pair list as found in MD codes
+     *
+     * @details The potential is only touched through its scalar eval(r), so
+     * the dispatch mechanism of @p P is the only thing that differs between
+     * the benchmarks below.
+     */
+    template <typename P>
+    double pairLoop(
+        const P&                                      potential,
+        const bench::Positions&                       positions,
+        const std::vector<std::pair<size_t, size_t>>& pairs,
+        const double                                  boxLength,
+        std::vector<double>&                          fx,
+        std::vector<double>&                          fy,
+        std::vector<double>&                          fz
+    )
+    {
+        double energy = 0.0;
+
+        for (const auto& [i, j] : pairs)
+        {
+            auto dx = positions.x[i] - positions.x[j];
+            auto dy = positions.y[i] - positions.y[j];
+            auto dz = positions.z[i] - positions.z[j];
+            dx     -= boxLength * std::nearbyint(dx / boxLength);
+            dy     -= boxLength * std::nearbyint(dy / boxLength);
+            dz     -= boxLength * std::nearbyint(dz / boxLength);
+
+            const auto r          = std::sqrt(dx * dx + dy * dy + dz * dz);
+            const auto [e, force] = potential.eval(r);
+            const auto scale      = force / r;
+
+            energy += e;
+            fx[i]  -= scale * dx;
+            fy[i]  -= scale * dy;
+            fz[i]  -= scale * dz;
+            fx[j]  += scale * dx;
+            fy[j]  += scale * dy;
+            fz[j]  += scale * dz;
+        }
+
+        return energy;
+    }
+
+}   // namespace
+
+TEST_CASE("virtual vs static dispatch in a LJ pair loop", "[!benchmark]")
+{
+    constexpr size_t nParticles = 4000;
+    constexpr double density    = 0.8;
+    constexpr double cutoff     = 2.5;
+
+    const auto boxLength = bench::boxLengthForDensity(nParticles, density);
+    const auto positions = bench::randomPositions(nParticles, boxLength);
+    const auto pairs     = bench::bruteForcePairs(positions, boxLength, cutoff);
+
+    std::vector<double> fx(nParticles);
+    std::vector<double> fy(nParticles);
+    std::vector<double> fz(nParticles);
+
+    // owned through the base class like a runtime-selected potential
+    const std::unique_ptr<mstd::LJPotential<double>> virtualPotential =
+        std::make_unique<mstd::LJShiftedPotential<double>>(1.0, 1.0, cutoff);
+
+    const mstd::StaticLJShiftedPotential<double> staticPotential(
+        1.0,
+        1.0,
+        cutoff
+    );
+
+    const mstd::AnyPotential<double> anyPotential = staticPotential;
+
+    BENCHMARK("virtual LJShiftedPotential")
+    {
+        return pairLoop(
+            *virtualPotential,
+            positions,
+            pairs,
+            boxLength,
+            fx,
+            fy,
+            fz
+        );
+    };
+
+    BENCHMARK("static StaticLJShiftedPotential")
+    {
+        return pairLoop(
+            staticPotential,
+            positions,
+            pairs,
+            boxLength,
+            fx,
+            fy,
+            fz
+        );
+    };
+
+    BENCHMARK("type-erased AnyPotential")
+    {
+        return pairLoop(
+            anyPotential,
+            positions,
+            pairs,
+            boxLength,
+            fx,
+            fy,
+            fz
+        );
+    };
+}
+
+TEST_CASE("runtime vs compile-time potential tables", "[!benchmark]")
+{
+    constexpr size_t nParticles = 4000;
+    constexpr double density    = 0.8;
+    constexpr double cutoff     = 2.5;
+    constexpr double rMin       = 0.8;
+    constexpr size_t nSegments  = 1024;
+
+    static constexpr auto compileTimeTable =
+        mstd::tabulateLiePotential<6, 12, nSegments>(1.0, 1.0, rMin, cutoff);
+
+    const auto boxLength = bench::boxLengthForDensity(nParticles, density);
+    const auto positions = bench::randomPositions(nParticles, boxLength);
+    const auto pairs     = bench::bruteForcePairs(positions, boxLength, cutoff);
+
+    std::vector<double> fx(nParticles);
+    std::vector<double> fy(nParticles);
+    std::vector<double> fz(nParticles);
+
+    const mstd::StaticLJShiftedPotential<double> potential(1.0, 1.0, cutoff);
+
+    const mstd::TabulatedPotential<> runtimeTable(
+        potential,
+        rMin,
+        cutoff,
+        nSegments
+    );
+
+    BENCHMARK("build the table at startup")
+    {
+        const mstd::TabulatedPotential<> table(
+            potential,
+            rMin,
+            cutoff,
+            nSegments
+        );
+
+        return table.maxError();
+    };
+
+    BENCHMARK("pair loop, runtime table")
+    {
+        return pairLoop(
+            runtimeTable,
+            positions,
+            pairs,
+            boxLength,
+            fx,
+            fy,
+            fz
+        );
+    };
+
+    BENCHMARK("pair loop, compile-time table")
+    {
+        return pairLoop(
+            compileTimeTable,
+            positions,
+            pairs,
+            boxLength,
+            fx,
+            fy,
+            fz
+        );
+    };
+}
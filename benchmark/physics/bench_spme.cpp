@@ -0,0 +1,172 @@
+/*****************************************************************************
+<GPL_HEADER>
+
+    mstd library
+    Copyright (C) 2025-now  Jakob Gamper
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+<GPL_HEADER>
+******************************************************************************/
+
+#include <algorithm>
+#include <array>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <cmath>
+#include <span>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "bench_utils.hpp"
+#include "mstd/physics/box.hpp"
+#include "mstd/physics/ewald.hpp"
+#include "mstd/physics/spme.hpp"
+
+namespace
+{
+    /// alternating unit charges, a neutral system for even sizes
+    std::vector<double> alternatingCharges(const size_t nParticles)
+    {
+        std::vector<double> charges(nParticles);
+        for (size_t i = 0; i < nParticles; ++i)
+            charges[i] = i % 2 == 0 ? 1.0 : -1.0;
+        return charges;
+    }
+
+}   // namespace
+
+TEST_CASE("SPME vs direct Ewald reciprocal sum", "[!benchmark]")
+{
+    constexpr size_t nParticles = 2000;
+    constexpr double boxLength  = 20.0;
+    constexpr double cutoff     = 9.0;
+    constexpr int    kMax       = 8;
+
+    const auto positions = bench::randomPositions(nParticles, boxLength);
+    const auto charges   = alternatingCharges(nParticles);
+    const auto alpha     = mstd::ewaldSplittingParameter(cutoff, 1e-5);
+
+    const mstd::OrthorhombicBox<double> box(boxLength, boxLength, boxLength);
+
+    std::vector<double> refX(nParticles), refY(nParticles), refZ(nParticles);
+    std::vector<double> fx(nParticles), fy(nParticles), fz(nParticles);
+
+    const auto direct = [&]
+    {
+        std::ranges::fill(refX, 0.0);
+        std::ranges::fill(refY, 0.0);
+        std::ranges::fill(refZ, 0.0);
+
+        return mstd::computeEwaldReciprocal(
+            box,
+            1.0,
+            alpha,
+            kMax,
+            std::span<const double>(positions.x),
+            std::span<const double>(positions.y),
+            std::span<const double>(positions.z),
+            std::span<const double>(charges),
+            std::span<double>(refX),
+            std::span<double>(refY),
+            std::span<double>(refZ)
+        );
+    };
+
+    direct();
+
+    BENCHMARK("direct Ewald") { return direct(); };
+
+    for (const size_t order : {size_t{4}, size_t{6}})
+    {
+        mstd::SmoothParticleMeshEwald<>
+            spme(box, 1.0, alpha, {32, 32, 32}, order);
+
+        const auto run = [&]
+        {
+            std::ranges::fill(fx, 0.0);
+            std::ranges::fill(fy, 0.0);
+            std::ranges::fill(fz, 0.0);
+
+            return spme.compute(
+                positions.x,
+                positions.y,
+                positions.z,
+                charges,
+                fx,
+                fy,
+                fz
+            );
+        };
+
+        run();
+
+        // RMS force error relative to the RMS direct Ewald force
+        double error = 0.0, norm = 0.0;
+        for (size_t i = 0; i < nParticles; ++i)
+        {
+            const auto dx = fx[i] - refX[i];
+            const auto dy = fy[i] - refY[i];
+            const auto dz = fz[i] - refZ[i];
+
+            error += dx * dx + dy * dy + dz * dz;
+            norm  += refX[i] * refX[i] + refY[i] * refY[i] + refZ[i] * refZ[i];
+        }
+
+        WARN(
+            "order " << order << " relative RMS force error "
+                     << std::sqrt(error / norm)
+        );
+
+        BENCHMARK("SPME order " + std::to_string(order)) { return run(); };
+    }
+}
+
+TEST_CASE("thread scaling of SPME", "[!benchmark]")
+{
+    constexpr size_t nParticles = 100000;
+    constexpr double density    = 0.1;
+    constexpr double cutoff     = 9.0;
+
+    const auto boxLength = bench::boxLengthForDensity(nParticles, density);
+    const auto positions = bench::randomPositions(nParticles, boxLength);
+    const auto charges   = alternatingCharges(nParticles);
+    const auto alpha     = mstd::ewaldSplittingParameter(cutoff, 1e-5);
+
+    const mstd::OrthorhombicBox<double> box(boxLength, boxLength, boxLength);
+
+    std::vector<double> fx(nParticles), fy(nParticles), fz(nParticles);
+
+    const auto maxThreads = std::max(1U, std::thread::hardware_concurrency());
+
+    for (size_t nThreads = 1; nThreads <= maxThreads; nThreads *= 2)
+    {
+        mstd::SmoothParticleMeshEwald<>
+            spme(box, 1.0, alpha, {64, 64, 64}, 4, nThreads);
+
+        BENCHMARK(std::to_string(nThreads) + " threads")
+        {
+            return spme.compute(
+                positions.x,
+                positions.y,
+                positions.z,
+                charges,
+                fx,
+                fy,
+                fz
+            );
+        };
+    }
+}
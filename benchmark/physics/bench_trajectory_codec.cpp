@@ -0,0 +1,124 @@
+/*****************************************************************************
+<GPL_HEADER>
+
+    mstd library
+    Copyright (C) 2025-now  Jakob Gamper
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+<GPL_HEADER>
+******************************************************************************/
+
+#include <array>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <chrono>
+#include <cstddef>
+#include <random>
+#include <vector>
+
+#include "bench_utils.hpp"
+#include "mstd/physics/io/compressed_trajectory_codec.hpp"
+#include "mstd/physics/io/trajectory_format.hpp"
+
+TEST_CASE("compressed vs raw trajectory frames", "[!benchmark]")
+{
+    constexpr size_t nParticles = 1000000;
+    constexpr double precision  = 1e-3;   // 1 pm for coordinates in nm
+    constexpr size_t nFrames    = 20;
+
+    // water-like density in nm^-3, ~0.02 nm displacement between frames
+    const auto boxLength = bench::boxLengthForDensity(nParticles, 33.0);
+    const auto first     = bench::randomPositions(nParticles, boxLength);
+
+    std::mt19937_64                  engine(3);
+    std::normal_distribution<double> displacement(0.0, 0.02);
+
+    auto second = first;
+    for (auto* coordinate : {&second.x, &second.y, &second.z})
+        for (auto& value : *coordinate)
+            value += displacement(engine);
+
+    const auto rawBytes = 3 * nParticles * sizeof(double);
+
+    mstd::RawTrajectoryCodec<double>        raw;
+    mstd::CompressedTrajectoryCodec<double> compressed(precision);
+
+    std::vector<std::byte> payload;
+    payload.reserve(rawBytes + 64);
+
+    // alternating frames, so every frame after the first is a real delta
+    size_t     frame = 0;
+    const auto encodeNext =
+        [&](auto& codec)
+    {
+        const auto& positions = frame++ % 2 == 0 ? first : second;
+
+        payload.clear();
+        codec.encode(positions.x, positions.y, positions.z, payload);
+
+        return payload.size();
+    };
+
+    encodeNext(compressed);
+    const auto firstFrameBytes = payload.size();
+
+    const auto start = std::chrono::steady_clock::now();
+
+    size_t deltaBytes = 0;
+    for (size_t k = 1; k < nFrames; ++k)
+        deltaBytes += encodeNext(compressed);
+
+    const auto seconds = std::chrono::duration<double>(
+                             std::chrono::steady_clock::now() - start
+    )
+                             .count();
+
+    WARN(
+        "compressed frames are "
+        << static_cast<double>(rawBytes) /
+               static_cast<double>(firstFrameBytes)
+        << "x (first) and "
+        << static_cast<double>((nFrames - 1) * rawBytes) /
+               static_cast<double>(deltaBytes)
+        << "x (later) smaller than raw, encoded at "
+        << static_cast<double>((nFrames - 1) * rawBytes) / seconds * 1e-9
+        << " GB/s"
+    );
+
+    BENCHMARK("raw encode") { return encodeNext(raw); };
+
+    BENCHMARK("compressed encode") { return encodeNext(compressed); };
+
+    // decoding needs the frames in order: first, then alternating deltas
+    mstd::CompressedTrajectoryCodec<double> encoder(precision);
+    std::array<std::vector<std::byte>, 3>   frames;
+
+    encoder.encode(first.x, first.y, first.z, frames[0]);
+    encoder.encode(second.x, second.y, second.z, frames[1]);
+    encoder.encode(first.x, first.y, first.z, frames[2]);
+
+    std::vector<double> x(nParticles), y(nParticles), z(nParticles);
+
+    mstd::CompressedTrajectoryCodec<double> decoder;
+    decoder.decode(frames[0], x, y, z);
+
+    size_t decoded = 0;
+
+    BENCHMARK("compressed decode")
+    {
+        decoder.decode(frames[1 + decoded++ % 2], x, y, z);
+        return x[0];
+    };
+}
@@ -0,0 +1,153 @@
+/*****************************************************************************
+<GPL_HEADER>
+
+    mstd library
+    Copyright (C) 2025-now  Jakob Gamper
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+<GPL_HEADER>
+******************************************************************************/
+
+#include <algorithm>
+#include <array>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <chrono>
+#include <cstddef>
+#include <filesystem>
+#include <numeric>
+#include <vector>
+
+#include "bench_utils.hpp"
+#include "mstd/physics/io/trajectory_writer.hpp"
+#include "mstd/physics/pair_forces.hpp"
+#include "mstd/physics/particles.hpp"
+#include "mstd/physics/potentials/static_lie_potential.hpp"
+#include "mstd/physics/verlet_list.hpp"
+
+TEST_CASE("trajectory output every 100 steps vs step time", "[!benchmark]")
+{
+    constexpr size_t nParticles = 1000000;
+    constexpr double density    = 0.8;
+    constexpr double cutoff     = 2.5;
+    constexpr size_t interval   = 100;
+
+    const auto boxLength = bench::boxLengthForDensity(nParticles, density);
+    const auto positions = bench::randomPositions(nParticles, boxLength);
+
+    const std::array<double, 3> box{boxLength, boxLength, boxLength};
+
+    // cell ordered like a production code, so the step is not dominated
+    // by cache misses of randomly numbered neighbours
+    const auto nCells = static_cast<size_t>(boxLength / cutoff);
+    const auto cellOf = [&](const size_t i)
+    {
+        const auto cell = [&](const double r)
+        {
+            return static_cast<size_t>(
+                r / boxLength * static_cast<double>(nCells)
+            );
+        };
+
+        return (cell(positions.z[i]) * nCells + cell(positions.y[i])) *
+                   nCells +
+               cell(positions.x[i]);
+    };
+
+    std::vector<size_t> order(nParticles);
+    std::iota(order.begin(), order.end(), size_t{0});
+    std::ranges::sort(
+        order,
+        [&](const size_t a, const size_t b) { return cellOf(a) < cellOf(b); }
+    );
+
+    mstd::ParticleArrays<double> particles(nParticles);
+    for (size_t i = 0; i < nParticles; ++i)
+    {
+        particles.x[i] = positions.x[order[i]];
+        particles.y[i] = positions.y[order[i]];
+        particles.z[i] = positions.z[order[i]];
+    }
+
+    const mstd::StaticLJShiftedPotential<double> potential(1.0, 1.0, cutoff);
+
+    mstd::VerletList<double> verletList(box, cutoff, 0.3);
+    verletList.update(particles.x, particles.y, particles.z);
+
+    const auto path =
+        std::filesystem::temp_directory_path() / "mstd_bench_trajectory.trj";
+
+    mstd::TrajectoryWriter<> writer(path, nParticles);
+
+    const auto step = [&]
+    {
+        return mstd::computePairForces(
+            verletList,
+            potential,
+            particles.x,
+            particles.y,
+            particles.z,
+            particles.fx,
+            particles.fy,
+            particles.fz
+        );
+    };
+
+    // wall time of a single call, the writer idle as between two frames
+    const auto seconds = [](const auto& call)
+    {
+        const auto start = std::chrono::steady_clock::now();
+        call();
+        return std::chrono::duration<double>(
+                   std::chrono::steady_clock::now() - start
+        )
+            .count();
+    };
+
+    double stepTime  = 0.0;
+    double writeTime = 0.0;
+
+    for (size_t k = 0; k < 5; ++k)
+    {
+        stepTime  += seconds(step);
+        writeTime += seconds([&] { writer.write(k, particles); });
+        writer.flush();
+    }
+
+    WARN(
+        "write() returns after " << writeTime / 5 * 1e3 << " ms, "
+                                 << 100 * writeTime / (interval * stepTime)
+                                 << " % of the step time at one frame per "
+                                 << interval << " steps"
+    );
+
+    BENCHMARK("force step")
+    {
+        return step();
+    };
+
+    size_t counter = 0;
+
+    BENCHMARK("force step, frame written every 100 steps")
+    {
+        if (++counter % interval == 0)
+            writer.write(counter, particles);
+
+        return step();
+    };
+
+    writer.flush();
+    std::filesystem::remove(path);
+}
@@ -0,0 +1,120 @@
+/*****************************************************************************
+<GPL_HEADER>
+
+    mstd library
+    Copyright (C) 2025-now  Jakob Gamper
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+<GPL_HEADER>
+******************************************************************************/
+
+#ifndef __PHYSICS__BENCH_UTILS_HPP__
+#define __PHYSICS__BENCH_UTILS_HPP__
+
+#include <cmath>
+#include <cstddef>
+#include <random>
+#include <utility>
+#include <vector>
+
+namespace bench
+{
+    /**
+     * @brief SoA particle coordinates for benchmarks
+     */
+    struct Positions
+    {
+        std::vector<double> x;
+        std::vector<double> y;
+        std::vector<double> z;
+    };
+
+    /**
+     * @brief uniformly distributed particles in a cubic box
+     *
+     * @param nParticles
+     * @param boxLength
+     * @param seed
+     * @return Positions
+     */
+    inline Positions randomPositions(
+        const size_t nParticles,
+        const double boxLength,
+        const unsigned seed = 42
+    )
+    {
+        std::mt19937_64                        engine(seed);
+        std::uniform_real_distribution<double> dist(0.0, boxLength);
+
+        Positions positions;
+        positions.x.resize(nParticles);
+        positions.y.resize(nParticles);
+        positions.z.resize(nParticles);
+
+        for (size_t i = 0; i < nParticles; ++i)
+        {
+            positions.x[i] = dist(engine);
+            positions.y[i] = dist(engine);
+            positions.z[i] = dist(engine);
+        }
+
+        return positions;
+    }
+
+    /**
+     * @brief box length of a cubic box with @p nParticles at @p density
+     */
+    inline double boxLengthForDensity(
+        const size_t nParticles,
+        const double density
+    )
+    {
+        return std::cbrt(static_cast<double>(nParticles) / density);
+    }
+
+    /**
+     * @brief brute force list of all minimum-image pairs within @p cutoff
+     */
+    inline std::vector<std::pair<size_t, size_t>> bruteForcePairs(
+        const Positions& positions,
+        const double     boxLength,
+        const double     cutoff
+    )
+    {
+        std::vector<std::pair<size_t, size_t>> pairs;
+
+        const size_t nParticles = positions.x.size();
+        for (size_t i = 0; i < nParticles; ++i)
+        {
+            for (size_t j = i + 1; j < nParticles; ++j)
+            {
+                auto dx = positions.x[i] - positions.x[j];
+                auto dy = positions.y[i] - positions.y[j];
+                auto dz = positions.z[i] - positions.z[j];
+                dx     -= boxLength * std::nearbyint(dx / boxLength);
+                dy     -= boxLength * std::nearbyint(dy / boxLength);
+                dz     -= boxLength * std::nearbyint(dz / boxLength);
+
+                if (dx * dx + dy * dy + dz * dz < cutoff * cutoff)
+                    pairs.emplace_back(i, j);
+            }
+        }
+
+        return pairs;
+    }
+
+}   // namespace bench
+
+#endif   // __PHYSICS__BENCH_UTILS_HPP__
@@ -0,0 +1,119 @@
+/*****************************************************************************
+<GPL_HEADER>
+
+    mstd library
+    Copyright (C) 2025-now  Jakob Gamper
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+<GPL_HEADER>
+******************************************************************************/
+
+#include <algorithm>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "mstd/random/philox.hpp"
+#include "mstd/random/stream.hpp"
+#include "mstd/random/threefry.hpp"
+
+TEST_CASE("uniform doubles, counter-based vs mt19937_64", "[!benchmark]")
+{
+    constexpr size_t nValues = 1 << 20;
+
+    std::vector<double> values(nValues);
+
+    std::mt19937_64                        engine(42);
+    std::uniform_real_distribution<double> uniform(0.0, 1.0);
+
+    mstd::RandomStream<mstd::Philox4x32<>>   philox32(std::uint64_t{42});
+    mstd::RandomStream<mstd::Philox4x64<>>   philox64(std::uint64_t{42});
+    mstd::RandomStream<mstd::Threefry4x64<>> threefry(std::uint64_t{42});
+
+    BENCHMARK("std::mt19937_64, uniform_real_distribution")
+    {
+        std::ranges::generate(values, [&] { return uniform(engine); });
+        return values.back();
+    };
+
+    BENCHMARK("Philox4x32 fill")
+    {
+        philox32.fill(values);
+        return values.back();
+    };
+
+    BENCHMARK("Philox4x64 fill")
+    {
+        philox64.fill(values);
+        return values.back();
+    };
+
+    BENCHMARK("Threefry4x64 fill")
+    {
+        threefry.fill(values);
+        return values.back();
+    };
+
+    BENCHMARK("Philox4x32 scalar operator()")
+    {
+        std::ranges::generate(
+            values,
+            [&] { return mstd::uniformFromBits(philox32()); }
+        );
+        return values.back();
+    };
+}
+
+TEST_CASE("normal doubles, counter-based vs mt19937_64", "[!benchmark]")
+{
+    using mstd::NormalMethod;
+
+    constexpr size_t nValues = 1 << 20;
+
+    std::vector<double> values(nValues);
+
+    std::mt19937_64                  engine(42);
+    std::normal_distribution<double> normal(0.0, 1.0);
+
+    mstd::RandomStream<mstd::Philox4x32<>>   philox32(std::uint64_t{42});
+    mstd::RandomStream<mstd::Threefry4x64<>> threefry(std::uint64_t{42});
+
+    BENCHMARK("std::mt19937_64, normal_distribution")
+    {
+        std::ranges::generate(values, [&] { return normal(engine); });
+        return values.back();
+    };
+
+    BENCHMARK("Philox4x32 Ziggurat")
+    {
+        philox32.fillNormal(values);
+        return values.back();
+    };
+
+    BENCHMARK("Threefry4x64 Ziggurat")
+    {
+        threefry.fillNormal(values);
+        return values.back();
+    };
+
+    BENCHMARK("Philox4x32 Box-Muller")
+    {
+        philox32.fillNormal(values, 0.0, 1.0, NormalMethod::BoxMuller);
+        return values.back();
+    };
+}
@@ -23,6 +23,7 @@
 #ifndef __MSTD__MATH_HPP__
 #define __MSTD__MATH_HPP__
 
+#include "math/fft.hpp"     // IWYU pragma: export
 #include "math/power.hpp"   // IWYU pragma: export
 
 #endif   // __MSTD__MATH_HPP__
\ No newline at end of file
@@ -0,0 +1,632 @@
+/*****************************************************************************
+<GPL_HEADER>
+
+    mstd library
+    Copyright (C) 2025-now  Jakob Gamper
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+<GPL_HEADER>
+******************************************************************************/
+
+#ifndef __MSTD__MATH__FFT_HPP__
+#define __MSTD__MATH__FFT_HPP__
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cmath>
+#include <complex>
+#include <concepts>
+#include <cstddef>
+#include <numbers>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+#include "mstd/parallel.hpp"
+
+namespace mstd
+{
+    namespace details
+    {
+        /**
+         * @brief complex product without the NaN/infinity recovery of
+         *        `std::complex::operator*`, which otherwise compiles to a
+         *        library call
+         */
+        template <typename Rep>
+        inline std::complex<Rep> complexMul(
+            const std::complex<Rep> a,
+            const std::complex<Rep> b
+        )
+        {
+            return {
+                a.real() * b.real() - a.imag() * b.imag(),
+                a.real() * b.imag() + a.imag() * b.real()
+            };
+        }
+
+    }   // namespace details
+
+    /**
+     * @brief One-dimensional complex FFT of a fixed length.
+     *
+     * Recursive mixed radix decimation in time for arbitrary lengths, with
+     * dedicated butterflies for the radices 4 and 2 and a generic one for
+     * the remaining prime factors. Lengths built from small primes (e.g.
+     * 2, 3 and 5) are fast; a large prime factor \f$p\f$ costs
+     * \f$O(n p)\f$.
+     *
+     * Both directions are unnormalized: `forward` computes
+     * \f$X_k = \sum_j x_j e^{-2 \pi i jk/n}\f$ and `backward` the same sum
+     * with the opposite sign, so a round trip scales by \f$n\f$.
+     *
+     * The transforms are `const` and only touch the caller provided work
+     * buffer, so one instance can be shared between threads.
+     *
+     * @tparam Rep floating point representation.
+     */
+    template <std::floating_point Rep = double>
+    class Fft
+    {
+       private:
+        using Complex = std::complex<Rep>;
+
+        size_t               _size;
+        std::vector<size_t>  _factors;
+        std::vector<Complex> _twiddles;
+
+       public:
+        /**
+         * @brief Prepares the factorization and twiddle factors for
+         *        transforms of length @p n.
+         *
+         * @throws std::invalid_argument if @p n is zero.
+         */
+        explicit Fft(const size_t n) : _size(n), _twiddles(n)
+        {
+            if (n == 0)
+                throw std::invalid_argument("Fft requires n > 0");
+
+            auto rest = n;
+            for (const size_t p : {size_t{4}, size_t{2}, size_t{3}})
+                while (rest % p == 0)
+                {
+                    _factors.push_back(p);
+                    rest /= p;
+                }
+
+            for (size_t p = 5; p * p <= rest; p += 2)
+                while (rest % p == 0)
+                {
+                    _factors.push_back(p);
+                    rest /= p;
+                }
+
+            if (rest > 1)
+                _factors.push_back(rest);
+
+            constexpr auto twoPi = 2 * std::numbers::pi_v<Rep>;
+
+            for (size_t k = 0; k < n; ++k)
+            {
+                const auto angle =
+                    -twoPi * static_cast<Rep>(k) / static_cast<Rep>(n);
+                _twiddles[k] = {std::cos(angle), std::sin(angle)};
+            }
+        }
+
+        /// @brief Returns the transform length.
+        size_t size() const { return _size; }
+
+        /**
+         * @brief In-place forward transform of @p data.
+         *
+         * @pre `data.size() == size()` and `work.size() >= size()`
+         */
+        void forward(std::span<Complex> data, std::span<Complex> work) const
+        {
+            _run<false>(data, work);
+        }
+
+        /**
+         * @brief In-place backward (inverse, unnormalized) transform of
+         *        @p data.
+         *
+         * @pre `data.size() == size()` and `work.size() >= size()`
+         */
+        void backward(std::span<Complex> data, std::span<Complex> work) const
+        {
+            _run<true>(data, work);
+        }
+
+        /// @brief forward with an internally allocated work buffer.
+        void forward(std::span<Complex> data) const
+        {
+            std::vector<Complex> work(_size);
+            forward(data, work);
+        }
+
+        /// @brief backward with an internally allocated work buffer.
+        void backward(std::span<Complex> data) const
+        {
+            std::vector<Complex> work(_size);
+            backward(data, work);
+        }
+
+       private:
+        template <bool Inverse>
+        void _run(std::span<Complex> data, std::span<Complex> work) const
+        {
+            assert(data.size() == _size && work.size() >= _size);
+
+            std::ranges::copy(data, work.begin());
+            _transform<Inverse>(work.data(), data.data(), _size, 1, 0);
+        }
+
+        template <bool Inverse>
+        Complex _twiddle(const size_t k) const
+        {
+            assert(k < _size);
+
+            const auto w = _twiddles[k];
+            return Inverse ? std::conj(w) : w;
+        }
+
+        /**
+         * @brief transforms the @p n values `in[0], in[stride], ...` into
+         *        `out[0..n)`
+         *
+         * The input is split into `p` decimated subsequences, which are
+         * transformed recursively into consecutive blocks of @p out and then
+         * combined by the radix `p` butterflies in place.
+         */
+        template <bool Inverse>
+        void _transform(
+            const Complex* in,
+            Complex*       out,
+            const size_t   n,
+            const size_t   stride,
+            const size_t   level
+        ) const
+        {
+            if (n == 1)
+            {
+                out[0] = in[0];
+                return;
+            }
+
+            const auto p = _factors[level];
+            const auto m = n / p;
+
+            for (size_t q = 0; q < p; ++q)
+                _transform<Inverse>(
+                    in + q * stride,
+                    out + q * m,
+                    m,
+                    stride * p,
+                    level + 1
+                );
+
+            if (p == 2)
+                _butterfly2<Inverse>(out, m, stride);
+            else if (p == 4)
+                _butterfly4<Inverse>(out, m, stride);
+            else
+                _butterflyGeneric<Inverse>(out, p, m, stride);
+        }
+
+        template <bool Inverse>
+        void _butterfly2(Complex* out, const size_t m, const size_t stride)
+            const
+        {
+            for (size_t k = 0; k < m; ++k)
+            {
+                const auto a0 = out[k];
+                const auto a1 = details::complexMul(
+                    out[m + k],
+                    _twiddle<Inverse>(k * stride)
+                );
+
+                out[k]     = a0 + a1;
+                out[m + k] = a0 - a1;
+            }
+        }
+
+        template <bool Inverse>
+        void _butterfly4(Complex* out, const size_t m, const size_t stride)
+            const
+        {
+            for (size_t k = 0; k < m; ++k)
+            {
+                const auto a0 = out[k];
+                const auto a1 = details::complexMul(
+                    out[m + k],
+                    _twiddle<Inverse>(k * stride)
+                );
+                const auto a2 = details::complexMul(
+                    out[2 * m + k],
+                    _twiddle<Inverse>(2 * k * stride)
+                );
+                const auto a3 = details::complexMul(
+                    out[3 * m + k],
+                    _twiddle<Inverse>(3 * k * stride)
+                );
+
+                const auto sum02  = a0 + a2;
+                const auto diff02 = a0 - a2;
+                const auto sum13  = a1 + a3;
+                const auto diff13 = a1 - a3;
+
+                // multiplication by -i (forward) or +i (backward)
+                const auto rotated =
+                    Inverse ? Complex{-diff13.imag(), diff13.real()}
+                            : Complex{diff13.imag(), -diff13.real()};
+
+                out[k]         = sum02 + sum13;
+                out[m + k]     = diff02 + rotated;
+                out[2 * m + k] = sum02 - sum13;
+                out[3 * m + k] = diff02 - rotated;
+            }
+        }
+
+        template <bool Inverse>
+        void _butterflyGeneric(
+            Complex*     out,
+            const size_t p,
+            const size_t m,
+            const size_t stride
+        ) const
+        {
+            // small radices avoid the allocation
+            std::array<Complex, 16> small{};
+            std::vector<Complex>    large(p > small.size() ? p : 0);
+
+            const auto a = p > small.size() ? large.data() : small.data();
+
+            // roots of unity of order p are every (n / p)-th twiddle
+            const auto rootStride = m * stride;
+
+            for (size_t k = 0; k < m; ++k)
+            {
+                for (size_t q = 0; q < p; ++q)
+                    a[q] = details::complexMul(
+                        out[q * m + k],
+                        _twiddle<Inverse>(q * k * stride)
+                    );
+
+                for (size_t s = 0; s < p; ++s)
+                {
+                    Complex sum = a[0];
+                    for (size_t q = 1; q < p; ++q)
+                        sum += details::complexMul(
+                            a[q],
+                            _twiddle<Inverse>((q * s % p) * rootStride)
+                        );
+
+                    out[s * m + k] = sum;
+                }
+            }
+        }
+    };
+
+    /**
+     * @brief Three-dimensional real-to-complex FFT.
+     *
+     * The real grid is stored row major with the last index (@p nz)
+     * running fastest. Its transform is Hermitian, so only the
+     * `nz / 2 + 1` non-negative frequencies of the last dimension are
+     * stored, again row major. For even @p nz the real lines are
+     * transformed as complex lines of half the length.
+     *
+     * Both directions are unnormalized, a round trip scales by
+     * `nx * ny * nz`. The lines of every pass are distributed over
+     * `nThreads` threads.
+     *
+     * @tparam Rep floating point representation.
+     */
+    template <std::floating_point Rep = double>
+    class RealFft3d
+    {
+       private:
+        using Complex = std::complex<Rep>;
+
+        std::array<size_t, 3> _shape;
+        size_t                _nzComplex;
+
+        Fft<Rep> _fftX;
+        Fft<Rep> _fftY;
+        Fft<Rep> _fftZ;   ///< half length for even nz
+
+        std::vector<Complex> _halfTwiddles;
+
+       public:
+        /**
+         * @brief Prepares transforms of a real `nx * ny * nz` grid.
+         *
+         * @throws std::invalid_argument if a dimension is zero.
+         */
+        RealFft3d(const size_t nx, const size_t ny, const size_t nz)
+            : _shape{nx, ny, nz},
+              _nzComplex(nz / 2 + 1),
+              _fftX(nx),
+              _fftY(ny),
+              _fftZ(nz % 2 == 0 ? nz / 2 : nz)
+        {
+            if (nz % 2 == 0)
+            {
+                constexpr auto twoPi = 2 * std::numbers::pi_v<Rep>;
+
+                _halfTwiddles.resize(nz / 2 + 1);
+                for (size_t k = 0; k <= nz / 2; ++k)
+                {
+                    const auto angle =
+                        -twoPi * static_cast<Rep>(k) / static_cast<Rep>(nz);
+                    _halfTwiddles[k] = {std::cos(angle), std::sin(angle)};
+                }
+            }
+        }
+
+        /// @brief Returns the real grid dimensions.
+        const std::array<size_t, 3>& shape() const { return _shape; }
+
+        /// @brief Returns the number of real grid points.
+        size_t realSize() const { return _shape[0] * _shape[1] * _shape[2]; }
+
+        /// @brief Returns the number of stored complex coefficients.
+        size_t complexSize() const
+        {
+            return _shape[0] * _shape[1] * _nzComplex;
+        }
+
+        /// @brief Returns the stored length `nz / 2 + 1` of the last
+        ///        dimension of the transform.
+        size_t nzComplex() const { return _nzComplex; }
+
+        /**
+         * @brief Forward transform of the real grid @p in into @p out.
+         *
+         * @pre `in.size() == realSize()` and `out.size() == complexSize()`
+         */
+        void forward(
+            std::span<const Rep> in,
+            std::span<Complex>   out,
+            const size_t         nThreads = 1
+        ) const
+        {
+            assert(in.size() == realSize() && out.size() == complexSize());
+
+            const auto [nx, ny, nz] = _shape;
+
+            parallelFor(
+                nThreads,
+                nx * ny,
+                [&](const size_t begin, const size_t end, size_t)
+                {
+                    std::vector<Complex> line(nz), work(nz);
+                    for (size_t row = begin; row < end; ++row)
+                        _forwardReal(
+                            in.subspan(row * nz, nz),
+                            out.subspan(row * _nzComplex, _nzComplex),
+                            line,
+                            work
+                        );
+                }
+            );
+
+            _complexPasses<false>(out, nThreads);
+        }
+
+        /**
+         * @brief Backward transform of the Hermitian coefficients @p in
+         *        into the real grid @p out.
+         *
+         * @p in is used as scratch space and overwritten.
+         *
+         * @pre `in.size() == complexSize()` and `out.size() == realSize()`
+         */
+        void backward(
+            std::span<Complex> in,
+            std::span<Rep>     out,
+            const size_t       nThreads = 1
+        ) const
+        {
+            assert(in.size() == complexSize() && out.size() == realSize());
+
+            const auto [nx, ny, nz] = _shape;
+
+            _complexPasses<true>(in, nThreads);
+
+            parallelFor(
+                nThreads,
+                nx * ny,
+                [&](const size_t begin, const size_t end, size_t)
+                {
+                    std::vector<Complex> line(nz), work(nz);
+                    for (size_t row = begin; row < end; ++row)
+                        _backwardReal(
+                            in.subspan(row * _nzComplex, _nzComplex),
+                            out.subspan(row * nz, nz),
+                            line,
+                            work
+                        );
+                }
+            );
+        }
+
+       private:
+        /// @brief transforms along y and x, gathering strided lines
+        template <bool Inverse>
+        void _complexPasses(std::span<Complex> data, const size_t nThreads)
+            const
+        {
+            const auto [nx, ny, nz] = _shape;
+
+            const auto transform =
+                [](const Fft<Rep>& fft, auto line, auto work)
+            {
+                if constexpr (Inverse)
+                    fft.backward(line, work);
+                else
+                    fft.forward(line, work);
+            };
+
+            const auto pass = [&](const Fft<Rep>& fft,
+                                  const size_t    nLines,
+                                  const size_t    length,
+                                  const size_t    stride,
+                                  auto&&          lineStart)
+            {
+                parallelFor(
+                    nThreads,
+                    nLines,
+                    [&](const size_t begin, const size_t end, size_t)
+                    {
+                        std::vector<Complex> line(length), work(length);
+                        for (size_t l = begin; l < end; ++l)
+                        {
+                            const auto start = lineStart(l);
+
+                            for (size_t k = 0; k < length; ++k)
+                                line[k] = data[start + k * stride];
+
+                            transform(fft, std::span(line), std::span(work));
+
+                            for (size_t k = 0; k < length; ++k)
+                                data[start + k * stride] = line[k];
+                        }
+                    }
+                );
+            };
+
+            const auto nzc = _nzComplex;
+
+            // lines along y: one per (x, kz)
+            const auto yLines = [&](const size_t l)
+            { return (l / nzc) * ny * nzc + l % nzc; };
+
+            // lines along x: one per (y, kz)
+            const auto xLines = [&](const size_t l) { return l; };
+
+            if constexpr (Inverse)
+            {
+                pass(_fftX, ny * nzc, nx, ny * nzc, xLines);
+                pass(_fftY, nx * nzc, ny, nzc, yLines);
+            }
+            else
+            {
+                pass(_fftY, nx * nzc, ny, nzc, yLines);
+                pass(_fftX, ny * nzc, nx, ny * nzc, xLines);
+            }
+        }
+
+        /// @brief real-to-complex transform of one line along z
+        void _forwardReal(
+            std::span<const Rep> in,
+            std::span<Complex>   out,
+            std::span<Complex>   line,
+            std::span<Complex>   work
+        ) const
+        {
+            const auto nz = _shape[2];
+
+            if (nz % 2 != 0)
+            {
+                for (size_t k = 0; k < nz; ++k)
+                    line[k] = in[k];
+
+                _fftZ.forward(line, work);
+                std::copy_n(line.begin(), _nzComplex, out.begin());
+                return;
+            }
+
+            // pack even and odd samples into one complex line of half length
+            const auto half = nz / 2;
+            const auto z    = line.first(half);
+
+            for (size_t j = 0; j < half; ++j)
+                z[j] = {in[2 * j], in[2 * j + 1]};
+
+            _fftZ.forward(z, work.first(half));
+
+            for (size_t k = 0; k <= half; ++k)
+            {
+                const auto a = z[k % half];
+                const auto b = std::conj(z[(half - k) % half]);
+
+                const auto sum  = a + b;
+                const auto diff = a - b;
+
+                // (a + b) / 2 and (a - b) / (2i)
+                const Complex even{sum.real() / 2, sum.imag() / 2};
+                const Complex odd{diff.imag() / 2, -diff.real() / 2};
+
+                out[k] = even + details::complexMul(_halfTwiddles[k], odd);
+            }
+        }
+
+        /// @brief complex-to-real transform of one line along z
+        void _backwardReal(
+            std::span<const Complex> in,
+            std::span<Rep>           out,
+            std::span<Complex>       line,
+            std::span<Complex>       work
+        ) const
+        {
+            const auto nz = _shape[2];
+
+            if (nz % 2 != 0)
+            {
+                std::copy_n(in.begin(), _nzComplex, line.begin());
+                for (size_t k = _nzComplex; k < nz; ++k)
+                    line[k] = std::conj(in[nz - k]);
+
+                _fftZ.backward(line, work);
+                for (size_t k = 0; k < nz; ++k)
+                    out[k] = line[k].real();
+                return;
+            }
+
+            // undo the even/odd split, then one complex line of half length
+            const auto half = nz / 2;
+            const auto z    = line.first(half);
+
+            for (size_t k = 0; k < half; ++k)
+            {
+                const auto a = in[k];
+                const auto b = std::conj(in[half - k]);
+
+                const auto even = a + b;
+                const auto odd  = details::complexMul(
+                    a - b,
+                    std::conj(_halfTwiddles[k])
+                );
+
+                z[k] = even + Complex{-odd.imag(), odd.real()};
+            }
+
+            _fftZ.backward(z, work.first(half));
+
+            for (size_t j = 0; j < half; ++j)
+            {
+                out[2 * j]     = z[j].real();
+                out[2 * j + 1] = z[j].imag();
+            }
+        }
+    };
+
+}   // namespace mstd
+
+#endif   // __MSTD__MATH__FFT_HPP__
@@ -0,0 +1,106 @@
+/*****************************************************************************
+<GPL_HEADER>
+
+    mstd library
+    Copyright (C) 2025-now  Jakob Gamper
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+<GPL_HEADER>
+******************************************************************************/
+
+#ifndef __MSTD__MEMORY__ALIGNED_ALLOCATOR_HPP__
+#define __MSTD__MEMORY__ALIGNED_ALLOCATOR_HPP__
+
+#include <cstddef>
+#include <new>
+#include <vector>
+
+namespace mstd
+{
+    /**
+     * @brief size of a cache line assumed for data layout decisions
+     */
+    static constexpr size_t cache_line_bytes = 64;
+
+    /**
+     * @brief Allocator returning memory aligned to @p Alignment bytes.
+     *
+     * Used for tables and particle arrays that are streamed with SIMD loads
+     * so that no element straddles a cache line boundary.
+     *
+     * @tparam T value type
+     * @tparam Alignment alignment in bytes (default: one cache line)
+     */
+    template <typename T, size_t Alignment = cache_line_bytes>
+    class AlignedAllocator
+    {
+        static_assert(
+            Alignment >= alignof(T) && (Alignment & (Alignment - 1)) == 0,
+            "Alignment has to be a power of two not smaller than alignof(T)"
+        );
+
+       public:
+        using value_type = T;
+
+        template <typename U>
+        struct rebind
+        {
+            using other = AlignedAllocator<U, Alignment>;
+        };
+
+        constexpr AlignedAllocator() noexcept = default;
+
+        template <typename U>
+        constexpr AlignedAllocator(   // NOLINT(google-explicit-constructor)
+            const AlignedAllocator<U, Alignment>&
+        ) noexcept
+        {
+        }
+
+        /// @brief Allocates uninitialized storage for @p n objects.
+        [[nodiscard]] T* allocate(const size_t n)
+        {
+            return static_cast<T*>(
+                ::operator new(n * sizeof(T), std::align_val_t{Alignment})
+            );
+        }
+
+        /// @brief Releases storage obtained from allocate.
+        void deallocate(T* ptr, const size_t n) noexcept
+        {
+            ::operator delete(ptr, n * sizeof(T), std::align_val_t{Alignment});
+        }
+
+        template <typename U>
+        constexpr bool operator==(
+            const AlignedAllocator<U, Alignment>&
+        ) const noexcept
+        {
+            return true;
+        }
+    };
+
+    /**
+     * @brief std::vector whose storage is aligned to @p Alignment bytes
+     *
+     * @tparam T value type
+     * @tparam Alignment alignment in bytes (default: one cache line)
+     */
+    template <typename T, size_t Alignment = cache_line_bytes>
+    using AlignedVector = std::vector<T, AlignedAllocator<T, Alignment>>;
+
+}   // namespace mstd
+
+#endif   // __MSTD__MEMORY__ALIGNED_ALLOCATOR_HPP__
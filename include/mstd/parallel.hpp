@@ -0,0 +1,203 @@
+/*****************************************************************************
+<GPL_HEADER>
+
+    mstd library
+    Copyright (C) 2025-now  Jakob Gamper
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+<GPL_HEADER>
+******************************************************************************/
+
+#ifndef __MSTD__PARALLEL_HPP__
+#define __MSTD__PARALLEL_HPP__
+
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <stop_token>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace mstd
+{
+    /**
+     * @brief splits `[0, n)` into @p nThreads contiguous ranges and calls
+     *        `fn(begin, end, thread)` for each of them in parallel
+     *
+     * The calling thread processes the first range itself. A thread count
+     * of 0, as returned by `std::thread::hardware_concurrency` when it is
+     * unknown, runs the whole range on the calling thread.
+     */
+    template <typename Fn>
+    void parallelFor(const size_t nThreads, const size_t n, Fn&& fn)
+    {
+        if (nThreads <= 1)
+        {
+            fn(size_t{0}, n, size_t{0});
+            return;
+        }
+
+        const auto range = [&](const size_t thread)
+        {
+            fn(n * thread / nThreads, n * (thread + 1) / nThreads, thread);
+        };
+
+        std::vector<std::jthread> threads;
+        threads.reserve(nThreads - 1);
+
+        for (size_t thread = 1; thread < nThreads; ++thread)
+            threads.emplace_back(range, thread);
+
+        range(0);
+    }
+
+    /**
+     * @brief fixed team of threads that runs one task on all of them
+     *
+     * `run(fn)` calls `fn(thread)` for every `thread` in `[0, size())`, the
+     * calling thread taking 0, and returns when all calls have finished.
+     * The workers are started once and sleep between tasks, so repeated
+     * runs do not pay for thread creation. If calls throw, run rethrows the
+     * first exception after all calls have finished.
+     */
+    class ThreadPool
+    {
+       private:
+        std::mutex                  _mutex;
+        std::condition_variable_any _wake;
+        std::condition_variable     _done;
+
+        void (*_invoke)(void*, size_t) = nullptr;
+        void*              _task       = nullptr;
+        size_t             _generation = 0;
+        size_t             _pending    = 0;
+        std::exception_ptr _error;
+
+        // declared last so the workers stop before the state above is gone
+        std::vector<std::jthread> _threads;
+
+       public:
+        /**
+         * @brief Starts @p nThreads - 1 workers; 0 and 1 both run every
+         *        task on the calling thread only.
+         */
+        explicit ThreadPool(const size_t nThreads)
+        {
+            const auto nWorkers = nThreads > 1 ? nThreads - 1 : 0;
+
+            _threads.reserve(nWorkers);
+
+            for (size_t thread = 1; thread <= nWorkers; ++thread)
+                _threads.emplace_back(
+                    [this, thread](const std::stop_token stop)
+                    { _work(stop, thread); }
+                );
+        }
+
+        ThreadPool(const ThreadPool&)            = delete;
+        ThreadPool& operator=(const ThreadPool&) = delete;
+
+        /// @brief Returns the number of threads including the calling one.
+        size_t size() const { return _threads.size() + 1; }
+
+        /**
+         * @brief Calls `fn(thread)` on all threads and waits for them.
+         *
+         * @throws the first exception thrown by any of the calls.
+         */
+        template <typename Fn>
+        void run(Fn&& fn)
+        {
+            using Task = std::remove_reference_t<Fn>;
+
+            {
+                const std::lock_guard lock(_mutex);
+
+                _invoke = [](void* task, const size_t thread)
+                { (*static_cast<Task*>(task))(thread); };
+                _task = const_cast<void*>(
+                    static_cast<const void*>(std::addressof(fn))
+                );
+                _pending = _threads.size();
+                ++_generation;
+            }
+            _wake.notify_all();
+
+            _call(_invoke, _task, 0);
+
+            std::unique_lock lock(_mutex);
+            _done.wait(lock, [this] { return _pending == 0; });
+
+            if (_error)
+                std::rethrow_exception(std::exchange(_error, nullptr));
+        }
+
+       private:
+        void _work(const std::stop_token stop, const size_t thread)
+        {
+            size_t generation = 0;
+
+            while (true)
+            {
+                std::unique_lock lock(_mutex);
+
+                if (!_wake.wait(
+                        lock,
+                        stop,
+                        [&] { return _generation != generation; }
+                    ))
+                    return;
+
+                generation        = _generation;
+                const auto invoke = _invoke;
+                const auto task   = _task;
+                lock.unlock();
+
+                _call(invoke, task, thread);
+
+                lock.lock();
+                if (--_pending == 0)
+                    _done.notify_one();
+            }
+        }
+
+        /// runs one call and keeps the first exception of the task
+        void _call(
+            void (*invoke)(void*, size_t),
+            void*        task,
+            const size_t thread
+        )
+        {
+            try
+            {
+                invoke(task, thread);
+            }
+            catch (...)
+            {
+                const std::lock_guard lock(_mutex);
+
+                if (!_error)
+                    _error = std::current_exception();
+            }
+        }
+    };
+
+}   // namespace mstd
+
+#endif   // __MSTD__PARALLEL_HPP__
@@ -23,6 +23,20 @@
 #ifndef __MSTD__PHYSICS_HPP__
 #define __MSTD__PHYSICS_HPP__
 
-#include "physics/potentials.hpp"   // IWYU pragma: export
+#include "physics/all_pairs.hpp"              // IWYU pragma: export
+#include "physics/box.hpp"                    // IWYU pragma: export
+#include "physics/cell_list.hpp"              // IWYU pragma: export
+#include "physics/ewald.hpp"                  // IWYU pragma: export
+#include "physics/integrator.hpp"             // IWYU pragma: export
+#include "physics/io.hpp"                     // IWYU pragma: export
+#include "physics/monte_carlo.hpp"            // IWYU pragma: export
+#include "physics/pair_forces.hpp"            // IWYU pragma: export
+#include "physics/parallel_pair_forces.hpp"   // IWYU pragma: export
+#include "physics/particles.hpp"              // IWYU pragma: export
+#include "physics/potentials.hpp"             // IWYU pragma: export
+#include "physics/spme.hpp"                   // IWYU pragma: export
+#include "physics/thermostat.hpp"             // IWYU pragma: export
+#include "physics/verlet_list.hpp"            // IWYU pragma: export
+#include "physics/virial.hpp"                 // IWYU pragma: export
 
 #endif   // __MSTD__PHYSICS_HPP__
\ No newline at end of file
@@ -0,0 +1,207 @@
+/*****************************************************************************
+<GPL_HEADER>
+
+    mstd library
+    Copyright (C) 2025-now  Jakob Gamper
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+<GPL_HEADER>
+******************************************************************************/
+
+#ifndef __MSTD__PHYSICS__ALL_PAIRS_HPP__
+#define __MSTD__PHYSICS__ALL_PAIRS_HPP__
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cmath>
+#include <span>
+#include <stdexcept>
+#include <utility>
+
+#include "box.hpp"
+
+namespace mstd
+{
+    /**
+     * @brief Brute force pair source visiting all \f$N(N-1)/2\f$ pairs.
+     *
+     * Shares the interface of CellList and VerletList and serves as the
+     * reference for small systems and tests.
+     *
+     * @tparam Rep numeric representation.
+     * @tparam Box periodic box type, see BoxType.
+     */
+    template <typename Rep = double, typename Box = OrthorhombicBox<Rep>>
+    class AllPairs
+    {
+       private:
+        Box _box;
+        Rep _cutoff{};
+
+       public:
+        using rep      = Rep;
+        using box_type = Box;
+
+        /**
+         * @brief Sets up the pair source for a box and cutoff.
+         *
+         * @param box periodic box, e.g. the edge lengths of an orthorhombic
+         *        box.
+         * @param cutoff interaction cutoff.
+         *
+         * @throws std::invalid_argument if the cutoff is not positive or the
+         *         box is thinner than twice the cutoff in any direction.
+         */
+        AllPairs(const Box& box, const Rep cutoff) : _box(box), _cutoff(cutoff)
+        {
+            if (!(cutoff > 0))
+                throw std::invalid_argument("AllPairs requires cutoff > 0");
+
+            for (const auto width : _box.perpendicularWidths())
+                if (!(width >= 2 * cutoff))
+                    throw std::invalid_argument(
+                        "AllPairs requires box widths >= 2 * cutoff"
+                    );
+        }
+
+        /**
+         * @brief Calls @p callback once for every pair within the cutoff.
+         *
+         * The callback receives `(i, j, dx, dy, dz, r2)` with `i < j`,
+         * `(dx, dy, dz)` the minimum image of \f$\vec{r}_i - \vec{r}_j\f$
+         * and `r2` its squared length.
+         */
+        template <typename Callback>
+        void forEachPair(
+            std::span<const Rep> x,
+            std::span<const Rep> y,
+            std::span<const Rep> z,
+            Callback&&           callback
+        ) const
+        {
+            forEachPairInRange(0, x.size(), x, y, z, callback);
+        }
+
+        /**
+         * @brief Like forEachPair, restricted to pairs whose first particle
+         *        lies in [@p iBegin, @p iEnd).
+         */
+        template <typename Callback>
+        void forEachPairInRange(
+            const size_t         iBegin,
+            const size_t         iEnd,
+            std::span<const Rep> x,
+            std::span<const Rep> y,
+            std::span<const Rep> z,
+            Callback&&           callback
+        ) const
+        {
+            assert(x.size() == y.size() && x.size() == z.size());
+
+            const auto cutoff2 = _cutoff * _cutoff;
+
+            for (size_t i = iBegin; i < iEnd; ++i)
+                for (size_t j = i + 1; j < x.size(); ++j)
+                {
+                    const auto [dx, dy, dz] = _box.minimumImage(
+                        x[i] - x[j],
+                        y[i] - y[j],
+                        z[i] - z[j]
+                    );
+
+                    const auto r2 = dx * dx + dy * dy + dz * dz;
+
+                    if (r2 < cutoff2)
+                        callback(i, j, dx, dy, dz, r2);
+                }
+        }
+
+        /**
+         * @brief Like forEachPair, restricted to chunk @p chunk of
+         *        @p nChunks.
+         *
+         * The rows are split so that every chunk holds about the same
+         * number of the \f$N(N-1)/2\f$ candidate pairs.
+         */
+        template <typename Callback>
+        void forEachPairInChunk(
+            const size_t         chunk,
+            const size_t         nChunks,
+            std::span<const Rep> x,
+            std::span<const Rep> y,
+            std::span<const Rep> z,
+            Callback&&           callback
+        ) const
+        {
+            assert(chunk < nChunks);
+
+            forEachPairInRange(
+                _chunkBegin(chunk, nChunks, x.size()),
+                _chunkBegin(chunk + 1, nChunks, x.size()),
+                x,
+                y,
+                z,
+                callback
+            );
+        }
+
+        /**
+         * @brief Returns the particles `[first, last)` that the pairs of
+         *        chunk @p chunk of @p nChunks can touch.
+         */
+        std::pair<size_t, size_t> chunkParticleRange(
+            const size_t chunk,
+            const size_t nChunks,
+            const size_t nParticles
+        ) const
+        {
+            const auto begin = _chunkBegin(chunk, nChunks, nParticles);
+            const auto end   = _chunkBegin(chunk + 1, nChunks, nParticles);
+
+            // the partners of a row are all later particles
+            return {begin, begin == end ? end : nParticles};
+        }
+
+        /// @brief Returns the periodic box.
+        const Box& box() const { return _box; }
+
+        /// @brief Returns the cutoff.
+        Rep cutoff() const { return _cutoff; }
+
+       private:
+        /// first row of a chunk; rows before i hold 1 - (1 - i/N)^2 of
+        /// all pairs
+        static size_t _chunkBegin(
+            const size_t chunk,
+            const size_t nChunks,
+            const size_t nParticles
+        )
+        {
+            if (chunk >= nChunks)
+                return nParticles;
+
+            const auto fraction =
+                static_cast<double>(chunk) / static_cast<double>(nChunks);
+            const auto row = static_cast<double>(nParticles) *
+                             (1.0 - std::sqrt(1.0 - fraction));
+
+            return std::min(static_cast<size_t>(row), nParticles);
+        }
+    };
+
+}   // namespace mstd
+
+#endif   // __MSTD__PHYSICS__ALL_PAIRS_HPP__
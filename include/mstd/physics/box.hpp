@@ -0,0 +1,385 @@
+/*****************************************************************************
+<GPL_HEADER>
+
+    mstd library
+    Copyright (C) 2025-now  Jakob Gamper
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+<GPL_HEADER>
+******************************************************************************/
+
+#ifndef __MSTD__PHYSICS__BOX_HPP__
+#define __MSTD__PHYSICS__BOX_HPP__
+
+#include <array>
+#include <cmath>
+#include <span>
+#include <stdexcept>
+
+#include "mstd/simd.hpp"
+#include "mstd/type_traits/physics_traits.hpp"
+
+namespace mstd
+{
+    /**
+     * @brief Orthorhombic periodic box.
+     *
+     * Minimum image and wrapping are branch-free roundings of the
+     * fractional coordinates and lane-generic, i.e. they accept scalars as
+     * well as `SimdVec<Rep>`.
+     *
+     * @tparam Rep numeric representation.
+     */
+    template <typename Rep = double>
+    class OrthorhombicBox
+    {
+       private:
+        std::array<Rep, 3> _lengths{};
+        std::array<Rep, 3> _invLengths{};
+
+       public:
+        using rep = Rep;
+
+        /**
+         * @brief Constructs the box from its edge lengths.
+         *
+         * @throws std::invalid_argument if any length is not positive.
+         */
+        OrthorhombicBox(const Rep lx, const Rep ly, const Rep lz)
+            : _lengths{lx, ly, lz}
+        {
+            for (size_t dim = 0; dim < 3; ++dim)
+            {
+                if (!(_lengths[dim] > 0))
+                    throw std::invalid_argument(
+                        "OrthorhombicBox requires positive lengths"
+                    );
+
+                _invLengths[dim] = 1 / _lengths[dim];
+            }
+        }
+
+        /// @brief Constructs the box from its edge lengths.
+        OrthorhombicBox(   // NOLINT(google-explicit-constructor)
+            const std::array<Rep, 3>& lengths
+        )
+            : OrthorhombicBox(lengths[0], lengths[1], lengths[2])
+        {
+        }
+
+        /**
+         * @brief Returns the minimum image of the displacement
+         *        (@p dx, @p dy, @p dz).
+         */
+        template <typename T = Rep>
+        std::array<T, 3> minimumImage(
+            const std::type_identity_t<T> dx,
+            const std::type_identity_t<T> dy,
+            const std::type_identity_t<T> dz
+        ) const
+        {
+            return {
+                dx - _broadcast<T>(0) * simdNearbyint(dx * _inverse<T>(0)),
+                dy - _broadcast<T>(1) * simdNearbyint(dy * _inverse<T>(1)),
+                dz - _broadcast<T>(2) * simdNearbyint(dz * _inverse<T>(2))
+            };
+        }
+
+        /// @brief Returns the position wrapped into \f$[0, L)\f$.
+        template <typename T = Rep>
+        std::array<T, 3> wrap(
+            const std::type_identity_t<T> x,
+            const std::type_identity_t<T> y,
+            const std::type_identity_t<T> z
+        ) const
+        {
+            return {
+                x - _broadcast<T>(0) * simdFloor(x * _inverse<T>(0)),
+                y - _broadcast<T>(1) * simdFloor(y * _inverse<T>(1)),
+                z - _broadcast<T>(2) * simdFloor(z * _inverse<T>(2))
+            };
+        }
+
+        /// @brief Returns the fractional coordinates wrapped into [0, 1).
+        template <typename T = Rep>
+        std::array<T, 3> fractional(
+            const std::type_identity_t<T> x,
+            const std::type_identity_t<T> y,
+            const std::type_identity_t<T> z
+        ) const
+        {
+            const auto sx = x * _inverse<T>(0);
+            const auto sy = y * _inverse<T>(1);
+            const auto sz = z * _inverse<T>(2);
+
+            return {sx - simdFloor(sx), sy - simdFloor(sy), sz - simdFloor(sz)};
+        }
+
+        /// @brief Replaces displacement arrays by their minimum images.
+        void minimumImageBatch(
+            std::span<Rep> dx,
+            std::span<Rep> dy,
+            std::span<Rep> dz
+        ) const
+        {
+            simdTransformInPlace(
+                dx,
+                dy,
+                dz,
+                [this]<typename T>(const T a, const T b, const T c)
+                { return minimumImage<T>(a, b, c); }
+            );
+        }
+
+        /// @brief Wraps position arrays into the box.
+        void wrapBatch(
+            std::span<Rep> x,
+            std::span<Rep> y,
+            std::span<Rep> z
+        ) const
+        {
+            simdTransformInPlace(
+                x,
+                y,
+                z,
+                [this]<typename T>(const T a, const T b, const T c)
+                { return wrap<T>(a, b, c); }
+            );
+        }
+
+        /// @brief Returns the edge lengths.
+        const std::array<Rep, 3>& lengths() const { return _lengths; }
+
+        /// @brief Returns the distances between opposite faces.
+        const std::array<Rep, 3>& perpendicularWidths() const
+        {
+            return _lengths;
+        }
+
+        /// @brief Returns the box volume.
+        Rep volume() const { return _lengths[0] * _lengths[1] * _lengths[2]; }
+
+       private:
+        template <typename T>
+        T _broadcast(const size_t dim) const
+        {
+            return simdBroadcast<T>(_lengths[dim]);
+        }
+
+        template <typename T>
+        T _inverse(const size_t dim) const
+        {
+            return simdBroadcast<T>(_invLengths[dim]);
+        }
+    };
+
+    /**
+     * @brief Triclinic periodic box.
+     *
+     * The box vectors follow the usual restricted triclinic convention
+     * \f$\vec{a} = (l_x, 0, 0)\f$, \f$\vec{b} = (xy, l_y, 0)\f$ and
+     * \f$\vec{c} = (xz, yz, l_z)\f$. The minimum image removes the
+     * \f$\vec{c}\f$, \f$\vec{b}\f$ and \f$\vec{a}\f$ components in turn by
+     * rounding, without branches. With the tilt factors limited to half of
+     * the corresponding length (checked in the constructor) this yields the
+     * minimum image for all distances below half the smallest perpendicular
+     * width, the regime cutoff based searches operate in.
+     *
+     * @tparam Rep numeric representation.
+     */
+    template <typename Rep = double>
+    class TriclinicBox
+    {
+       private:
+        Rep _lx;
+        Rep _ly;
+        Rep _lz;
+        Rep _xy;
+        Rep _xz;
+        Rep _yz;
+
+        Rep _invLx;
+        Rep _invLy;
+        Rep _invLz;
+
+       public:
+        using rep = Rep;
+
+        /**
+         * @brief Constructs the box from edge lengths and tilt factors.
+         *
+         * @throws std::invalid_argument if any length is not positive or a
+         *         tilt factor exceeds half of the corresponding length.
+         */
+        TriclinicBox(
+            const Rep lx,
+            const Rep ly,
+            const Rep lz,
+            const Rep xy,
+            const Rep xz,
+            const Rep yz
+        )
+            : _lx(lx), _ly(ly), _lz(lz), _xy(xy), _xz(xz), _yz(yz)
+        {
+            if (!(lx > 0 && ly > 0 && lz > 0))
+                throw std::invalid_argument(
+                    "TriclinicBox requires positive lengths"
+                );
+
+            if (!(2 * std::abs(xy) <= lx && 2 * std::abs(xz) <= lx &&
+                  2 * std::abs(yz) <= ly))
+                throw std::invalid_argument(
+                    "TriclinicBox requires |xy|, |xz| <= lx / 2 and "
+                    "|yz| <= ly / 2"
+                );
+
+            _invLx = 1 / lx;
+            _invLy = 1 / ly;
+            _invLz = 1 / lz;
+        }
+
+        /**
+         * @brief Returns the minimum image of the displacement
+         *        (@p dx, @p dy, @p dz).
+         */
+        template <typename T = Rep>
+        std::array<T, 3> minimumImage(
+            std::type_identity_t<T> dx,
+            std::type_identity_t<T> dy,
+            std::type_identity_t<T> dz
+        ) const
+        {
+            const auto nz  = simdNearbyint(dz * simdBroadcast<T>(_invLz));
+            dx            -= nz * simdBroadcast<T>(_xz);
+            dy            -= nz * simdBroadcast<T>(_yz);
+            dz            -= nz * simdBroadcast<T>(_lz);
+
+            const auto ny  = simdNearbyint(dy * simdBroadcast<T>(_invLy));
+            dx            -= ny * simdBroadcast<T>(_xy);
+            dy            -= ny * simdBroadcast<T>(_ly);
+
+            const auto nx  = simdNearbyint(dx * simdBroadcast<T>(_invLx));
+            dx            -= nx * simdBroadcast<T>(_lx);
+
+            return {dx, dy, dz};
+        }
+
+        /// @brief Returns the position wrapped into the box.
+        template <typename T = Rep>
+        std::array<T, 3> wrap(
+            std::type_identity_t<T> x,
+            std::type_identity_t<T> y,
+            std::type_identity_t<T> z
+        ) const
+        {
+            const auto nz  = simdFloor(z * simdBroadcast<T>(_invLz));
+            x             -= nz * simdBroadcast<T>(_xz);
+            y             -= nz * simdBroadcast<T>(_yz);
+            z             -= nz * simdBroadcast<T>(_lz);
+
+            const auto ny  = simdFloor(y * simdBroadcast<T>(_invLy));
+            x             -= ny * simdBroadcast<T>(_xy);
+            y             -= ny * simdBroadcast<T>(_ly);
+
+            const auto nx  = simdFloor(x * simdBroadcast<T>(_invLx));
+            x             -= nx * simdBroadcast<T>(_lx);
+
+            return {x, y, z};
+        }
+
+        /// @brief Returns the fractional coordinates wrapped into [0, 1).
+        template <typename T = Rep>
+        std::array<T, 3> fractional(
+            const std::type_identity_t<T> x,
+            const std::type_identity_t<T> y,
+            const std::type_identity_t<T> z
+        ) const
+        {
+            // inverse of the upper triangular box matrix
+            auto sz = z * simdBroadcast<T>(_invLz);
+            auto sy = (y - simdBroadcast<T>(_yz) * sz) *
+                      simdBroadcast<T>(_invLy);
+            auto sx = (x - simdBroadcast<T>(_xy) * sy -
+                       simdBroadcast<T>(_xz) * sz) *
+                      simdBroadcast<T>(_invLx);
+
+            return {sx - simdFloor(sx), sy - simdFloor(sy), sz - simdFloor(sz)};
+        }
+
+        /// @brief Replaces displacement arrays by their minimum images.
+        void minimumImageBatch(
+            std::span<Rep> dx,
+            std::span<Rep> dy,
+            std::span<Rep> dz
+        ) const
+        {
+            simdTransformInPlace(
+                dx,
+                dy,
+                dz,
+                [this]<typename T>(const T a, const T b, const T c)
+                { return minimumImage<T>(a, b, c); }
+            );
+        }
+
+        /// @brief Wraps position arrays into the box.
+        void wrapBatch(
+            std::span<Rep> x,
+            std::span<Rep> y,
+            std::span<Rep> z
+        ) const
+        {
+            simdTransformInPlace(
+                x,
+                y,
+                z,
+                [this]<typename T>(const T a, const T b, const T c)
+                { return wrap<T>(a, b, c); }
+            );
+        }
+
+        /// @brief Returns the edge lengths \f$(l_x, l_y, l_z)\f$.
+        std::array<Rep, 3> lengths() const { return {_lx, _ly, _lz}; }
+
+        /// @brief Returns the tilt factors \f$(xy, xz, yz)\f$.
+        std::array<Rep, 3> tilts() const { return {_xy, _xz, _yz}; }
+
+        /**
+         * @brief Returns the distances between opposite faces, i.e. the
+         *        volume divided by the area spanned by the other two box
+         *        vectors.
+         */
+        std::array<Rep, 3> perpendicularWidths() const
+        {
+            using std::sqrt;
+
+            // |b x c|, |c x a| and |a x b| for the triangular box matrix
+            const auto bc = sqrt(
+                _ly * _lz * _ly * _lz + _xy * _lz * _xy * _lz +
+                (_xy * _yz - _ly * _xz) * (_xy * _yz - _ly * _xz)
+            );
+            const auto ca = _lx * sqrt(_lz * _lz + _yz * _yz);
+            const auto ab = _lx * _ly;
+
+            return {volume() / bc, volume() / ca, volume() / ab};
+        }
+
+        /// @brief Returns the box volume.
+        Rep volume() const { return _lx * _ly * _lz; }
+    };
+
+}   // namespace mstd
+
+#endif   // __MSTD__PHYSICS__BOX_HPP__
@@ -0,0 +1,395 @@
+/*****************************************************************************
+<GPL_HEADER>
+
+    mstd library
+    Copyright (C) 2025-now  Jakob Gamper
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+<GPL_HEADER>
+******************************************************************************/
+
+#ifndef __MSTD__PHYSICS__CELL_LIST_HPP__
+#define __MSTD__PHYSICS__CELL_LIST_HPP__
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+#include "box.hpp"
+
+namespace mstd
+{
+    /**
+     * @brief Cell list for cutoff based pair search in periodic boxes.
+     *
+     * The box is divided in fractional coordinates into cells whose
+     * perpendicular widths are at least the cutoff, so all partners of a
+     * particle within the cutoff reside in its own or one of the 26
+     * surrounding cells. This holds for orthorhombic and triclinic boxes
+     * alike. build() bins the particles with a counting
+     * sort into a CSR layout (cell offsets plus particle indices). Pair
+     * enumeration costs O(N) at constant density.
+     *
+     * @tparam Rep numeric representation.
+     * @tparam Box periodic box type, see BoxType.
+     */
+    template <typename Rep = double, typename Box = OrthorhombicBox<Rep>>
+    class CellList
+    {
+       private:
+        Box                   _box;
+        std::array<size_t, 3> _nCells{};
+        Rep                   _cutoff{};
+
+        /// CSR offsets of the unique neighbour cells with a larger index
+        std::vector<size_t> _neighbourStart;
+        std::vector<size_t> _neighbourCells;
+
+        /// CSR offsets of the particles of each cell
+        std::vector<size_t> _cellStart;
+        std::vector<size_t> _particles;
+        std::vector<size_t> _cellOfParticle;
+
+       public:
+        using rep      = Rep;
+        using box_type = Box;
+
+        /**
+         * @brief Sets up the cell grid for a box and cutoff.
+         *
+         * @param box periodic box, e.g. the edge lengths of an orthorhombic
+         *        box.
+         * @param cutoff interaction cutoff, lower bound for the cell size.
+         *
+         * @throws std::invalid_argument if the cutoff is not positive or the
+         *         box is thinner than twice the cutoff in any direction, for
+         *         which the minimum image convention breaks down.
+         */
+        CellList(const Box& box, const Rep cutoff) : _box(box), _cutoff(cutoff)
+        {
+            if (!(cutoff > 0))
+                throw std::invalid_argument("CellList requires cutoff > 0");
+
+            const auto widths = _box.perpendicularWidths();
+
+            for (size_t dim = 0; dim < 3; ++dim)
+            {
+                if (!(widths[dim] >= 2 * cutoff))
+                    throw std::invalid_argument(
+                        "CellList requires box widths >= 2 * cutoff"
+                    );
+
+                _nCells[dim] = static_cast<size_t>(widths[dim] / cutoff);
+            }
+
+            _buildNeighbourCells();
+        }
+
+        /**
+         * @brief Bins all particles into cells using a counting sort.
+         *
+         * Coordinates outside the primary box are wrapped back.
+         *
+         * @pre `x`, `y` and `z` have the same size.
+         */
+        void build(
+            std::span<const Rep> x,
+            std::span<const Rep> y,
+            std::span<const Rep> z
+        )
+        {
+            assert(x.size() == y.size() && x.size() == z.size());
+
+            const size_t nParticles = x.size();
+
+            _cellOfParticle.resize(nParticles);
+            _cellStart.assign(nCells() + 1, 0);
+
+            for (size_t i = 0; i < nParticles; ++i)
+            {
+                const auto cell    = _cellIndex(x[i], y[i], z[i]);
+                _cellOfParticle[i] = cell;
+                ++_cellStart[cell + 1];
+            }
+
+            for (size_t cell = 0; cell < nCells(); ++cell)
+                _cellStart[cell + 1] += _cellStart[cell];
+
+            std::vector<size_t> fill(_cellStart.begin(), _cellStart.end() - 1);
+
+            _particles.resize(nParticles);
+
+            for (size_t i = 0; i < nParticles; ++i)
+                _particles[fill[_cellOfParticle[i]]++] = i;
+        }
+
+        /**
+         * @brief Calls @p callback once for every pair within the cutoff.
+         *
+         * The callback receives `(i, j, dx, dy, dz, r2)` where `i` and `j`
+         * are the particle indices, `(dx, dy, dz)` is the minimum image of
+         * \f$\vec{r}_i - \vec{r}_j\f$ and `r2` its squared length.
+         *
+         * @pre build() has been called with the same coordinates.
+         */
+        template <typename Callback>
+        void forEachPair(
+            std::span<const Rep> x,
+            std::span<const Rep> y,
+            std::span<const Rep> z,
+            Callback&&           callback
+        ) const
+        {
+            forEachPairInCells(0, nCells(), x, y, z, callback);
+        }
+
+        /**
+         * @brief Like forEachPair, restricted to pairs whose first cell lies
+         *        in [@p cellBegin, @p cellEnd).
+         *
+         * Splitting the cell range yields disjoint pair sets, which is what
+         * parallel pair kernels partition on.
+         */
+        template <typename Callback>
+        void forEachPairInCells(
+            const size_t         cellBegin,
+            const size_t         cellEnd,
+            std::span<const Rep> x,
+            std::span<const Rep> y,
+            std::span<const Rep> z,
+            Callback&&           callback
+        ) const
+        {
+            const auto cutoff2 = _cutoff * _cutoff;
+
+            for (size_t cell = cellBegin; cell < cellEnd; ++cell)
+            {
+                const auto begin = _cellStart[cell];
+                const auto end   = _cellStart[cell + 1];
+
+                for (auto a = begin; a < end; ++a)
+                {
+                    // pairs inside the cell
+                    for (auto b = a + 1; b < end; ++b)
+                        _visit(a, b, x, y, z, cutoff2, callback);
+
+                    // pairs with the half shell of neighbour cells
+                    for (auto n = _neighbourStart[cell];
+                         n < _neighbourStart[cell + 1];
+                         ++n)
+                    {
+                        const auto other = _neighbourCells[n];
+
+                        for (auto b = _cellStart[other];
+                             b < _cellStart[other + 1];
+                             ++b)
+                            _visit(a, b, x, y, z, cutoff2, callback);
+                    }
+                }
+            }
+        }
+
+        /**
+         * @brief Like forEachPair, restricted to chunk @p chunk of
+         *        @p nChunks.
+         *
+         * The cells are split so that every chunk holds about the same
+         * number of particles.
+         *
+         * @pre build() has been called with the same coordinates.
+         */
+        template <typename Callback>
+        void forEachPairInChunk(
+            const size_t         chunk,
+            const size_t         nChunks,
+            std::span<const Rep> x,
+            std::span<const Rep> y,
+            std::span<const Rep> z,
+            Callback&&           callback
+        ) const
+        {
+            assert(chunk < nChunks);
+
+            forEachPairInCells(
+                _chunkBegin(chunk, nChunks),
+                _chunkBegin(chunk + 1, nChunks),
+                x,
+                y,
+                z,
+                callback
+            );
+        }
+
+        /// @brief Returns the total number of cells.
+        size_t nCells() const { return _nCells[0] * _nCells[1] * _nCells[2]; }
+
+        /// @brief Returns the number of cells per direction.
+        const std::array<size_t, 3>& cellsPerDim() const { return _nCells; }
+
+        /// @brief Returns the periodic box.
+        const Box& box() const { return _box; }
+
+        /// @brief Returns the cutoff.
+        Rep cutoff() const { return _cutoff; }
+
+        /// @brief Returns the cell of particle @p i after the last build.
+        size_t cellOf(const size_t i) const { return _cellOfParticle[i]; }
+
+        /// @brief Returns the particle indices stored in @p cell.
+        std::span<const size_t> particlesInCell(const size_t cell) const
+        {
+            return std::span<const size_t>(_particles)
+                .subspan(
+                    _cellStart[cell],
+                    _cellStart[cell + 1] - _cellStart[cell]
+                );
+        }
+
+        /// @brief Returns the neighbour cells of @p cell with a larger index.
+        std::span<const size_t> neighbourCells(const size_t cell) const
+        {
+            return std::span<const size_t>(_neighbourCells)
+                .subspan(
+                    _neighbourStart[cell],
+                    _neighbourStart[cell + 1] - _neighbourStart[cell]
+                );
+        }
+
+       private:
+        /// first cell of a chunk, balanced by the particle count
+        size_t _chunkBegin(const size_t chunk, const size_t nChunks) const
+        {
+            if (chunk >= nChunks)
+                return nCells();
+
+            const auto target = _particles.size() * chunk / nChunks;
+            const auto it     = std::ranges::lower_bound(_cellStart, target);
+
+            return std::min(
+                static_cast<size_t>(it - _cellStart.begin()),
+                nCells()
+            );
+        }
+
+        size_t _flatten(const size_t ix, const size_t iy, const size_t iz) const
+        {
+            return (ix * _nCells[1] + iy) * _nCells[2] + iz;
+        }
+
+        size_t _cellIndexDim(const Rep frac, const size_t dim) const
+        {
+            const auto index = static_cast<size_t>(
+                frac * static_cast<Rep>(_nCells[dim])
+            );
+            return std::min(index, _nCells[dim] - 1);
+        }
+
+        size_t _cellIndex(const Rep x, const Rep y, const Rep z) const
+        {
+            const auto [sx, sy, sz] = _box.fractional(x, y, z);
+
+            return _flatten(
+                _cellIndexDim(sx, 0),
+                _cellIndexDim(sy, 1),
+                _cellIndexDim(sz, 2)
+            );
+        }
+
+        /**
+         * @brief Collects for every cell the unique cells of its 27 stencil
+         *        with a larger index.
+         *
+         * With fewer than three cells in a direction periodic images of the
+         * stencil coincide; deduplicating keeps every cell pair unique.
+         */
+        void _buildNeighbourCells()
+        {
+            _neighbourStart.assign(1, 0);
+            _neighbourCells.clear();
+
+            const auto wrap =
+                [](const size_t i, const int offset, const size_t n)
+            {
+                const auto shifted = static_cast<long long>(i) + offset;
+                const auto size    = static_cast<long long>(n);
+                return static_cast<size_t>(((shifted % size) + size) % size);
+            };
+
+            std::vector<size_t> stencil;
+
+            for (size_t ix = 0; ix < _nCells[0]; ++ix)
+                for (size_t iy = 0; iy < _nCells[1]; ++iy)
+                    for (size_t iz = 0; iz < _nCells[2]; ++iz)
+                    {
+                        const auto cell = _flatten(ix, iy, iz);
+                        stencil.clear();
+
+                        for (int dx = -1; dx <= 1; ++dx)
+                            for (int dy = -1; dy <= 1; ++dy)
+                                for (int dz = -1; dz <= 1; ++dz)
+                                {
+                                    const auto other = _flatten(
+                                        wrap(ix, dx, _nCells[0]),
+                                        wrap(iy, dy, _nCells[1]),
+                                        wrap(iz, dz, _nCells[2])
+                                    );
+
+                                    if (other > cell)
+                                        stencil.push_back(other);
+                                }
+
+                        std::ranges::sort(stencil);
+                        const auto last = std::ranges::unique(stencil);
+                        stencil.erase(last.begin(), last.end());
+
+                        _neighbourCells.insert(
+                            _neighbourCells.end(),
+                            stencil.begin(),
+                            stencil.end()
+                        );
+                        _neighbourStart.push_back(_neighbourCells.size());
+                    }
+        }
+
+        template <typename Callback>
+        void _visit(
+            const size_t         a,
+            const size_t         b,
+            std::span<const Rep> x,
+            std::span<const Rep> y,
+            std::span<const Rep> z,
+            const Rep            cutoff2,
+            Callback&            callback
+        ) const
+        {
+            const auto i = _particles[a];
+            const auto j = _particles[b];
+
+            const auto [dx, dy, dz] =
+                _box.minimumImage(x[i] - x[j], y[i] - y[j], z[i] - z[j]);
+
+            const auto r2 = dx * dx + dy * dy + dz * dz;
+
+            if (r2 < cutoff2)
+                callback(i, j, dx, dy, dz, r2);
+        }
+    };
+
+}   // namespace mstd
+
+#endif   // __MSTD__PHYSICS__CELL_LIST_HPP__
@@ -0,0 +1,224 @@
+/*****************************************************************************
+<GPL_HEADER>
+
+    mstd library
+    Copyright (C) 2025-now  Jakob Gamper
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+<GPL_HEADER>
+******************************************************************************/
+
+#ifndef __MSTD__PHYSICS__EWALD_HPP__
+#define __MSTD__PHYSICS__EWALD_HPP__
+
+#include <array>
+#include <cassert>
+#include <cmath>
+#include <concepts>
+#include <numbers>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+#include "box.hpp"
+#include "mstd/type_traits/physics_traits.hpp"
+
+namespace mstd
+{
+    namespace details
+    {
+        /**
+         * @brief inverse of the upper triangular box matrix whose columns
+         *        are the box vectors
+         *
+         * Row \f$\alpha\f$ of the result is the reciprocal box vector
+         * belonging to the fractional coordinate \f$\alpha\f$.
+         */
+        template <BoxType Box>
+        std::array<std::array<typename Box::rep, 3>, 3> inverseBoxMatrix(
+            const Box& box
+        )
+        {
+            using Rep = typename Box::rep;
+
+            const auto [lx, ly, lz] = box.lengths();
+
+            std::array<Rep, 3> tilts{};
+            if constexpr (requires { box.tilts(); })
+                tilts = box.tilts();
+
+            const auto [xy, xz, yz] = tilts;
+
+            return {{
+                {1 / lx, -xy / (lx * ly), (xy * yz - ly * xz) / (lx * ly * lz)},
+                {0, 1 / ly, -yz / (ly * lz)},
+                {0, 0, 1 / lz}
+            }};
+        }
+
+        /// @brief reciprocal vector \f$\sum_\alpha m_\alpha \vec{b}_\alpha\f$
+        template <typename Rep>
+        std::array<Rep, 3> reciprocalVector(
+            const std::array<std::array<Rep, 3>, 3>& inverse,
+            const Rep                                mx,
+            const Rep                                my,
+            const Rep                                mz
+        )
+        {
+            std::array<Rep, 3> k{};
+            for (size_t beta = 0; beta < 3; ++beta)
+                k[beta] = mx * inverse[0][beta] + my * inverse[1][beta] +
+                          mz * inverse[2][beta];
+            return k;
+        }
+
+    }   // namespace details
+
+    /**
+     * @brief Returns the Ewald splitting parameter \f$\alpha\f$ for which
+     *        \f$\mathrm{erfc}(\alpha r_c) = \f$ @p tolerance.
+     *
+     * The relative size of the real space interactions neglected beyond
+     * the cutoff is then about @p tolerance.
+     *
+     * @throws std::invalid_argument unless cutoff > 0 and
+     *         0 < tolerance < 1.
+     */
+    template <std::floating_point Rep>
+    Rep ewaldSplittingParameter(const Rep cutoff, const Rep tolerance)
+    {
+        if (!(cutoff > 0 && tolerance > 0 && tolerance < 1))
+            throw std::invalid_argument(
+                "ewaldSplittingParameter requires cutoff > 0 and "
+                "0 < tolerance < 1"
+            );
+
+        // erfc is monotonic, bisect alpha * cutoff in [0, 30]
+        Rep low  = 0;
+        Rep high = 30;
+        for (int it = 0; it < 100; ++it)
+        {
+            const auto mid = (low + high) / 2;
+            if (std::erfc(mid) > tolerance)
+                low = mid;
+            else
+                high = mid;
+        }
+
+        return (low + high) / 2 / cutoff;
+    }
+
+    /**
+     * @brief Reciprocal space part of the Ewald sum evaluated directly
+     *        over all wave vectors \f$|m_\alpha| \le k_{max}\f$.
+     *
+     * \f$E = \frac{c}{2 \pi V} \sum_{m \neq 0} \frac{e^{-\pi^2 k^2 /
+     * \alpha^2}}{k^2} |S(m)|^2\f$ with the structure factor
+     * \f$S(m) = \sum_j q_j e^{2 \pi i \vec{k} \cdot \vec{r}_j}\f$ and the
+     * reciprocal vector \f$\vec{k}\f$ of \f$m\f$. The cost is
+     * \f$O(N k_{max}^3)\f$, so this serves as accuracy reference for
+     * SmoothParticleMeshEwald.
+     *
+     * @pre all spans have the same size.
+     *
+     * @param box periodic box.
+     * @param coeff electrostatic prefactor.
+     * @param alpha splitting parameter.
+     * @param kMax largest wave vector index per dimension.
+     * @param x, y, z particle coordinates.
+     * @param charges particle charges.
+     * @param fx, fy, fz forces, incremented by the reciprocal forces.
+     * @return the reciprocal space energy.
+     */
+    template <BoxType Box>
+    typename Box::rep computeEwaldReciprocal(
+        const Box&                         box,
+        const typename Box::rep            coeff,
+        const typename Box::rep            alpha,
+        const int                          kMax,
+        std::span<const typename Box::rep> x,
+        std::span<const typename Box::rep> y,
+        std::span<const typename Box::rep> z,
+        std::span<const typename Box::rep> charges,
+        std::span<typename Box::rep>       fx,
+        std::span<typename Box::rep>       fy,
+        std::span<typename Box::rep>       fz
+    )
+    {
+        using Rep = typename Box::rep;
+
+        assert(x.size() == y.size() && x.size() == z.size());
+        assert(charges.size() == x.size() && fx.size() == x.size());
+        assert(fy.size() == x.size() && fz.size() == x.size());
+
+        constexpr auto pi = std::numbers::pi_v<Rep>;
+
+        const auto inverse = details::inverseBoxMatrix(box);
+        const auto volume  = box.volume();
+        const auto n       = x.size();
+
+        std::vector<Rep> cosines(n), sines(n);
+
+        Rep energy{};
+
+        // half of the wave vectors, the other half is the complex conjugate
+        for (int mx = 0; mx <= kMax; ++mx)
+            for (int my = mx == 0 ? 0 : -kMax; my <= kMax; ++my)
+                for (int mz = mx == 0 && my == 0 ? 1 : -kMax; mz <= kMax; ++mz)
+                {
+                    const auto k = details::reciprocalVector(
+                        inverse,
+                        static_cast<Rep>(mx),
+                        static_cast<Rep>(my),
+                        static_cast<Rep>(mz)
+                    );
+
+                    const auto k2 = k[0] * k[0] + k[1] * k[1] + k[2] * k[2];
+                    const auto f =
+                        std::exp(-pi * pi * k2 / (alpha * alpha)) / k2;
+
+                    Rep re{}, im{};
+                    for (size_t j = 0; j < n; ++j)
+                    {
+                        const auto phase =
+                            2 * pi * (k[0] * x[j] + k[1] * y[j] + k[2] * z[j]);
+
+                        cosines[j]  = std::cos(phase);
+                        sines[j]    = std::sin(phase);
+                        re         += charges[j] * cosines[j];
+                        im         += charges[j] * sines[j];
+                    }
+
+                    energy += f * (re * re + im * im);
+
+                    // Im(conj(S) e^{i phase_j}) for both halves
+                    const auto scale = 4 * coeff * f / volume;
+                    for (size_t j = 0; j < n; ++j)
+                    {
+                        const auto g = scale * charges[j] *
+                                       (re * sines[j] - im * cosines[j]);
+
+                        fx[j] += g * k[0];
+                        fy[j] += g * k[1];
+                        fz[j] += g * k[2];
+                    }
+                }
+
+        return coeff * energy / (pi * volume);
+    }
+
+}   // namespace mstd
+
+#endif   // __MSTD__PHYSICS__EWALD_HPP__
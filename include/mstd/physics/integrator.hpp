@@ -0,0 +1,349 @@
+/*****************************************************************************
+<GPL_HEADER>
+
+    mstd library
+    Copyright (C) 2025-now  Jakob Gamper
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+<GPL_HEADER>
+******************************************************************************/
+
+#ifndef __MSTD__PHYSICS__INTEGRATOR_HPP__
+#define __MSTD__PHYSICS__INTEGRATOR_HPP__
+
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <span>
+#include <stdexcept>
+
+#include "mstd/simd.hpp"
+#include "mstd/type_traits/physics_traits.hpp"
+#include "pair_forces.hpp"
+#include "particles.hpp"
+
+namespace mstd
+{
+    /**
+     * @brief Force provider evaluating a pair potential over a pair source.
+     *
+     * Before every evaluation the source is brought up to date with the
+     * positions: a VerletList is updated (and only rebuilt when needed), a
+     * CellList is rebuilt and AllPairs needs nothing. The forces are then
+     * computed by computePairForces.
+     *
+     * Both the source and the potential are held by reference and must
+     * outlive the provider.
+     *
+     * @tparam Source pair source, e.g. VerletList.
+     * @tparam Potential pair potential, e.g. LieShiftedPotential.
+     * @tparam Path scalar or SIMD pair evaluation.
+     */
+    template <
+        PairSourceType          Source,
+        PairKernelPotentialType Potential,
+        PairKernelPath          Path = PairKernelPath::Simd>
+    class PairForceProvider
+    {
+       private:
+        Source&          _source;
+        const Potential& _potential;
+
+       public:
+        using rep = typename Source::rep;
+
+        PairForceProvider(Source& source, const Potential& potential)
+            : _source(source), _potential(potential)
+        {
+        }
+
+        /**
+         * @brief Updates the source and computes the forces.
+         *
+         * @return the total potential energy.
+         */
+        rep operator()(
+            std::span<const rep> x,
+            std::span<const rep> y,
+            std::span<const rep> z,
+            std::span<rep>       fx,
+            std::span<rep>       fy,
+            std::span<rep>       fz
+        )
+        {
+            if constexpr (requires { _source.update(x, y, z); })
+                _source.update(x, y, z);
+            else if constexpr (requires { _source.build(x, y, z); })
+                _source.build(x, y, z);
+
+            return computePairForces<Path>(
+                _source,
+                _potential,
+                x,
+                y,
+                z,
+                fx,
+                fy,
+                fz
+            );
+        }
+    };
+
+    namespace details
+    {
+        /**
+         * @brief kicks the velocities by `kick * f / m` and, if @p Drift,
+         *        drifts the positions by `drift * v` afterwards
+         *
+         * All three dimensions are handled in one pass, so the inverse
+         * masses are loaded once per particle and every array is streamed
+         * exactly once.
+         */
+        template <bool Drift, std::floating_point Rep>
+        void kickDrift(
+            ParticleArrays<Rep>& particles,
+            const Rep            kick,
+            const Rep            drift
+        )
+        {
+            using V                = SimdVec<Rep>;
+            constexpr size_t width = simd_size_v<V>;
+
+            const size_t n       = particles.size();
+            const size_t vectors = n - n % width;
+
+            const Rep* invMass = particles.inverseMasses().data();
+
+            const std::array positions{
+                particles.x.data(),
+                particles.y.data(),
+                particles.z.data()
+            };
+            const std::array velocities{
+                particles.vx.data(),
+                particles.vy.data(),
+                particles.vz.data()
+            };
+            const std::array forces{
+                particles.fx.data(),
+                particles.fy.data(),
+                particles.fz.data()
+            };
+
+            const auto kickV  = simdBroadcast<V>(kick);
+            const auto driftV = simdBroadcast<V>(drift);
+
+            for (size_t i = 0; i < vectors; i += width)
+            {
+                const auto scale = kickV * simdLoad<V>(invMass + i);
+
+                for (size_t dim = 0; dim < 3; ++dim)
+                {
+                    const auto f = simdLoad<V>(forces[dim] + i);
+                    const auto v = simdLoad<V>(velocities[dim] + i) +
+                                   scale * f;
+
+                    simdStore(velocities[dim] + i, v);
+
+                    if constexpr (Drift)
+                    {
+                        const auto r = simdLoad<V>(positions[dim] + i);
+                        simdStore(positions[dim] + i, r + driftV * v);
+                    }
+                }
+            }
+
+            for (size_t i = vectors; i < n; ++i)
+            {
+                const Rep scale = kick * invMass[i];
+
+                for (size_t dim = 0; dim < 3; ++dim)
+                {
+                    velocities[dim][i] += scale * forces[dim][i];
+
+                    if constexpr (Drift)
+                        positions[dim][i] += drift * velocities[dim][i];
+                }
+            }
+        }
+
+        /**
+         * @brief evaluates @p forces at the current positions of
+         *        @p particles
+         */
+        template <std::floating_point Rep, typename F>
+        Rep evaluateForces(ParticleArrays<Rep>& particles, F& forces)
+        {
+            return forces(
+                std::span<const Rep>(particles.x),
+                std::span<const Rep>(particles.y),
+                std::span<const Rep>(particles.z),
+                std::span<Rep>(particles.fx),
+                std::span<Rep>(particles.fy),
+                std::span<Rep>(particles.fz)
+            );
+        }
+
+        /// @brief throws unless the time step is positive
+        template <std::floating_point Rep>
+        Rep checkedTimeStep(const Rep dt, const char* message)
+        {
+            if (!(dt > 0))
+                throw std::invalid_argument(message);
+
+            return dt;
+        }
+
+    }   // namespace details
+
+    /**
+     * @brief Velocity Verlet integrator.
+     *
+     * One step performs a half kick of the velocities, a drift of the
+     * positions, a force evaluation and a second half kick, so positions,
+     * velocities and forces refer to the same time after every step. The
+     * first half kick and the drift are fused into one pass over the
+     * particle arrays.
+     *
+     * Positions are not wrapped into the box; the pair sources wrap on
+     * their own.
+     *
+     * @tparam Rep floating point representation.
+     */
+    template <std::floating_point Rep = double>
+    class VelocityVerlet
+    {
+       private:
+        Rep _dt;
+
+       public:
+        using rep = Rep;
+
+        /**
+         * @brief Creates an integrator with time step @p dt.
+         *
+         * @throws std::invalid_argument unless dt > 0.
+         */
+        explicit VelocityVerlet(const Rep dt)
+            : _dt(details::checkedTimeStep(
+                  dt,
+                  "VelocityVerlet requires dt > 0"
+              ))
+        {
+        }
+
+        /// @brief Returns the time step.
+        Rep timeStep() const { return _dt; }
+
+        /**
+         * @brief Computes the initial forces.
+         *
+         * Must be called once before the first step and whenever positions
+         * or the force provider changed outside the integrator.
+         *
+         * @return the potential energy.
+         */
+        template <ForceProviderType<Rep> F>
+        Rep setup(ParticleArrays<Rep>& particles, F&& forces) const
+        {
+            return details::evaluateForces(particles, forces);
+        }
+
+        /**
+         * @brief Advances @p particles by one time step.
+         *
+         * @pre the forces belong to the current positions, see setup().
+         * @return the potential energy at the new positions.
+         */
+        template <ForceProviderType<Rep> F>
+        Rep step(ParticleArrays<Rep>& particles, F&& forces) const
+        {
+            details::kickDrift<true>(particles, _dt / 2, _dt);
+
+            const Rep energy = details::evaluateForces(particles, forces);
+
+            details::kickDrift<false>(particles, _dt / 2, Rep{0});
+
+            return energy;
+        }
+    };
+
+    /**
+     * @brief Leapfrog integrator.
+     *
+     * Velocities live at half time steps: after setup() they refer to
+     * `t - dt / 2`, after every step to the midpoint of the last drift. A
+     * step kicks the velocities by a full time step, drifts the positions
+     * and evaluates the new forces. Trajectories agree with VelocityVerlet,
+     * with a single pass over the arrays instead of two.
+     *
+     * @tparam Rep floating point representation.
+     */
+    template <std::floating_point Rep = double>
+    class Leapfrog
+    {
+       private:
+        Rep _dt;
+
+       public:
+        using rep = Rep;
+
+        /**
+         * @brief Creates an integrator with time step @p dt.
+         *
+         * @throws std::invalid_argument unless dt > 0.
+         */
+        explicit Leapfrog(const Rep dt)
+            : _dt(details::checkedTimeStep(dt, "Leapfrog requires dt > 0"))
+        {
+        }
+
+        /// @brief Returns the time step.
+        Rep timeStep() const { return _dt; }
+
+        /**
+         * @brief Computes the initial forces and shifts the velocities from
+         *        `t` back to `t - dt / 2`.
+         *
+         * @return the potential energy.
+         */
+        template <ForceProviderType<Rep> F>
+        Rep setup(ParticleArrays<Rep>& particles, F&& forces) const
+        {
+            const Rep energy = details::evaluateForces(particles, forces);
+
+            details::kickDrift<false>(particles, -_dt / 2, Rep{0});
+
+            return energy;
+        }
+
+        /**
+         * @brief Advances @p particles by one time step.
+         *
+         * @pre the forces belong to the current positions, see setup().
+         * @return the potential energy at the new positions.
+         */
+        template <ForceProviderType<Rep> F>
+        Rep step(ParticleArrays<Rep>& particles, F&& forces) const
+        {
+            details::kickDrift<true>(particles, _dt, _dt);
+
+            return details::evaluateForces(particles, forces);
+        }
+    };
+
+}   // namespace mstd
+
+#endif   // __MSTD__PHYSICS__INTEGRATOR_HPP__
@@ -0,0 +1,496 @@
+/*****************************************************************************
+<GPL_HEADER>
+
+    mstd library
+    Copyright (C) 2025-now  Jakob Gamper
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+<GPL_HEADER>
+******************************************************************************/
+
+#ifndef __MSTD__PHYSICS__IO__COMPRESSED_TRAJECTORY_CODEC_HPP__
+#define __MSTD__PHYSICS__IO__COMPRESSED_TRAJECTORY_CODEC_HPP__
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+#include "mstd/memory.hpp"
+#include "trajectory_format.hpp"
+
+namespace mstd
+{
+    namespace details
+    {
+        /// @brief Maps signed to unsigned integers, small magnitudes first.
+        constexpr std::uint64_t zigzagEncode(const std::int64_t value)
+        {
+            return (static_cast<std::uint64_t>(value) << 1) ^
+                   static_cast<std::uint64_t>(value >> 63);
+        }
+
+        /// @brief Inverse of zigzagEncode.
+        constexpr std::int64_t zigzagDecode(const std::uint64_t value)
+        {
+            return static_cast<std::int64_t>(value >> 1) ^
+                   -static_cast<std::int64_t>(value & 1);
+        }
+
+        /**
+         * @brief Packs @p count values of @p width bits into consecutive 64
+         *        bit words, least significant bits first.
+         *
+         * @pre every value has at most @p width bits and @p words holds
+         *      `count * width / 64 + 1` words.
+         * @return number of words used.
+         */
+        inline size_t packBits(
+            const std::uint64_t* values,
+            const size_t         count,
+            const unsigned       width,
+            std::uint64_t*       words
+        )
+        {
+            if (width == 0)
+                return 0;
+
+            if (width == 64)
+            {
+                std::memcpy(words, values, count * sizeof(std::uint64_t));
+                return count;
+            }
+
+            std::uint64_t word = 0;
+            unsigned      fill = 0;
+            size_t        next = 0;
+
+            // branchless, the spill pattern of odd widths is unpredictable
+            for (size_t k = 0; k < count; ++k)
+            {
+                const auto value = values[k];
+                const auto end   = fill + width;
+                const bool spill = end >= 64;
+
+                word        |= value << fill;
+                words[next]  = word;
+
+                // bits above the full word, 63 - fill avoids a shift by 64
+                word  = spill ? (value >> 1) >> (63 - fill) : word;
+                next += spill ? 1 : 0;
+                fill  = end & 63;
+            }
+
+            words[next] = word;
+
+            return (count * width + 63) / 64;
+        }
+
+        /**
+         * @brief Reads back @p count values packed by packBits.
+         *
+         * @pre @p words holds one readable word past the packed ones.
+         */
+        inline void unpackBits(
+            const std::uint64_t* words,
+            const size_t         count,
+            const unsigned       width,
+            std::uint64_t*       values
+        )
+        {
+            if (width == 0)
+            {
+                std::fill_n(values, count, std::uint64_t{0});
+                return;
+            }
+
+            if (width == 64)
+            {
+                std::memcpy(values, words, count * sizeof(std::uint64_t));
+                return;
+            }
+
+            const auto mask = (std::uint64_t{1} << width) - 1;
+
+            for (size_t k = 0; k < count; ++k)
+            {
+                const auto bit   = k * width;
+                const auto index = bit / 64;
+                const auto shift = bit % 64;
+
+                const auto low  = words[index] >> shift;
+                const auto high = (words[index + 1] << 1) << (63 - shift);
+
+                values[k] = (low | high) & mask;
+            }
+        }
+
+    }   // namespace details
+
+    /**
+     * @brief Frame codec quantizing coordinates to a fixed precision and
+     *        packing their deltas.
+     *
+     * Every coordinate is rounded to an integer multiple of the precision,
+     * so the decoded value is within half a precision of the original and
+     * quantization errors never accumulate over frames. The integers are
+     * coded in blocks of 128 particles. Each block takes whichever residual
+     * is smaller: the difference to the previous particle of the frame
+     * (spatially sorted systems) or to the same particle in the previous
+     * frame (any order). The residuals are zigzag mapped and packed with the
+     * bit width of the largest one in the block, behind a one byte block
+     * header holding the width and the mode. The code length so adapts to
+     * the local magnitude distribution at a few instructions per value.
+     *
+     * Frames have to be decoded in the order they were encoded. The
+     * precision is stored in every frame, so a reader can use a default
+     * constructed codec.
+     *
+     * @tparam Rep numeric representation.
+     */
+    template <typename Rep = double>
+    class CompressedTrajectoryCodec
+    {
+       private:
+        static constexpr size_t _blockSize = 128;
+
+        /// top bit of a block header: delta to the previous frame
+        static constexpr std::uint8_t _temporal = 0x80;
+
+        /// largest quantized magnitude the rounding in _quantize supports
+        static constexpr double _maxQuantized = 0x1p51;
+
+        /// widest residual: deltas of values below 2^51 zigzag below 2^53
+        static constexpr unsigned _maxWidth = 53;
+
+        Rep _precision;
+
+        std::array<AlignedVector<std::int64_t>, 3> _previous;
+        bool                                       _hasPrevious = false;
+
+       public:
+        static constexpr std::uint32_t id = 1;
+
+        /// @brief Codes coordinates to 1e-3 coordinate units.
+        CompressedTrajectoryCodec() : CompressedTrajectoryCodec(Rep(1e-3)) {}
+
+        /**
+         * @brief Codes coordinates to @p precision, in the same length unit
+         *        as the coordinates.
+         *
+         * Coordinates must stay below 2^51 precisions in magnitude.
+         *
+         * @throws std::invalid_argument unless precision > 0.
+         */
+        explicit CompressedTrajectoryCodec(const Rep precision)
+            : _precision(precision)
+        {
+            if (!(precision > 0))
+                throw std::invalid_argument(
+                    "CompressedTrajectoryCodec requires precision > 0"
+                );
+        }
+
+        /**
+         * @brief Codes coordinates given in @p CoordinateUnit to the
+         *        length @p precision, e.g. `Length<literals::pm>{1.0}` for
+         *        coordinates in nm.
+         *
+         * @tparam CoordinateUnit length unit of the coordinates.
+         */
+        template <typename CoordinateUnit, typename Quantity>
+        static CompressedTrajectoryCodec withPrecision(
+            const Quantity& precision
+        )
+        {
+            return CompressedTrajectoryCodec(
+                static_cast<Rep>(to<CoordinateUnit>(precision).value())
+            );
+        }
+
+        /**
+         * @brief Returns the largest payload of a frame of @p nParticles:
+         *        every block 64 bits wide.
+         */
+        static constexpr size_t maxPayloadBytes(const size_t nParticles)
+        {
+            const auto nBlocks = (nParticles + _blockSize - 1) / _blockSize;
+
+            return sizeof(Rep) +
+                   3 * (nBlocks + nParticles * sizeof(std::uint64_t));
+        }
+
+        /// @brief Returns the precision in coordinate units.
+        Rep precision() const { return _precision; }
+
+        /**
+         * @brief Appends the coded coordinates of one frame to @p out.
+         *
+         * @throws std::invalid_argument if a coordinate is not finite or
+         *         exceeds 2^51 precisions. @p out is left unchanged and the
+         *         next frame is coded without the previous one.
+         */
+        void encode(
+            std::span<const Rep>    x,
+            std::span<const Rep>    y,
+            std::span<const Rep>    z,
+            std::vector<std::byte>& out
+        )
+        {
+            assert(y.size() == x.size() && z.size() == x.size());
+
+            const auto size = out.size();
+
+            try
+            {
+                details::appendBytes(out, _precision);
+
+                _encodeCoordinate(x, _previous[0], out);
+                _encodeCoordinate(y, _previous[1], out);
+                _encodeCoordinate(z, _previous[2], out);
+            }
+            catch (...)
+            {
+                // _previous is partly overwritten, the decoder never sees it
+                out.resize(size);
+                _hasPrevious = false;
+                throw;
+            }
+
+            _hasPrevious = true;
+        }
+
+        /**
+         * @brief Restores the coordinates of one frame from @p in.
+         *
+         * @throws std::runtime_error if @p in is no valid frame.
+         */
+        void decode(
+            std::span<const std::byte> in,
+            std::span<Rep>             x,
+            std::span<Rep>             y,
+            std::span<Rep>             z
+        )
+        {
+            assert(y.size() == x.size() && z.size() == x.size());
+
+            if (in.size() < sizeof(Rep))
+                _corruptFrame();
+
+            size_t offset = 0;
+            _precision    = details::readBytes<Rep>(in, offset);
+
+            _decodeCoordinate(in, offset, x, _previous[0]);
+            _decodeCoordinate(in, offset, y, _previous[1]);
+            _decodeCoordinate(in, offset, z, _previous[2]);
+
+            _hasPrevious = true;
+        }
+
+       private:
+        /**
+         * rounds @p count values of @p values to multiples of the precision
+         *
+         * Adding 1.5 * 2^52 leaves the rounded integer in the low mantissa
+         * bits, which is branch free and vectorizes without SSE4.1.
+         */
+        void _quantize(
+            const Rep*    values,
+            const size_t  count,
+            std::int64_t* quantized
+        ) const
+        {
+            constexpr double magic     = 0x1.8p52;
+            constexpr auto   magicBits = std::bit_cast<std::int64_t>(magic);
+
+            const double inverse = 1 / double{_precision};
+
+            // false for NaN as well, checked once per block
+            bool inRange = true;
+
+            for (size_t k = 0; k < count; ++k)
+            {
+                const double value  = values[k];
+                const double scaled = value * inverse;
+
+                inRange      &= std::abs(scaled) < _maxQuantized;
+                quantized[k]  =
+                    std::bit_cast<std::int64_t>(scaled + magic) - magicBits;
+            }
+
+            if (!inRange)
+                throw std::invalid_argument(
+                    "CompressedTrajectoryCodec: coordinate is not finite or "
+                    "too large for the precision"
+                );
+        }
+
+        void _encodeCoordinate(
+            std::span<const Rep>         values,
+            AlignedVector<std::int64_t>& previous,
+            std::vector<std::byte>&      out
+        )
+        {
+            const auto n = values.size();
+
+            if (!_hasPrevious)
+                previous.resize(n);
+
+            assert(previous.size() == n);
+
+            std::array<std::int64_t, _blockSize>      quantized;
+            std::array<std::uint64_t, _blockSize>     spatial;
+            std::array<std::uint64_t, _blockSize>     temporal;
+            std::array<std::uint64_t, _blockSize + 1> words;
+
+            std::int64_t last = 0;
+
+            for (size_t begin = 0; begin < n; begin += _blockSize)
+            {
+                const auto count = std::min(_blockSize, n - begin);
+
+                _quantize(values.data() + begin, count, quantized.data());
+
+                std::uint64_t spatialBits  = 0;
+                std::uint64_t temporalBits = 0;
+
+                for (size_t k = 0; k < count; ++k)
+                {
+                    const auto q   = quantized[k];
+                    auto&      old = previous[begin + k];
+
+                    spatial[k]    = details::zigzagEncode(q - last);
+                    temporal[k]   = details::zigzagEncode(q - old);
+                    spatialBits  |= spatial[k];
+                    temporalBits |= temporal[k];
+
+                    last = q;
+                    old  = q;
+                }
+
+                const auto useTemporal =
+                    _hasPrevious && temporalBits < spatialBits;
+
+                const auto width = static_cast<unsigned>(std::bit_width(
+                    useTemporal ? temporalBits : spatialBits
+                ));
+
+                assert(width <= _maxWidth);
+
+                const auto nWords = details::packBits(
+                    useTemporal ? temporal.data() : spatial.data(),
+                    count,
+                    width,
+                    words.data()
+                );
+
+                const auto offset = out.size();
+                const auto bytes  = nWords * sizeof(std::uint64_t);
+
+                out.resize(offset + 1 + bytes);
+                out[offset] = std::byte{static_cast<std::uint8_t>(
+                    width | (useTemporal ? _temporal : 0U)
+                )};
+                std::memcpy(out.data() + offset + 1, words.data(), bytes);
+            }
+        }
+
+        void _decodeCoordinate(
+            std::span<const std::byte>   in,
+            size_t&                      offset,
+            std::span<Rep>               values,
+            AlignedVector<std::int64_t>& previous
+        )
+        {
+            const auto n = values.size();
+
+            if (!_hasPrevious)
+                previous.resize(n);
+
+            assert(previous.size() == n);
+
+            std::array<std::uint64_t, _blockSize + 1> words;
+            std::array<std::uint64_t, _blockSize>     residuals;
+
+            std::int64_t last = 0;
+
+            for (size_t begin = 0; begin < n; begin += _blockSize)
+            {
+                const auto count = std::min(_blockSize, n - begin);
+
+                if (offset >= in.size())
+                    _corruptFrame();
+
+                const auto header =
+                    std::to_integer<std::uint8_t>(in[offset++]);
+                const auto     temporal = (header & _temporal) != 0;
+                const unsigned width    = header & (_temporal - 1U);
+
+                if (width > _maxWidth || (temporal && !_hasPrevious))
+                    _corruptFrame();
+
+                const auto bytes =
+                    (count * width + 63) / 64 * sizeof(std::uint64_t);
+
+                if (bytes > in.size() - offset)
+                    _corruptFrame();
+
+                std::memcpy(words.data(), in.data() + offset, bytes);
+                words[bytes / sizeof(std::uint64_t)] = 0;
+                offset += bytes;
+
+                details::unpackBits(
+                    words.data(),
+                    count,
+                    width,
+                    residuals.data()
+                );
+
+                for (size_t k = 0; k < count; ++k)
+                {
+                    auto&      old      = previous[begin + k];
+                    const auto residual = details::zigzagDecode(residuals[k]);
+
+                    // wraps instead of overflowing on corrupt residuals
+                    const auto q = static_cast<std::int64_t>(
+                        static_cast<std::uint64_t>(temporal ? old : last) +
+                        static_cast<std::uint64_t>(residual)
+                    );
+
+                    last              = q;
+                    old               = q;
+                    values[begin + k] = static_cast<Rep>(q) * _precision;
+                }
+            }
+        }
+
+        [[noreturn]] static void _corruptFrame()
+        {
+            throw std::runtime_error(
+                "CompressedTrajectoryCodec: corrupt frame"
+            );
+        }
+    };
+
+}   // namespace mstd
+
+#endif   // __MSTD__PHYSICS__IO__COMPRESSED_TRAJECTORY_CODEC_HPP__
@@ -0,0 +1,167 @@
+/*****************************************************************************
+<GPL_HEADER>
+
+    mstd library
+    Copyright (C) 2025-now  Jakob Gamper
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+<GPL_HEADER>
+******************************************************************************/
+
+#ifndef __MSTD__PHYSICS__IO__TRAJECTORY_FORMAT_HPP__
+#define __MSTD__PHYSICS__IO__TRAJECTORY_FORMAT_HPP__
+
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+namespace mstd
+{
+    /**
+     * @brief Layout of the binary trajectory files.
+     *
+     * A file starts with a 24 byte header: the magic bytes, the format
+     * version, the id of the frame codec and the number of particles. Each
+     * frame follows as its step, the size of the payload in bytes and the
+     * payload produced by the codec. All integers are stored in host byte
+     * order.
+     */
+    namespace trajectory_format
+    {
+        inline constexpr std::array<char, 8> magic{
+            'M', 'S', 'T', 'D', 'T', 'R', 'J', '\0'
+        };
+
+        inline constexpr std::uint32_t version = 1;
+
+        /// bytes of the file header
+        inline constexpr size_t headerBytes = 24;
+
+        /// bytes in front of every frame payload
+        inline constexpr size_t frameHeaderBytes = 16;
+
+    }   // namespace trajectory_format
+
+    namespace details
+    {
+        /// @brief Appends the object representation of @p value to @p out.
+        template <typename T>
+        requires std::is_trivially_copyable_v<T>
+        void appendBytes(std::vector<std::byte>& out, const T& value)
+        {
+            const auto size = out.size();
+            out.resize(size + sizeof(T));
+            std::memcpy(out.data() + size, &value, sizeof(T));
+        }
+
+        /**
+         * @brief Reads a @p T at @p offset of @p in and advances @p offset.
+         *
+         * @throws std::runtime_error if @p in ends before the @p T.
+         */
+        template <typename T>
+        requires std::is_trivially_copyable_v<T>
+        T readBytes(std::span<const std::byte> in, size_t& offset)
+        {
+            if (offset > in.size() || in.size() - offset < sizeof(T))
+                throw std::runtime_error("trajectory data ends unexpectedly");
+
+            T value;
+            std::memcpy(&value, in.data() + offset, sizeof(T));
+            offset += sizeof(T);
+
+            return value;
+        }
+
+    }   // namespace details
+
+    /**
+     * @brief Frame codec storing the coordinates unchanged.
+     *
+     * The payload holds the x, y and z arrays one after another in full
+     * precision.
+     *
+     * @tparam Rep numeric representation.
+     */
+    template <typename Rep = double>
+    class RawTrajectoryCodec
+    {
+       public:
+        static constexpr std::uint32_t id = 0;
+
+        /// @brief Returns the payload size of a frame of @p nParticles.
+        static constexpr size_t maxPayloadBytes(const size_t nParticles)
+        {
+            return 3 * nParticles * sizeof(Rep);
+        }
+
+        /// @brief Appends the coordinates of one frame to @p out.
+        void encode(
+            std::span<const Rep>    x,
+            std::span<const Rep>    y,
+            std::span<const Rep>    z,
+            std::vector<std::byte>& out
+        ) const
+        {
+            assert(y.size() == x.size() && z.size() == x.size());
+
+            const auto bytes = x.size() * sizeof(Rep);
+            const auto size  = out.size();
+
+            out.resize(size + 3 * bytes);
+
+            std::memcpy(out.data() + size, x.data(), bytes);
+            std::memcpy(out.data() + size + bytes, y.data(), bytes);
+            std::memcpy(out.data() + size + 2 * bytes, z.data(), bytes);
+        }
+
+        /**
+         * @brief Restores the coordinates of one frame from @p in.
+         *
+         * @throws std::runtime_error if @p in does not hold exactly the
+         *         coordinates of x.size() particles.
+         */
+        void decode(
+            std::span<const std::byte> in,
+            std::span<Rep>             x,
+            std::span<Rep>             y,
+            std::span<Rep>             z
+        ) const
+        {
+            const auto bytes = x.size() * sizeof(Rep);
+
+            assert(y.size() == x.size() && z.size() == x.size());
+
+            if (in.size() != 3 * bytes)
+                throw std::runtime_error(
+                    "RawTrajectoryCodec: frame size does not match the "
+                    "number of particles"
+                );
+
+            std::memcpy(x.data(), in.data(), bytes);
+            std::memcpy(y.data(), in.data() + bytes, bytes);
+            std::memcpy(z.data(), in.data() + 2 * bytes, bytes);
+        }
+    };
+
+}   // namespace mstd
+
+#endif   // __MSTD__PHYSICS__IO__TRAJECTORY_FORMAT_HPP__
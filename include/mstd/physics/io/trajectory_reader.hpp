@@ -0,0 +1,173 @@
+/*****************************************************************************
+<GPL_HEADER>
+
+    mstd library
+    Copyright (C) 2025-now  Jakob Gamper
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+<GPL_HEADER>
+******************************************************************************/
+
+#ifndef __MSTD__PHYSICS__IO__TRAJECTORY_READER_HPP__
+#define __MSTD__PHYSICS__IO__TRAJECTORY_READER_HPP__
+
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <optional>
+#include <span>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "mstd/type_traits/physics_traits.hpp"
+#include "trajectory_format.hpp"
+
+namespace mstd
+{
+    /**
+     * @brief Sequential reader of the files written by TrajectoryWriter.
+     *
+     * @tparam Rep numeric representation.
+     * @tparam Codec frame codec the file was written with.
+     */
+    template <
+        typename Rep                   = double,
+        TrajectoryCodecType<Rep> Codec = RawTrajectoryCodec<Rep>>
+    class TrajectoryReader
+    {
+       private:
+        std::ifstream          _file;
+        Codec                  _codec;
+        size_t                 _nParticles = 0;
+        std::vector<std::byte> _payload;
+
+       public:
+        /**
+         * @brief Opens @p path and reads its header.
+         *
+         * @throws std::runtime_error if the file cannot be read, is no
+         *         trajectory or was written with another codec.
+         */
+        explicit TrajectoryReader(
+            const std::filesystem::path& path,
+            Codec                        codec = {}
+        )
+            : _file(path, std::ios::binary), _codec(std::move(codec))
+        {
+            if (!_file)
+                throw std::runtime_error(
+                    "TrajectoryReader cannot open " + path.string()
+                );
+
+            std::array<std::byte, trajectory_format::headerBytes> header{};
+            _readInto(header);
+
+            size_t offset = 0;
+
+            const auto magic = details::readBytes<std::array<char, 8>>(
+                header,
+                offset
+            );
+            const auto version =
+                details::readBytes<std::uint32_t>(header, offset);
+            const auto codecId =
+                details::readBytes<std::uint32_t>(header, offset);
+
+            if (!_file || magic != trajectory_format::magic ||
+                version != trajectory_format::version)
+                throw std::runtime_error(
+                    "TrajectoryReader: " + path.string() +
+                    " is no trajectory file"
+                );
+
+            if (codecId != Codec::id)
+                throw std::runtime_error(
+                    "TrajectoryReader: " + path.string() +
+                    " was written with another codec"
+                );
+
+            _nParticles = details::readBytes<std::uint64_t>(header, offset);
+        }
+
+        /// @brief Returns the number of particles per frame.
+        size_t nParticles() const { return _nParticles; }
+
+        /**
+         * @brief Reads the next frame into @p x, @p y and @p z.
+         *
+         * @pre all spans hold nParticles() entries.
+         *
+         * @return the step of the frame, or no value at the end of the
+         *         file.
+         *
+         * @throws std::runtime_error if the file ends inside a frame or the
+         *         frame is corrupt.
+         */
+        std::optional<size_t> read(
+            std::span<Rep> x,
+            std::span<Rep> y,
+            std::span<Rep> z
+        )
+        {
+            assert(x.size() == _nParticles);
+            assert(y.size() == _nParticles && z.size() == _nParticles);
+
+            std::array<std::byte, trajectory_format::frameHeaderBytes> header{};
+            _readInto(header);
+
+            if (_file.gcount() == 0 && _file.eof())
+                return std::nullopt;
+
+            size_t     offset = 0;
+            const auto step = details::readBytes<std::uint64_t>(header, offset);
+            const auto size = details::readBytes<std::uint64_t>(header, offset);
+
+            if (!_file)
+                throw std::runtime_error("TrajectoryReader: truncated frame");
+
+            // never trust the size for an allocation
+            if (size > Codec::maxPayloadBytes(_nParticles))
+                throw std::runtime_error(
+                    "TrajectoryReader: corrupt frame size"
+                );
+
+            _payload.resize(size);
+            _readInto(_payload);
+
+            if (!_file)
+                throw std::runtime_error("TrajectoryReader: truncated frame");
+
+            _codec.decode(_payload, x, y, z);
+
+            return step;
+        }
+
+       private:
+        void _readInto(std::span<std::byte> bytes)
+        {
+            _file.read(
+                reinterpret_cast<char*>(bytes.data()),
+                static_cast<std::streamsize>(bytes.size())
+            );
+        }
+    };
+
+}   // namespace mstd
+
+#endif   // __MSTD__PHYSICS__IO__TRAJECTORY_READER_HPP__
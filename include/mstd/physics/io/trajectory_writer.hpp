@@ -0,0 +1,301 @@
+/*****************************************************************************
+<GPL_HEADER>
+
+    mstd library
+    Copyright (C) 2025-now  Jakob Gamper
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+<GPL_HEADER>
+******************************************************************************/
+
+#ifndef __MSTD__PHYSICS__IO__TRAJECTORY_WRITER_HPP__
+#define __MSTD__PHYSICS__IO__TRAJECTORY_WRITER_HPP__
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <exception>
+#include <filesystem>
+#include <fstream>
+#include <mutex>
+#include <span>
+#include <stdexcept>
+#include <stop_token>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "mstd/memory.hpp"
+#include "mstd/physics/particles.hpp"
+#include "mstd/type_traits/physics_traits.hpp"
+#include "trajectory_format.hpp"
+
+namespace mstd
+{
+    /**
+     * @brief Binary trajectory writer encoding and writing frames on a
+     *        background thread.
+     *
+     * write() only copies the positions into one of two staging frames
+     * and returns; it blocks only while both frames are still queued. A
+     * dedicated thread encodes every staged frame with @p Codec into one
+     * contiguous record and hands it to an unbuffered stream, so each
+     * frame leaves the process as a single large sequential `write`.
+     *
+     * Errors of the I/O thread are rethrown by the next write() or
+     * flush(). The destructor writes all staged frames but cannot report
+     * errors, so call flush() before closing when they matter.
+     *
+     * @tparam Rep numeric representation.
+     * @tparam Codec frame codec, see TrajectoryCodecType.
+     */
+    template <
+        typename Rep                   = double,
+        TrajectoryCodecType<Rep> Codec = RawTrajectoryCodec<Rep>>
+    class TrajectoryWriter
+    {
+       private:
+        struct Frame
+        {
+            std::uint64_t      step = 0;
+            AlignedVector<Rep> x, y, z;
+        };
+
+        size_t _nParticles;
+        Codec  _codec;
+
+        std::ofstream          _file;
+        std::vector<std::byte> _record;
+
+        std::array<Frame, 2> _staging;
+        std::array<bool, 2>  _queued{};
+        size_t               _next = 0;
+
+        mutable std::mutex          _mutex;
+        std::condition_variable_any _condition;
+        std::exception_ptr          _error;
+
+        size_t        _framesWritten = 0;
+        std::uint64_t _bytesWritten  = 0;
+
+        // last member: joined before anything it uses is destroyed
+        std::jthread _thread;
+
+       public:
+        /**
+         * @brief Creates the file at @p path, writes its header and starts
+         *        the I/O thread.
+         *
+         * @throws std::runtime_error if the file cannot be written.
+         */
+        TrajectoryWriter(
+            const std::filesystem::path& path,
+            const size_t                 nParticles,
+            Codec                        codec = {}
+        )
+            : _nParticles(nParticles), _codec(std::move(codec))
+        {
+            // unbuffered: every record goes to the kernel in one write
+            _file.rdbuf()->pubsetbuf(nullptr, 0);
+            _file.open(path, std::ios::binary | std::ios::trunc);
+
+            if (!_file)
+                throw std::runtime_error(
+                    "TrajectoryWriter cannot open " + path.string()
+                );
+
+            for (auto& frame : _staging)
+            {
+                frame.x.resize(nParticles);
+                frame.y.resize(nParticles);
+                frame.z.resize(nParticles);
+            }
+
+            details::appendBytes(_record, trajectory_format::magic);
+            details::appendBytes(_record, trajectory_format::version);
+            details::appendBytes(_record, std::uint32_t{Codec::id});
+            details::appendBytes(_record, std::uint64_t{nParticles});
+
+            _writeRecord();
+
+            _thread = std::jthread([this](std::stop_token stop)
+                                   { _run(stop); });
+        }
+
+        TrajectoryWriter(const TrajectoryWriter&)            = delete;
+        TrajectoryWriter& operator=(const TrajectoryWriter&) = delete;
+
+        /**
+         * @brief Stages the positions of frame @p step for writing.
+         *
+         * @pre all spans hold nParticles() entries.
+         *
+         * @throws any error of the I/O thread raised since the last call.
+         */
+        void write(
+            const size_t         step,
+            std::span<const Rep> x,
+            std::span<const Rep> y,
+            std::span<const Rep> z
+        )
+        {
+            assert(x.size() == _nParticles);
+            assert(y.size() == _nParticles && z.size() == _nParticles);
+
+            auto& frame = _staging[_next];
+
+            {
+                std::unique_lock lock(_mutex);
+                _condition.wait(lock, [&] { return !_queued[_next]; });
+                _rethrow();
+            }
+
+            // a frame that is not queued belongs to the calling thread
+            frame.step = step;
+            std::ranges::copy(x, frame.x.begin());
+            std::ranges::copy(y, frame.y.begin());
+            std::ranges::copy(z, frame.z.begin());
+
+            {
+                std::lock_guard lock(_mutex);
+                _queued[_next] = true;
+            }
+
+            _condition.notify_all();
+            _next ^= 1;
+        }
+
+        /// @brief Stages the positions of @p particles for writing.
+        void write(const size_t step, const ParticleArrays<Rep>& particles)
+        {
+            write(step, particles.x, particles.y, particles.z);
+        }
+
+        /**
+         * @brief Blocks until all staged frames are written.
+         *
+         * @throws any error of the I/O thread raised since the last call.
+         */
+        void flush()
+        {
+            std::unique_lock lock(_mutex);
+            _condition.wait(lock, [&] { return !_queued[0] && !_queued[1]; });
+            _rethrow();
+        }
+
+        /// @brief Returns the number of particles per frame.
+        size_t nParticles() const { return _nParticles; }
+
+        /// @brief Returns the number of frames on disk.
+        size_t framesWritten() const
+        {
+            std::lock_guard lock(_mutex);
+            return _framesWritten;
+        }
+
+        /// @brief Returns the number of bytes on disk, header included.
+        std::uint64_t bytesWritten() const
+        {
+            std::lock_guard lock(_mutex);
+            return _bytesWritten;
+        }
+
+       private:
+        void _rethrow()
+        {
+            if (_error)
+                std::rethrow_exception(std::exchange(_error, nullptr));
+        }
+
+        void _writeRecord()
+        {
+            _file.write(
+                reinterpret_cast<const char*>(_record.data()),
+                static_cast<std::streamsize>(_record.size())
+            );
+
+            if (!_file)
+                throw std::runtime_error("TrajectoryWriter failed to write");
+
+            std::lock_guard lock(_mutex);
+            _bytesWritten += _record.size();
+        }
+
+        /// encodes and writes the staged frames in order until stopped
+        void _run(std::stop_token stop)
+        {
+            for (size_t current = 0;; current ^= 1)
+            {
+                {
+                    std::unique_lock lock(_mutex);
+                    _condition.wait(
+                        lock,
+                        stop,
+                        [&] { return _queued[current]; }
+                    );
+
+                    // staged frames are still written after a stop request
+                    if (!_queued[current])
+                        return;
+                }
+
+                bool written = false;
+
+                try
+                {
+                    const auto& frame = _staging[current];
+
+                    _record.clear();
+                    details::appendBytes(_record, frame.step);
+                    details::appendBytes(_record, std::uint64_t{0});
+
+                    _codec.encode(frame.x, frame.y, frame.z, _record);
+
+                    const std::uint64_t payload =
+                        _record.size() - trajectory_format::frameHeaderBytes;
+                    std::memcpy(
+                        _record.data() + sizeof(std::uint64_t),
+                        &payload,
+                        sizeof(payload)
+                    );
+
+                    _writeRecord();
+                    written = true;
+                }
+                catch (...)
+                {
+                    std::lock_guard lock(_mutex);
+                    _error = std::current_exception();
+                }
+
+                {
+                    std::lock_guard lock(_mutex);
+                    _queued[current] = false;
+                    if (written)
+                        ++_framesWritten;
+                }
+
+                _condition.notify_all();
+            }
+        }
+    };
+
+}   // namespace mstd
+
+#endif   // __MSTD__PHYSICS__IO__TRAJECTORY_WRITER_HPP__
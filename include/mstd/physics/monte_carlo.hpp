@@ -0,0 +1,673 @@
+/*****************************************************************************
+<GPL_HEADER>
+
+    mstd library
+    Copyright (C) 2025-now  Jakob Gamper
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+<GPL_HEADER>
+******************************************************************************/
+
+#ifndef __MSTD__PHYSICS__MONTE_CARLO_HPP__
+#define __MSTD__PHYSICS__MONTE_CARLO_HPP__
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cmath>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+#include "box.hpp"
+#include "mstd/memory.hpp"
+#include "mstd/simd.hpp"
+#include "mstd/type_traits/physics_traits.hpp"
+#include "pair_forces.hpp"
+
+namespace mstd
+{
+    namespace details
+    {
+        /**
+         * @brief Energy of a single pair, without the force term whenever
+         *        the potential offers an energy-only path.
+         */
+        template <typename Potential>
+        typename Potential::rep pairEnergyFromR2(
+            const Potential&              potential,
+            const size_t                  i,
+            const size_t                  j,
+            const typename Potential::rep r2
+        )
+        {
+            if constexpr (IndexedPairPotentialType<Potential>)
+                return potential.evalFromR2(i, j, r2).first;
+            else if constexpr (EnergyPairPotentialType<Potential>)
+                return potential.energyFromR2(r2);
+            else
+                return potential.evalFromR2(r2).first;
+        }
+
+    }   // namespace details
+
+    /**
+     * @brief Metropolis acceptance test.
+     *
+     * @param deltaEnergy energy change of the trial move.
+     * @param beta inverse temperature \f$1 / k_B T\f$.
+     * @param uniform uniform random number in [0, 1).
+     * @return true if the move is accepted.
+     */
+    template <typename Rep>
+    bool metropolisAccept(
+        const Rep deltaEnergy,
+        const Rep beta,
+        const Rep uniform
+    )
+    {
+        return deltaEnergy <= 0 || uniform < std::exp(-beta * deltaEnergy);
+    }
+
+    /**
+     * @brief Cell list for single-particle Monte Carlo moves.
+     *
+     * Owns the particle positions and keeps them binned into cells whose
+     * perpendicular widths are at least the cutoff, like CellList. Every
+     * cell has the same number of slots, and the slots store the particle
+     * coordinates, so the energy of one particle streams through the 27
+     * cells around it. Moving a particle to another cell swaps the last
+     * particle of its old cell into the free slot, so the energy of a trial
+     * move and its acceptance both cost O(1) at constant density. A move
+     * into a full cell first doubles the slots of all cells, which is
+     * amortized over the moves.
+     *
+     * A trial move is evaluated with trialMove() and then either accepted
+     * or rejected:
+     *
+     * @code
+     * const auto delta = cells.trialMove(potential, i, x, y, z);
+     * if (metropolisAccept(delta, beta, uniform(engine)))
+     *     cells.accept();
+     * else
+     *     cells.reject();
+     * @endcode
+     *
+     * Only energies are evaluated, through the energy-only path of the
+     * potential where it has one (EnergyPairPotentialType).
+     *
+     * @tparam Rep numeric representation.
+     * @tparam Box periodic box type, see BoxType.
+     */
+    template <typename Rep = double, BoxType Box = OrthorhombicBox<Rep>>
+    class MonteCarloCellList
+    {
+       private:
+        /// pending move of trialMove()
+        struct Trial
+        {
+            size_t             particle;
+            std::array<Rep, 3> position;
+            size_t             cell;
+        };
+
+        Box                   _box;
+        std::array<size_t, 3> _nCells{};
+        Rep                   _cutoff{};
+
+        /// CSR offsets of the unique cells of each 27 cell stencil
+        std::vector<size_t> _stencilStart;
+        std::vector<size_t> _stencilCells;
+
+        /// slots per cell
+        size_t _capacity = 0;
+
+        std::vector<size_t> _count;
+        AlignedVector<Rep>  _slotX;
+        AlignedVector<Rep>  _slotY;
+        AlignedVector<Rep>  _slotZ;
+        std::vector<size_t> _slotParticle;
+        std::vector<size_t> _slotOf;
+
+        std::optional<Trial> _trial;
+
+       public:
+        using rep      = Rep;
+        using box_type = Box;
+
+        /**
+         * @brief Sets up the cell grid for a box and cutoff.
+         *
+         * @throws std::invalid_argument if the cutoff is not positive or the
+         *         box is thinner than twice the cutoff in any direction.
+         */
+        MonteCarloCellList(const Box& box, const Rep cutoff)
+            : _box(box), _cutoff(cutoff)
+        {
+            if (!(cutoff > 0))
+                throw std::invalid_argument(
+                    "MonteCarloCellList requires cutoff > 0"
+                );
+
+            const auto widths = _box.perpendicularWidths();
+
+            for (size_t dim = 0; dim < 3; ++dim)
+            {
+                if (!(widths[dim] >= 2 * cutoff))
+                    throw std::invalid_argument(
+                        "MonteCarloCellList requires box widths >= 2 * cutoff"
+                    );
+
+                _nCells[dim] = static_cast<size_t>(widths[dim] / cutoff);
+            }
+
+            _buildStencils();
+        }
+
+        /**
+         * @brief Copies and bins the positions of all particles.
+         *
+         * Coordinates outside the primary box are wrapped back. A pending
+         * trial move is discarded.
+         *
+         * @pre `x`, `y` and `z` have the same size.
+         */
+        void build(
+            std::span<const Rep> x,
+            std::span<const Rep> y,
+            std::span<const Rep> z
+        )
+        {
+            assert(x.size() == y.size() && x.size() == z.size());
+
+            const size_t nParticles = x.size();
+
+            std::vector<std::array<Rep, 3>> positions(nParticles);
+            std::vector<size_t>             cells(nParticles);
+            std::vector<size_t>             count(nCells(), 0);
+
+            for (size_t i = 0; i < nParticles; ++i)
+            {
+                positions[i] = _box.wrap(x[i], y[i], z[i]);
+                cells[i]     = _cellIndex(positions[i]);
+                ++count[cells[i]];
+            }
+
+            // headroom for fluctuations of the occupancy
+            const auto fullest = std::ranges::max(count);
+            _layout(std::max<size_t>(4, fullest + fullest / 2));
+
+            _slotOf.resize(nParticles);
+            for (size_t i = 0; i < nParticles; ++i)
+                _insert(i, positions[i], cells[i]);
+
+            _trial.reset();
+        }
+
+        /// @brief Returns the number of particles.
+        size_t size() const { return _slotOf.size(); }
+
+        /// @brief Returns the total number of cells.
+        size_t nCells() const { return _nCells[0] * _nCells[1] * _nCells[2]; }
+
+        /// @brief Returns the number of particle slots per cell.
+        size_t slotsPerCell() const { return _capacity; }
+
+        /// @brief Returns the periodic box.
+        const Box& box() const { return _box; }
+
+        /// @brief Returns the cutoff.
+        Rep cutoff() const { return _cutoff; }
+
+        /// @brief Returns the cell of particle @p i.
+        size_t cellOf(const size_t i) const { return _slotOf[i] / _capacity; }
+
+        /// @brief Returns the wrapped position of particle @p i.
+        std::array<Rep, 3> position(const size_t i) const
+        {
+            const auto slot = _slotOf[i];
+            return {_slotX[slot], _slotY[slot], _slotZ[slot]};
+        }
+
+        /**
+         * @brief Returns the energy of particle @p i with all particles
+         *        within the cutoff.
+         */
+        template <PairKernelPotentialType Potential>
+            requires AccumulatesIn<typename Potential::rep, Rep>
+        Rep particleEnergy(const Potential& potential, const size_t i) const
+        {
+            return _energyAt(potential, i, position(i), cellOf(i));
+        }
+
+        /**
+         * @brief Returns the energy particle @p i would have at @p x, @p y,
+         *        @p z, leaving all particles in place.
+         */
+        template <PairKernelPotentialType Potential>
+            requires AccumulatesIn<typename Potential::rep, Rep>
+        Rep particleEnergyAt(
+            const Potential& potential,
+            const size_t     i,
+            const Rep        x,
+            const Rep        y,
+            const Rep        z
+        ) const
+        {
+            const auto position = _box.wrap(x, y, z);
+            return _energyAt(potential, i, position, _cellIndex(position));
+        }
+
+        /**
+         * @brief Returns the total pair energy, each pair counted once.
+         *
+         * Costs O(N); meant for the initial energy and for checks of the
+         * accumulated energy changes.
+         */
+        template <PairKernelPotentialType Potential>
+            requires AccumulatesIn<typename Potential::rep, Rep>
+        Rep totalEnergy(const Potential& potential) const
+        {
+            Rep energy{};
+
+            for (size_t i = 0; i < size(); ++i)
+                energy += particleEnergy(potential, i);
+
+            return energy / 2;
+        }
+
+        /**
+         * @brief Evaluates moving particle @p i to @p x, @p y, @p z.
+         *
+         * The move is kept pending until accept() or reject(); a new trial
+         * move replaces it.
+         *
+         * @return the energy change of the move.
+         */
+        template <PairKernelPotentialType Potential>
+            requires AccumulatesIn<typename Potential::rep, Rep>
+        Rep trialMove(
+            const Potential& potential,
+            const size_t     i,
+            const Rep        x,
+            const Rep        y,
+            const Rep        z
+        )
+        {
+            assert(i < size());
+
+            const auto position = _box.wrap(x, y, z);
+            const auto cell     = _cellIndex(position);
+
+            _trial = Trial{i, position, cell};
+
+            return _energyAt(potential, i, position, cell) -
+                   particleEnergy(potential, i);
+        }
+
+        /// @brief Returns true if a trial move is pending.
+        bool hasTrial() const { return _trial.has_value(); }
+
+        /**
+         * @brief Applies the pending trial move.
+         *
+         * @pre hasTrial()
+         */
+        void accept()
+        {
+            assert(_trial.has_value());
+
+            const auto [i, position, cell] = *_trial;
+            _trial.reset();
+
+            const auto slot = _slotOf[i];
+
+            if (slot / _capacity == cell)
+            {
+                _slotX[slot] = position[0];
+                _slotY[slot] = position[1];
+                _slotZ[slot] = position[2];
+                return;
+            }
+
+            if (_count[cell] == _capacity)
+                _grow();
+
+            _remove(_slotOf[i]);
+            _insert(i, position, cell);
+        }
+
+        /// @brief Discards the pending trial move.
+        void reject() { _trial.reset(); }
+
+        /**
+         * @brief Copies the wrapped positions into @p x, @p y and @p z.
+         *
+         * @pre all spans have size().
+         */
+        void copyPositions(
+            std::span<Rep> x,
+            std::span<Rep> y,
+            std::span<Rep> z
+        ) const
+        {
+            assert(x.size() == size());
+            assert(y.size() == size() && z.size() == size());
+
+            for (size_t i = 0; i < size(); ++i)
+            {
+                const auto p = position(i);
+
+                x[i] = p[0];
+                y[i] = p[1];
+                z[i] = p[2];
+            }
+        }
+
+       private:
+        template <typename Potential>
+        Rep _energyAt(
+            const Potential&          potential,
+            const size_t              i,
+            const std::array<Rep, 3>& position,
+            const size_t              cell
+        ) const
+        {
+            using V                = SimdVec<Rep>;
+            constexpr size_t width = simd_size_v<V>;
+
+            const auto x = simdBroadcast<V>(position[0]);
+            const auto y = simdBroadcast<V>(position[1]);
+            const auto z = simdBroadcast<V>(position[2]);
+
+            V   vectorEnergy{};
+            Rep energy{};
+
+            for (auto n = _stencilStart[cell]; n < _stencilStart[cell + 1];
+                 ++n)
+            {
+                const auto other = _stencilCells[n];
+                const auto first = other * _capacity;
+                const auto count = _count[other];
+
+                // the slots per cell are a multiple of the SIMD width, so
+                // whole vectors can be loaded past the last particle
+                for (size_t k = 0; k < count; k += width)
+                {
+                    const auto slot = first + k;
+
+                    const auto [dx, dy, dz] = _box.template minimumImage<V>(
+                        x - simdLoad<V>(_slotX.data() + slot),
+                        y - simdLoad<V>(_slotY.data() + slot),
+                        z - simdLoad<V>(_slotZ.data() + slot)
+                    );
+
+                    const auto r2 = dx * dx + dy * dy + dz * dz;
+
+                    if constexpr (_laneGeneric<Potential>)
+                        vectorEnergy +=
+                            _maskedEnergy(potential, i, slot, count - k, r2);
+                    else
+                        energy +=
+                            _laneEnergy(potential, i, slot, count - k, r2);
+                }
+            }
+
+            return energy + simdReduceAdd(vectorEnergy);
+        }
+
+        /// potentials whose energy-only path takes whole SIMD vectors
+        template <typename Potential>
+        static constexpr bool _laneGeneric =
+            std::same_as<typename Potential::rep, Rep> &&
+            requires(const Potential p, SimdVec<Rep> r2) {
+                {
+                    p.template energyFromR2<SimdVec<Rep>>(r2)
+                } -> std::same_as<SimdVec<Rep>>;
+            };
+
+        /**
+         * @brief Energies of the lanes of @p r2 within the cutoff, zero
+         *        for all others.
+         *
+         * Lanes beyond the @p remaining particles of the cell and the slot
+         * of particle @p i are masked as well, so the vector needs no
+         * branch per lane. The lane masks compare integer lane indices,
+         * which stay exact for any slot count.
+         */
+        template <typename Potential, typename V>
+        V _maskedEnergy(
+            const Potential& potential,
+            const size_t     i,
+            const size_t     slot,
+            const size_t     remaining,
+            const V          r2
+        ) const
+        {
+            constexpr size_t width = simd_size_v<V>;
+
+            // same lane size as Rep, so the masks combine with r2 < cutoff2
+            using Int = std::conditional_t<
+                sizeof(Rep) == sizeof(std::int64_t),
+                std::int64_t,
+                std::int32_t>;
+
+            using Lane = SimdVec<Int, width>;
+
+            Lane lane{};
+            for (size_t l = 0; l < width; ++l)
+                lane[l] = static_cast<Int>(l);
+
+            // lane of particle i in this vector, width if it is elsewhere
+            const auto self  = std::min(_slotOf[i] - slot, width);
+            const auto valid = std::min(remaining, width);
+
+            const auto cutoff2 = simdBroadcast<V>(_cutoff * _cutoff);
+
+            const auto inside =
+                r2 < cutoff2 &&
+                lane < simdBroadcast<Lane>(static_cast<Int>(valid)) &&
+                lane != simdBroadcast<Lane>(static_cast<Int>(self));
+
+            const auto energy =
+                potential.template energyFromR2<V>(inside ? r2 : cutoff2);
+
+            return inside ? energy : V{};
+        }
+
+        /// @brief Lane by lane counterpart of _maskedEnergy.
+        template <typename Potential, typename V>
+        Rep _laneEnergy(
+            const Potential& potential,
+            const size_t     i,
+            const size_t     slot,
+            const size_t     remaining,
+            const V          r2
+        ) const
+        {
+            using EvalRep = typename Potential::rep;
+
+            constexpr size_t width = simd_size_v<V>;
+
+            const auto cutoff2 = _cutoff * _cutoff;
+
+            Rep energy{};
+
+            for (size_t l = 0; l < std::min(width, remaining); ++l)
+            {
+                const auto j = _slotParticle[slot + l];
+
+                if (r2[l] < cutoff2 && j != i)
+                    energy += details::precisionCast<Rep>(
+                        details::pairEnergyFromR2(
+                            potential,
+                            i,
+                            j,
+                            details::precisionCast<EvalRep>(r2[l])
+                        )
+                    );
+            }
+
+            return energy;
+        }
+
+        /// reserves @p capacity slots per cell and empties all cells
+        void _layout(const size_t capacity)
+        {
+            constexpr size_t width = simd_size_v<SimdVec<Rep>>;
+
+            _capacity = (capacity + width - 1) / width * width;
+
+            const auto nSlots = nCells() * _capacity;
+
+            _count.assign(nCells(), 0);
+            _slotX.assign(nSlots, Rep{});
+            _slotY.assign(nSlots, Rep{});
+            _slotZ.assign(nSlots, Rep{});
+            _slotParticle.assign(nSlots, 0);
+        }
+
+        /// doubles the slots per cell, keeping all particles
+        void _grow()
+        {
+            std::vector<std::array<Rep, 3>> positions(size());
+            std::vector<size_t>             cells(size());
+
+            for (size_t i = 0; i < size(); ++i)
+            {
+                positions[i] = position(i);
+                cells[i]     = cellOf(i);
+            }
+
+            _layout(2 * _capacity);
+
+            for (size_t i = 0; i < size(); ++i)
+                _insert(i, positions[i], cells[i]);
+        }
+
+        /// @pre the cell has a free slot
+        void _insert(
+            const size_t              i,
+            const std::array<Rep, 3>& position,
+            const size_t              cell
+        )
+        {
+            assert(_count[cell] < _capacity);
+
+            const auto slot = cell * _capacity + _count[cell]++;
+
+            _slotX[slot]        = position[0];
+            _slotY[slot]        = position[1];
+            _slotZ[slot]        = position[2];
+            _slotParticle[slot] = i;
+            _slotOf[i]          = slot;
+        }
+
+        /// frees @p slot by moving the last particle of its cell into it
+        void _remove(const size_t slot)
+        {
+            const auto cell = slot / _capacity;
+            const auto last = cell * _capacity + --_count[cell];
+
+            _slotX[slot]        = _slotX[last];
+            _slotY[slot]        = _slotY[last];
+            _slotZ[slot]        = _slotZ[last];
+            _slotParticle[slot] = _slotParticle[last];
+
+            _slotOf[_slotParticle[slot]] = slot;
+        }
+
+        size_t _flatten(const size_t ix, const size_t iy, const size_t iz) const
+        {
+            return (ix * _nCells[1] + iy) * _nCells[2] + iz;
+        }
+
+        size_t _cellIndexDim(const Rep frac, const size_t dim) const
+        {
+            const auto index = static_cast<size_t>(
+                frac * static_cast<Rep>(_nCells[dim])
+            );
+            return std::min(index, _nCells[dim] - 1);
+        }
+
+        size_t _cellIndex(const std::array<Rep, 3>& position) const
+        {
+            const auto [sx, sy, sz] =
+                _box.fractional(position[0], position[1], position[2]);
+
+            return _flatten(
+                _cellIndexDim(sx, 0),
+                _cellIndexDim(sy, 1),
+                _cellIndexDim(sz, 2)
+            );
+        }
+
+        /**
+         * @brief Collects for every cell the unique cells of its 27 stencil,
+         *        itself included.
+         *
+         * With fewer than three cells in a direction periodic images of the
+         * stencil coincide and are visited once.
+         */
+        void _buildStencils()
+        {
+            _stencilStart.assign(1, 0);
+            _stencilCells.clear();
+
+            const auto wrap =
+                [](const size_t i, const int offset, const size_t n)
+            {
+                const auto shifted = static_cast<long long>(i) + offset;
+                const auto size    = static_cast<long long>(n);
+                return static_cast<size_t>(((shifted % size) + size) % size);
+            };
+
+            std::vector<size_t> stencil;
+
+            for (size_t ix = 0; ix < _nCells[0]; ++ix)
+                for (size_t iy = 0; iy < _nCells[1]; ++iy)
+                    for (size_t iz = 0; iz < _nCells[2]; ++iz)
+                    {
+                        stencil.clear();
+
+                        for (int dx = -1; dx <= 1; ++dx)
+                            for (int dy = -1; dy <= 1; ++dy)
+                                for (int dz = -1; dz <= 1; ++dz)
+                                    stencil.push_back(_flatten(
+                                        wrap(ix, dx, _nCells[0]),
+                                        wrap(iy, dy, _nCells[1]),
+                                        wrap(iz, dz, _nCells[2])
+                                    ));
+
+                        std::ranges::sort(stencil);
+                        const auto last = std::ranges::unique(stencil);
+                        stencil.erase(last.begin(), last.end());
+
+                        _stencilCells.insert(
+                            _stencilCells.end(),
+                            stencil.begin(),
+                            stencil.end()
+                        );
+                        _stencilStart.push_back(_stencilCells.size());
+                    }
+        }
+    };
+
+}   // namespace mstd
+
+#endif   // __MSTD__PHYSICS__MONTE_CARLO_HPP__
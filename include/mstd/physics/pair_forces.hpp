@@ -0,0 +1,593 @@
+/*****************************************************************************
+<GPL_HEADER>
+
+    mstd library
+    Copyright (C) 2025-now  Jakob Gamper
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+<GPL_HEADER>
+******************************************************************************/
+
+#ifndef __MSTD__PHYSICS__PAIR_FORCES_HPP__
+#define __MSTD__PHYSICS__PAIR_FORCES_HPP__
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <concepts>
+#include <span>
+#include <utility>
+
+#include "mstd/memory.hpp"
+#include "mstd/simd.hpp"
+#include "mstd/type_traits/physics_traits.hpp"
+#include "virial.hpp"
+
+namespace mstd
+{
+    /**
+     * @brief Selects how computePairForces evaluates the pairs.
+     *
+     * `Scalar` calls `evalFromR2` once per pair inside the pair loop of the
+     * source. `Simd` gathers the pairs within the cutoff into fixed size
+     * blocks, evaluates each block with `evalBatchFromR2` and scatters the
+     * forces afterwards. For sources providing candidate rows (VerletList)
+     * the partner coordinates are gathered into SIMD vectors as well, so
+     * distances, minimum image and cutoff test are computed lane-wise
+     * before the pairs within the cutoff are compacted into the block.
+     *
+     * Cell lists do not provide candidate rows: most of their candidates
+     * lie outside the cutoff, and the scalar filter of the source beats
+     * gathering all of them into vectors.
+     *
+     * Both paths support mixed precision: with a `float` potential and
+     * `double` coordinates, distances and the minimum image are computed in
+     * `double`, the potential is evaluated in `float` (twice the SIMD width)
+     * and energies and forces are accumulated in `double`.
+     */
+    enum class PairKernelPath
+    {
+        Scalar,
+        Simd
+    };
+
+    namespace details
+    {
+        /// number of pairs gathered before the potential is evaluated
+        static constexpr size_t pair_batch_size = 128;
+
+        /**
+         * @brief converts between evaluation and accumulation precision
+         *
+         * Avoids a useless cast if both agree.
+         */
+        template <typename To, typename From>
+        constexpr To precisionCast(const From value)
+        {
+            if constexpr (std::same_as<To, From>)
+                return value;
+            else
+                return static_cast<To>(value);
+        }
+
+        /**
+         * @brief callback archetype of candidate row sources
+         */
+        struct CandidateRowCallbackArchetype
+        {
+            void operator()(size_t, std::span<const size_t>) const {}
+        };
+
+        /**
+         * @brief pair sources that expose candidate rows for the SIMD kernel
+         *
+         * @tparam S
+         */
+        template <typename S>
+        concept CandidateRowSource = requires(const S s) {
+            s.forEachCandidateRow(CandidateRowCallbackArchetype{});
+            requires BoxType<typename S::box_type>;
+            {
+                s.box()
+            } -> std::convertible_to<const typename S::box_type&>;
+            { s.cutoff() } -> std::convertible_to<typename S::rep>;
+        };
+
+        /**
+         * @brief Evaluates a single pair, passing the particle indices to
+         *        indexed potentials.
+         */
+        template <typename Potential>
+        std::pair<typename Potential::rep, typename Potential::rep>
+        evalPairFromR2(
+            const Potential&              potential,
+            const size_t                  i,
+            const size_t                  j,
+            const typename Potential::rep r2
+        )
+        {
+            if constexpr (IndexedPairPotentialType<Potential>)
+                return potential.evalFromR2(i, j, r2);
+            else
+                return potential.evalFromR2(r2);
+        }
+
+        /**
+         * @brief Block of gathered pairs for the SIMD kernel path.
+         *
+         * The scatter into the force arrays stays scalar: two pairs of one
+         * block may share a particle, which a vector scatter would lose.
+         *
+         * @tparam Rep accumulation precision of coordinates and forces.
+         * @tparam EvalRep evaluation precision of the potential.
+         */
+        template <typename Rep, typename EvalRep = Rep>
+        class PairForceBatch
+        {
+           private:
+            template <typename T>
+            using Block = std::array<T, pair_batch_size>;
+
+            alignas(cache_line_bytes) Block<size_t> _i;
+            alignas(cache_line_bytes) Block<size_t> _j;
+            alignas(cache_line_bytes) Block<Rep> _dx;
+            alignas(cache_line_bytes) Block<Rep> _dy;
+            alignas(cache_line_bytes) Block<Rep> _dz;
+            alignas(cache_line_bytes) Block<EvalRep> _r2;
+            alignas(cache_line_bytes) Block<EvalRep> _energy;
+            alignas(cache_line_bytes) Block<EvalRep> _forceOverR;
+
+            size_t _size = 0;
+
+           public:
+            /**
+             * @brief Appends a pair if @p keep is set.
+             *
+             * The pair is written unconditionally and only counted if
+             * @p keep is set, which compacts the pairs within the cutoff
+             * without a branch.
+             *
+             * @pre room() > 0
+             */
+            void push(
+                const size_t i,
+                const size_t j,
+                const Rep    dx,
+                const Rep    dy,
+                const Rep    dz,
+                const Rep    r2,
+                const bool   keep = true
+            )
+            {
+                assert(_size < pair_batch_size);
+
+                _i[_size]  = i;
+                _j[_size]  = j;
+                _dx[_size] = dx;
+                _dy[_size] = dy;
+                _dz[_size] = dz;
+                _r2[_size] = precisionCast<EvalRep>(r2);
+
+                _size += static_cast<size_t>(keep);
+            }
+
+            /// @brief Returns the number of pairs that still fit.
+            size_t room() const { return pair_batch_size - _size; }
+
+            /**
+             * @brief Evaluates all gathered pairs, scatters their forces,
+             *        adds them to @p virial and empties the block.
+             *
+             * @return the summed pair energy of the block.
+             */
+            template <typename Potential, typename Virial>
+            Rep flush(
+                const Potential& potential,
+                std::span<Rep>   fx,
+                std::span<Rep>   fy,
+                std::span<Rep>   fz,
+                Virial&          virial
+            )
+            {
+                const auto n = _size;
+                _size        = 0;
+
+                if constexpr (IndexedPairPotentialType<Potential>)
+                    potential.evalBatchFromR2(
+                        std::span<const size_t>(_i).first(n),
+                        std::span<const size_t>(_j).first(n),
+                        std::span<const EvalRep>(_r2).first(n),
+                        std::span<EvalRep>(_energy).first(n),
+                        std::span<EvalRep>(_forceOverR).first(n)
+                    );
+                else
+                    potential.evalBatchFromR2(
+                        std::span<const EvalRep>(_r2).first(n),
+                        std::span<EvalRep>(_energy).first(n),
+                        std::span<EvalRep>(_forceOverR).first(n)
+                    );
+
+                Rep energy{};
+
+                for (size_t k = 0; k < n; ++k)
+                {
+                    const auto forceOverR = precisionCast<Rep>(_forceOverR[k]);
+
+                    energy += precisionCast<Rep>(_energy[k]);
+
+                    const auto sx = forceOverR * _dx[k];
+                    const auto sy = forceOverR * _dy[k];
+                    const auto sz = forceOverR * _dz[k];
+
+                    fx[_i[k]] -= sx;
+                    fy[_i[k]] -= sy;
+                    fz[_i[k]] -= sz;
+                    fx[_j[k]] += sx;
+                    fy[_j[k]] += sy;
+                    fz[_j[k]] += sz;
+
+                    virial.addPair(forceOverR, _dx[k], _dy[k], _dz[k]);
+                }
+
+                return energy;
+            }
+        };
+
+        /**
+         * @brief Accumulates pair forces into @p fx, @p fy and @p fz and
+         *        the pair virial into @p virial.
+         *
+         * @p visit is called once with the pair callback and has to forward
+         * it to (a part of) a pair source. Keeping the enumeration outside
+         * lets serial and threaded kernels share the evaluation. The virial
+         * is summed in a local tensor, VirialTensor or NoVirial, and added
+         * to @p virial once at the end.
+         *
+         * @return the total energy of the visited pairs.
+         */
+        template <
+            PairKernelPath Path,
+            typename Rep,
+            typename Potential,
+            typename Virial,
+            typename Visit>
+        Rep accumulatePairForces(
+            const Potential& potential,
+            std::span<Rep>   fx,
+            std::span<Rep>   fy,
+            std::span<Rep>   fz,
+            Virial&          virial,
+            Visit&&          visit
+        )
+        {
+            using EvalRep = typename Potential::rep;
+
+            Rep    energy{};
+            Virial local{};
+
+            if constexpr (Path == PairKernelPath::Scalar)
+            {
+                visit(
+                    [&](const size_t i,
+                        const size_t j,
+                        const Rep    dx,
+                        const Rep    dy,
+                        const Rep    dz,
+                        const Rep    r2)
+                    {
+                        const auto [e, f] = evalPairFromR2(
+                            potential,
+                            i,
+                            j,
+                            precisionCast<EvalRep>(r2)
+                        );
+
+                        const auto forceOverR = precisionCast<Rep>(f);
+
+                        energy += precisionCast<Rep>(e);
+
+                        const auto sx = forceOverR * dx;
+                        const auto sy = forceOverR * dy;
+                        const auto sz = forceOverR * dz;
+
+                        fx[i] -= sx;
+                        fy[i] -= sy;
+                        fz[i] -= sz;
+                        fx[j] += sx;
+                        fy[j] += sy;
+                        fz[j] += sz;
+
+                        local.addPair(forceOverR, dx, dy, dz);
+                    }
+                );
+            }
+            else
+            {
+                PairForceBatch<Rep, EvalRep> batch;
+
+                visit(
+                    [&](const size_t i,
+                        const size_t j,
+                        const Rep    dx,
+                        const Rep    dy,
+                        const Rep    dz,
+                        const Rep    r2)
+                    {
+                        batch.push(i, j, dx, dy, dz, r2);
+
+                        if (batch.room() == 0)
+                            energy +=
+                                batch.flush(potential, fx, fy, fz, local);
+                    }
+                );
+
+                energy += batch.flush(potential, fx, fy, fz, local);
+            }
+
+            virial += local;
+
+            return energy;
+        }
+
+        /**
+         * @brief Accumulates pair forces from candidate rows with SIMD
+         *        distance computation.
+         *
+         * @p visitRows is called once with the row callback and has to
+         * forward it to (a part of) a candidate row source. Candidates
+         * within the cutoff are compacted into a PairForceBatch. The virial
+         * is handled as in accumulatePairForces.
+         *
+         * @return the total energy of the visited pairs.
+         */
+        template <
+            typename Potential,
+            BoxType Box,
+            typename Virial,
+            typename VisitRows>
+        typename Box::rep accumulateRowForces(
+            const Potential&                   potential,
+            const Box&                         box,
+            const typename Box::rep            cutoff,
+            std::span<const typename Box::rep> x,
+            std::span<const typename Box::rep> y,
+            std::span<const typename Box::rep> z,
+            std::span<typename Box::rep>       fx,
+            std::span<typename Box::rep>       fy,
+            std::span<typename Box::rep>       fz,
+            Virial&                            virial,
+            VisitRows&&                        visitRows
+        )
+        {
+            using Rep              = typename Box::rep;
+            using V                = SimdVec<Rep>;
+            constexpr size_t width = simd_size_v<V>;
+
+            const auto cutoff2 = cutoff * cutoff;
+
+            PairForceBatch<Rep, typename Potential::rep> batch;
+            Rep                                          energy{};
+            Virial                                       local{};
+
+            visitRows(
+                [&](const size_t i, std::span<const size_t> partners)
+                {
+                    const auto xi = simdBroadcast<V>(x[i]);
+                    const auto yi = simdBroadcast<V>(y[i]);
+                    const auto zi = simdBroadcast<V>(z[i]);
+
+                    for (size_t k = 0; k < partners.size(); k += width)
+                    {
+                        const auto count =
+                            std::min(width, partners.size() - k);
+
+                        // padded lanes repeat the row particle and are
+                        // never pushed
+                        std::array<size_t, width> j;
+                        j.fill(i);
+                        for (size_t l = 0; l < count; ++l)
+                            j[l] = partners[k + l];
+
+                        const auto [dx, dy, dz] = box.template minimumImage<V>(
+                            xi - simdGather<V>(x.data(), j.data()),
+                            yi - simdGather<V>(y.data(), j.data()),
+                            zi - simdGather<V>(z.data(), j.data())
+                        );
+
+                        const auto r2 = dx * dx + dy * dy + dz * dz;
+
+                        for (size_t l = 0; l < count; ++l)
+                            batch.push(
+                                i,
+                                j[l],
+                                dx[l],
+                                dy[l],
+                                dz[l],
+                                r2[l],
+                                r2[l] < cutoff2
+                            );
+
+                        if (batch.room() < width)
+                            energy +=
+                                batch.flush(potential, fx, fy, fz, local);
+                    }
+                }
+            );
+
+            energy += batch.flush(potential, fx, fy, fz, local);
+            virial += local;
+
+            return energy;
+        }
+
+        /**
+         * @brief computePairForces with the virial accumulated into
+         *        @p virial, VirialTensor or NoVirial.
+         */
+        template <
+            PairKernelPath Path,
+            typename Source,
+            typename Potential,
+            typename Virial>
+        typename Source::rep computePairForcesAndVirial(
+            const Source&                         source,
+            const Potential&                      potential,
+            std::span<const typename Source::rep> x,
+            std::span<const typename Source::rep> y,
+            std::span<const typename Source::rep> z,
+            std::span<typename Source::rep>       fx,
+            std::span<typename Source::rep>       fy,
+            std::span<typename Source::rep>       fz,
+            Virial&                               virial
+        )
+        {
+            assert(x.size() == y.size() && x.size() == z.size());
+            assert(fx.size() == x.size());
+            assert(fy.size() == x.size() && fz.size() == x.size());
+
+            std::ranges::fill(fx, 0);
+            std::ranges::fill(fy, 0);
+            std::ranges::fill(fz, 0);
+
+            if constexpr (Path == PairKernelPath::Simd &&
+                          CandidateRowSource<Source>)
+                return accumulateRowForces(
+                    potential,
+                    source.box(),
+                    source.cutoff(),
+                    x,
+                    y,
+                    z,
+                    fx,
+                    fy,
+                    fz,
+                    virial,
+                    [&](auto&& callback)
+                    { source.forEachCandidateRow(callback); }
+                );
+            else
+                return accumulatePairForces<Path>(
+                    potential,
+                    fx,
+                    fy,
+                    fz,
+                    virial,
+                    [&](auto&& callback)
+                    { source.forEachPair(x, y, z, callback); }
+                );
+        }
+
+    }   // namespace details
+
+    /**
+     * @brief Computes the total pair energy and the forces on all particles.
+     *
+     * Every pair delivered by @p source is evaluated once and its force is
+     * applied to both partners (Newton's third law). The force arrays are
+     * overwritten. The potential is evaluated at the distances reported by
+     * the source, so its cutoff should match the cutoff of the source.
+     *
+     * The potential may use a narrower representation than the source, e.g.
+     * a `float` potential with `double` coordinates, see PairKernelPath.
+     * Potentials indexed by particles (IndexedPairPotentialType), such as
+     * SpeciesPairPotential, receive the particle indices of every pair.
+     *
+     * @pre all spans have the same size and @p source has been built or
+     *      updated with the given coordinates.
+     *
+     * @tparam Path scalar or SIMD pair evaluation.
+     * @param source pair source, e.g. AllPairs, CellList or VerletList.
+     * @param potential pair potential, plain or indexed by particles.
+     * @param x, y, z particle coordinates.
+     * @param fx, fy, fz output forces.
+     * @return the total potential energy.
+     */
+    template <
+        PairKernelPath Path = PairKernelPath::Simd,
+        PairSourceType Source,
+        PairKernelPotentialType Potential>
+        requires AccumulatesIn<typename Potential::rep, typename Source::rep>
+    typename Source::rep computePairForces(
+        const Source&                         source,
+        const Potential&                      potential,
+        std::span<const typename Source::rep> x,
+        std::span<const typename Source::rep> y,
+        std::span<const typename Source::rep> z,
+        std::span<typename Source::rep>       fx,
+        std::span<typename Source::rep>       fy,
+        std::span<typename Source::rep>       fz
+    )
+    {
+        details::NoVirial<typename Source::rep> virial;
+
+        return details::computePairForcesAndVirial<Path>(
+            source,
+            potential,
+            x,
+            y,
+            z,
+            fx,
+            fy,
+            fz,
+            virial
+        );
+    }
+
+    /**
+     * @brief Computes the total pair energy, the forces and the pair virial
+     *        in one pass.
+     *
+     * Same as computePairForces; every pair additionally adds its
+     * contribution to @p virial, which is overwritten. Choosing the
+     * overload is the compile-time switch: the overload without a tensor
+     * does no virial arithmetic at all.
+     *
+     * @param virial output pair virial, see VirialTensor.
+     */
+    template <
+        PairKernelPath Path = PairKernelPath::Simd,
+        PairSourceType Source,
+        PairKernelPotentialType Potential>
+        requires AccumulatesIn<typename Potential::rep, typename Source::rep>
+    typename Source::rep computePairForces(
+        const Source&                         source,
+        const Potential&                      potential,
+        std::span<const typename Source::rep> x,
+        std::span<const typename Source::rep> y,
+        std::span<const typename Source::rep> z,
+        std::span<typename Source::rep>       fx,
+        std::span<typename Source::rep>       fy,
+        std::span<typename Source::rep>       fz,
+        VirialTensor<typename Source::rep>&   virial
+    )
+    {
+        virial = {};
+
+        return details::computePairForcesAndVirial<Path>(
+            source,
+            potential,
+            x,
+            y,
+            z,
+            fx,
+            fy,
+            fz,
+            virial
+        );
+    }
+
+}   // namespace mstd
+
+#endif   // __MSTD__PHYSICS__PAIR_FORCES_HPP__
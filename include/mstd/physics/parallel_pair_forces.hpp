@@ -0,0 +1,421 @@
+/*****************************************************************************
+<GPL_HEADER>
+
+    mstd library
+    Copyright (C) 2025-now  Jakob Gamper
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+<GPL_HEADER>
+******************************************************************************/
+
+#ifndef __MSTD__PHYSICS__PARALLEL_PAIR_FORCES_HPP__
+#define __MSTD__PHYSICS__PARALLEL_PAIR_FORCES_HPP__
+
+#include <algorithm>
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <memory>
+#include <numeric>
+#include <span>
+#include <stdexcept>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "mstd/memory.hpp"
+#include "mstd/parallel.hpp"
+#include "mstd/type_traits/physics_traits.hpp"
+#include "pair_forces.hpp"
+#include "virial.hpp"
+
+namespace mstd
+{
+    namespace details
+    {
+        /**
+         * @brief candidate row sources that can be split into chunks
+         *
+         * @tparam S
+         */
+        template <typename S>
+        concept CandidateRowChunkSource =
+            CandidateRowSource<S> && requires(const S s, size_t n) {
+                s.forEachCandidateRowInChunk(
+                    n,
+                    n,
+                    CandidateRowCallbackArchetype{}
+                );
+            };
+
+        /**
+         * @brief chunked pair sources that report the particles a chunk
+         *        touches
+         *
+         * @tparam S
+         */
+        template <typename S>
+        concept RangedChunkSource = requires(const S s, size_t n) {
+            {
+                s.chunkParticleRange(n, n, n)
+            } -> std::convertible_to<std::pair<size_t, size_t>>;
+        };
+
+    }   // namespace details
+
+    /**
+     * @brief Multithreaded counterpart of computePairForces.
+     *
+     * Every thread evaluates one chunk of the pair source into a private
+     * force buffer, so no atomics are needed. Once all chunks are done the
+     * threads reduce the buffers in parallel, each summing a contiguous
+     * slice of particles over all buffers. The threads (a ThreadPool) and
+     * the buffers are kept between calls; the buffers cost
+     * `3 * nThreads * N` values.
+     *
+     * Sources with `chunkParticleRange` (AllPairs, VerletList) report the
+     * particles a chunk can touch, and only that range of a buffer is
+     * cleared and reduced. With spatially sorted particles this is a small
+     * part of the buffer; CellList chunks clear the whole buffer.
+     *
+     * An exception thrown by the potential on any thread is rethrown by
+     * compute once all threads have finished their chunk; the forces are
+     * unspecified in that case.
+     *
+     * Energies and forces agree with the serial kernel up to the changed
+     * summation order. For a fixed thread count the result is
+     * deterministic. The pair virial, if requested, is summed per thread
+     * and the thread sums are added after the join.
+     *
+     * @tparam Rep numeric representation of coordinates and forces; the
+     *         potential may be evaluated in a narrower type.
+     */
+    template <typename Rep = double>
+    class ParallelPairForces
+    {
+       private:
+        size_t                                 _nThreads;
+        std::unique_ptr<ThreadPool>            _pool;
+        std::vector<AlignedVector<Rep>>        _buffers;
+        std::vector<std::pair<size_t, size_t>> _ranges;
+        std::vector<Rep>                       _energies;
+        std::vector<VirialTensor<Rep>>         _virials;
+
+       public:
+        /**
+         * @brief Sets up the kernel for @p nThreads threads.
+         *
+         * @param nThreads number of threads including the calling one,
+         *        defaults to the hardware concurrency.
+         *
+         * @throws std::invalid_argument if @p nThreads is zero.
+         */
+        explicit ParallelPairForces(
+            const size_t nThreads = std::max(
+                size_t{1},
+                static_cast<size_t>(std::thread::hardware_concurrency())
+            )
+        )
+            : _nThreads(nThreads),
+              _buffers(nThreads),
+              _ranges(nThreads),
+              _energies(nThreads),
+              _virials(nThreads)
+        {
+            if (nThreads == 0)
+                throw std::invalid_argument(
+                    "ParallelPairForces requires nThreads > 0"
+                );
+
+            _pool = std::make_unique<ThreadPool>(nThreads);
+        }
+
+        /// @brief Returns the number of threads.
+        size_t nThreads() const { return _nThreads; }
+
+        /**
+         * @brief Computes the total pair energy and the forces on all
+         *        particles.
+         *
+         * Same contract as computePairForces; the calling thread works on
+         * the first chunk.
+         *
+         * @throws any exception of the potential, after all threads are
+         *         done.
+         *
+         * @pre all spans have the same size and @p source has been built or
+         *      updated with the given coordinates.
+         */
+        template <
+            PairKernelPath Path = PairKernelPath::Simd,
+            ChunkedPairSourceType Source,
+            PairKernelPotentialType Potential>
+            requires std::same_as<typename Source::rep, Rep> &&
+                     AccumulatesIn<typename Potential::rep, Rep>
+        Rep compute(
+            const Source&        source,
+            const Potential&     potential,
+            std::span<const Rep> x,
+            std::span<const Rep> y,
+            std::span<const Rep> z,
+            std::span<Rep>       fx,
+            std::span<Rep>       fy,
+            std::span<Rep>       fz
+        )
+        {
+            return _compute<false, Path>(
+                source,
+                potential,
+                x,
+                y,
+                z,
+                fx,
+                fy,
+                fz
+            );
+        }
+
+        /**
+         * @brief Computes the total pair energy, the forces and the pair
+         *        virial in one pass.
+         *
+         * Same contract as the computePairForces overload taking a
+         * VirialTensor; @p virial is overwritten.
+         */
+        template <
+            PairKernelPath Path = PairKernelPath::Simd,
+            ChunkedPairSourceType Source,
+            PairKernelPotentialType Potential>
+            requires std::same_as<typename Source::rep, Rep> &&
+                     AccumulatesIn<typename Potential::rep, Rep>
+        Rep compute(
+            const Source&        source,
+            const Potential&     potential,
+            std::span<const Rep> x,
+            std::span<const Rep> y,
+            std::span<const Rep> z,
+            std::span<Rep>       fx,
+            std::span<Rep>       fy,
+            std::span<Rep>       fz,
+            VirialTensor<Rep>&   virial
+        )
+        {
+            const auto energy = _compute<true, Path>(
+                source,
+                potential,
+                x,
+                y,
+                z,
+                fx,
+                fy,
+                fz
+            );
+
+            virial = {};
+            for (const auto& threadVirial : _virials)
+                virial += threadVirial;
+
+            return energy;
+        }
+
+       private:
+        template <
+            bool WithVirial,
+            PairKernelPath Path,
+            typename Source,
+            typename Potential>
+        Rep _compute(
+            const Source&        source,
+            const Potential&     potential,
+            std::span<const Rep> x,
+            std::span<const Rep> y,
+            std::span<const Rep> z,
+            std::span<Rep>       fx,
+            std::span<Rep>       fy,
+            std::span<Rep>       fz
+        )
+        {
+            using Virial = std::conditional_t<
+                WithVirial,
+                VirialTensor<Rep>,
+                details::NoVirial<Rep>>;
+
+            assert(x.size() == y.size() && x.size() == z.size());
+            assert(fx.size() == x.size());
+            assert(fy.size() == x.size() && fz.size() == x.size());
+
+            const size_t nParticles = x.size();
+
+            for (auto& buffer : _buffers)
+                buffer.resize(3 * nParticles);
+
+            _pool->run(
+                [&](const size_t thread)
+                {
+                    const auto [begin, end] =
+                        _chunkRange(source, thread, nParticles);
+                    _ranges[thread] = {begin, end};
+
+                    const std::span<Rep> buffer(_buffers[thread]);
+
+                    const auto bx = buffer.subspan(0, nParticles);
+                    const auto by = buffer.subspan(nParticles, nParticles);
+                    const auto bz = buffer.subspan(2 * nParticles, nParticles);
+
+                    std::ranges::fill(bx.subspan(begin, end - begin), 0);
+                    std::ranges::fill(by.subspan(begin, end - begin), 0);
+                    std::ranges::fill(bz.subspan(begin, end - begin), 0);
+
+                    Virial virial{};
+
+                    _energies[thread] = _accumulateChunk<Path>(
+                        source,
+                        potential,
+                        thread,
+                        x,
+                        y,
+                        z,
+                        bx,
+                        by,
+                        bz,
+                        virial
+                    );
+
+                    if constexpr (WithVirial)
+                        _virials[thread] = virial;
+                }
+            );
+
+            _pool->run(
+                [&](const size_t thread)
+                { _reduceSlice(thread, nParticles, fx, fy, fz); }
+            );
+
+            return std::accumulate(_energies.begin(), _energies.end(), Rep{});
+        }
+
+        /// particles touched by chunk @p chunk, all of them if unknown
+        template <typename Source>
+        std::pair<size_t, size_t> _chunkRange(
+            const Source& source,
+            const size_t  chunk,
+            const size_t  nParticles
+        ) const
+        {
+            if constexpr (details::RangedChunkSource<Source>)
+                return source.chunkParticleRange(chunk, _nThreads, nParticles);
+            else
+                return {0, nParticles};
+        }
+
+        template <
+            PairKernelPath Path,
+            typename Source,
+            typename Potential,
+            typename Virial>
+        Rep _accumulateChunk(
+            const Source&        source,
+            const Potential&     potential,
+            const size_t         chunk,
+            std::span<const Rep> x,
+            std::span<const Rep> y,
+            std::span<const Rep> z,
+            std::span<Rep>       fx,
+            std::span<Rep>       fy,
+            std::span<Rep>       fz,
+            Virial&              virial
+        ) const
+        {
+            if constexpr (Path == PairKernelPath::Simd &&
+                          details::CandidateRowChunkSource<Source>)
+                return details::accumulateRowForces(
+                    potential,
+                    source.box(),
+                    source.cutoff(),
+                    x,
+                    y,
+                    z,
+                    fx,
+                    fy,
+                    fz,
+                    virial,
+                    [&](auto&& callback)
+                    {
+                        source.forEachCandidateRowInChunk(
+                            chunk,
+                            _nThreads,
+                            callback
+                        );
+                    }
+                );
+            else
+                return details::accumulatePairForces<Path>(
+                    potential,
+                    fx,
+                    fy,
+                    fz,
+                    virial,
+                    [&](auto&& callback)
+                    {
+                        source.forEachPairInChunk(
+                            chunk,
+                            _nThreads,
+                            x,
+                            y,
+                            z,
+                            callback
+                        );
+                    }
+                );
+        }
+
+        /// sums the private buffers of all threads for one particle slice
+        void _reduceSlice(
+            const size_t   thread,
+            const size_t   nParticles,
+            std::span<Rep> fx,
+            std::span<Rep> fy,
+            std::span<Rep> fz
+        ) const
+        {
+            const auto begin = nParticles * thread / _nThreads;
+            const auto end   = nParticles * (thread + 1) / _nThreads;
+
+            std::ranges::fill(fx.subspan(begin, end - begin), 0);
+            std::ranges::fill(fy.subspan(begin, end - begin), 0);
+            std::ranges::fill(fz.subspan(begin, end - begin), 0);
+
+            // buffer by buffer keeps the inner loops streaming
+            for (size_t t = 0; t < _nThreads; ++t)
+            {
+                const auto& buffer = _buffers[t];
+
+                const auto first = std::max(begin, _ranges[t].first);
+                const auto last  = std::min(end, _ranges[t].second);
+
+                for (size_t i = first; i < last; ++i)
+                {
+                    fx[i] += buffer[i];
+                    fy[i] += buffer[nParticles + i];
+                    fz[i] += buffer[2 * nParticles + i];
+                }
+            }
+        }
+    };
+
+}   // namespace mstd
+
+#endif   // __MSTD__PHYSICS__PARALLEL_PAIR_FORCES_HPP__
@@ -0,0 +1,155 @@
+/*****************************************************************************
+<GPL_HEADER>
+
+    mstd library
+    Copyright (C) 2025-now  Jakob Gamper
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+<GPL_HEADER>
+******************************************************************************/
+
+#ifndef __MSTD__PHYSICS__PARTICLES_HPP__
+#define __MSTD__PHYSICS__PARTICLES_HPP__
+
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <span>
+#include <stdexcept>
+
+#include "mstd/memory.hpp"
+#include "mstd/simd.hpp"
+
+namespace mstd
+{
+    /**
+     * @brief SoA storage of particle positions, velocities, forces and
+     *        masses.
+     *
+     * Every component lives in its own cache line aligned array, so the
+     * integrators stream them with full SIMD vectors. Masses are kept
+     * together with their inverses, which the integrators use instead of
+     * dividing every step.
+     *
+     * @tparam Rep floating point representation.
+     */
+    template <std::floating_point Rep = double>
+    class ParticleArrays
+    {
+       public:
+        using rep = Rep;
+
+        AlignedVector<Rep> x, y, z;
+        AlignedVector<Rep> vx, vy, vz;
+        AlignedVector<Rep> fx, fy, fz;
+
+       private:
+        AlignedVector<Rep> _masses;
+        AlignedVector<Rep> _inverseMasses;
+
+       public:
+        /**
+         * @brief Creates @p n particles at rest at the origin with equal
+         *        @p mass.
+         *
+         * @throws std::invalid_argument unless mass > 0.
+         */
+        explicit ParticleArrays(const size_t n, const Rep mass = 1)
+            : x(n),
+              y(n),
+              z(n),
+              vx(n),
+              vy(n),
+              vz(n),
+              fx(n),
+              fy(n),
+              fz(n),
+              _masses(n, mass),
+              _inverseMasses(n, 1 / mass)
+        {
+            if (!(mass > 0))
+                throw std::invalid_argument(
+                    "ParticleArrays requires mass > 0"
+                );
+        }
+
+        /// @brief Returns the number of particles.
+        size_t size() const { return x.size(); }
+
+        /// @brief Returns the particle masses.
+        std::span<const Rep> masses() const { return _masses; }
+
+        /// @brief Returns the inverse particle masses.
+        std::span<const Rep> inverseMasses() const { return _inverseMasses; }
+
+        /**
+         * @brief Replaces all particle masses.
+         *
+         * @throws std::invalid_argument if the size does not match or a
+         *         mass is not positive.
+         */
+        void setMasses(std::span<const Rep> masses)
+        {
+            if (masses.size() != size())
+                throw std::invalid_argument(
+                    "ParticleArrays::setMasses requires one mass per particle"
+                );
+            if (!std::ranges::all_of(masses, [](Rep m) { return m > 0; }))
+                throw std::invalid_argument(
+                    "ParticleArrays::setMasses requires masses > 0"
+                );
+
+            std::ranges::copy(masses, _masses.begin());
+            std::ranges::transform(
+                masses,
+                _inverseMasses.begin(),
+                [](const Rep m) { return 1 / m; }
+            );
+        }
+
+        /// @brief Returns the kinetic energy \f$\sum_i m_i v_i^2 / 2\f$.
+        Rep kineticEnergy() const
+        {
+            using V                = SimdVec<Rep>;
+            constexpr size_t width = simd_size_v<V>;
+
+            const size_t n       = size();
+            const size_t vectors = n - n % width;
+
+            V   sum{};
+            Rep tail{};
+
+            for (size_t i = 0; i < vectors; i += width)
+            {
+                const auto u = simdLoad<V>(vx.data() + i);
+                const auto v = simdLoad<V>(vy.data() + i);
+                const auto w = simdLoad<V>(vz.data() + i);
+
+                const auto m = simdLoad<V>(_masses.data() + i);
+
+                sum += m * (u * u + v * v + w * w);
+            }
+
+            for (size_t i = vectors; i < n; ++i)
+                tail += _masses[i] *
+                        (vx[i] * vx[i] + vy[i] * vy[i] + vz[i] * vz[i]);
+
+            return (simdReduceAdd(sum) + tail) / 2;
+        }
+    };
+
+}   // namespace mstd
+
+#endif   // __MSTD__PHYSICS__PARTICLES_HPP__
@@ -23,6 +23,17 @@
 #ifndef __MSTD__PHYSICS__POTENTIALS_HPP__
 #define __MSTD__PHYSICS__POTENTIALS_HPP__
 
-#include "potentials/lie_potential.hpp"   // IWYU pragma: export
+#include "potentials/any_potential.hpp"            // IWYU pragma: export
+#include "potentials/charged_pair_potential.hpp"   // IWYU pragma: export
+#include "potentials/coulomb_potential.hpp"        // IWYU pragma: export
+#include "potentials/exponential_potential.hpp"    // IWYU pragma: export
+#include "potentials/lie_potential.hpp"            // IWYU pragma: export
+#include "potentials/mixed_precision.hpp"          // IWYU pragma: export
+#include "potentials/pair_distance.hpp"            // IWYU pragma: export
+#include "potentials/potential_base.hpp"           // IWYU pragma: export
+#include "potentials/species_pair_table.hpp"       // IWYU pragma: export
+#include "potentials/static_lie_potential.hpp"     // IWYU pragma: export
+#include "potentials/sum_potential.hpp"            // IWYU pragma: export
+#include "potentials/tabulated_potential.hpp"      // IWYU pragma: export
 
 #endif   // __MSTD__PHYSICS__POTENTIALS_HPP__
\ No newline at end of file
@@ -0,0 +1,226 @@
+/*****************************************************************************
+<GPL_HEADER>
+
+    mstd library
+    Copyright (C) 2025-now  Jakob Gamper
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+<GPL_HEADER>
+******************************************************************************/
+
+#ifndef __MSTD__PHYSICS__POTENTIALS__ANY_POTENTIAL_HPP__
+#define __MSTD__PHYSICS__POTENTIALS__ANY_POTENTIAL_HPP__
+
+#include <memory>
+#include <span>
+#include <type_traits>
+#include <utility>
+
+#include "mstd/type_traits/physics_traits.hpp"
+
+namespace mstd
+{
+    namespace details
+    {
+        /**
+         * @brief Runtime interface behind AnyPotential.
+         *
+         * @tparam Rep numeric representation.
+         */
+        template <typename Rep>
+        class AnyPotentialConcept
+        {
+           public:
+            virtual                     ~AnyPotentialConcept()   = default;
+            virtual Rep                 evalEnergy(Rep r) const  = 0;
+            virtual Rep                 evalForce(Rep r) const   = 0;
+            virtual std::pair<Rep, Rep> eval(Rep r) const        = 0;
+            virtual std::pair<Rep, Rep> evalFromR2(Rep r2) const = 0;
+
+            virtual void evalBatch(
+                std::span<const Rep> r,
+                std::span<Rep>       energy,
+                std::span<Rep>       force
+            ) const = 0;
+
+            virtual void evalBatchFromR2(
+                std::span<const Rep> r2,
+                std::span<Rep>       energy,
+                std::span<Rep>       forceOverR
+            ) const = 0;
+
+            virtual std::unique_ptr<AnyPotentialConcept> clone() const = 0;
+        };
+
+        /**
+         * @brief Adapter storing a concrete potential by value.
+         *
+         * @tparam P concrete potential type.
+         */
+        template <PairPotentialType P>
+        class AnyPotentialModel final
+            : public AnyPotentialConcept<typename P::rep>
+        {
+           private:
+            using Rep = typename P::rep;
+
+            P _potential;
+
+           public:
+            explicit AnyPotentialModel(P potential)
+                : _potential(std::move(potential))
+            {
+            }
+
+            Rep evalEnergy(Rep r) const override
+            {
+                return _potential.evalEnergy(r);
+            }
+
+            Rep evalForce(Rep r) const override
+            {
+                return _potential.evalForce(r);
+            }
+
+            std::pair<Rep, Rep> eval(Rep r) const override
+            {
+                return _potential.eval(r);
+            }
+
+            std::pair<Rep, Rep> evalFromR2(Rep r2) const override
+            {
+                return _potential.evalFromR2(r2);
+            }
+
+            void evalBatch(
+                std::span<const Rep> r,
+                std::span<Rep>       energy,
+                std::span<Rep>       force
+            ) const override
+            {
+                _potential.evalBatch(r, energy, force);
+            }
+
+            void evalBatchFromR2(
+                std::span<const Rep> r2,
+                std::span<Rep>       energy,
+                std::span<Rep>       forceOverR
+            ) const override
+            {
+                _potential.evalBatchFromR2(r2, energy, forceOverR);
+            }
+
+            std::unique_ptr<AnyPotentialConcept<Rep>> clone() const override
+            {
+                return std::make_unique<AnyPotentialModel>(_potential);
+            }
+        };
+
+    }   // namespace details
+
+    /**
+     * @brief Type-erased pair potential with value semantics.
+     *
+     * Wraps any type satisfying PairPotentialType for the rare cases where the
+     * potential is only known at runtime. Every scalar call costs one indirect
+     * branch, so pair loops should prefer evalBatch, which dispatches once per
+     * batch and runs the inlined kernel of the wrapped potential.
+     *
+     * @tparam Rep numeric representation.
+     */
+    template <typename Rep = double>
+    class AnyPotential
+    {
+       private:
+        std::unique_ptr<details::AnyPotentialConcept<Rep>> _impl;
+
+       public:
+        using rep = Rep;
+
+        /**
+         * @brief Wraps a copy of @p potential.
+         *
+         * @tparam P concrete potential type.
+         * @param potential
+         */
+        template <PairPotentialType P>
+        requires(
+            std::is_same_v<typename P::rep, Rep> &&
+            !std::is_same_v<std::remove_cvref_t<P>, AnyPotential>
+        )
+        AnyPotential(P potential)   // NOLINT(google-explicit-constructor)
+            : _impl(std::make_unique<details::AnyPotentialModel<P>>(
+                  std::move(potential)
+              ))
+        {
+        }
+
+        AnyPotential(const AnyPotential& other)
+            : _impl(other._impl ? other._impl->clone() : nullptr)
+        {
+        }
+
+        AnyPotential(AnyPotential&&) noexcept = default;
+
+        AnyPotential& operator=(const AnyPotential& other)
+        {
+            if (this != &other)
+                _impl = other._impl ? other._impl->clone() : nullptr;
+            return *this;
+        }
+
+        AnyPotential& operator=(AnyPotential&&) noexcept = default;
+
+        ~AnyPotential() = default;
+
+        /// @brief Evaluates only the potential energy at a distance @p r.
+        Rep evalEnergy(const Rep r) const { return _impl->evalEnergy(r); }
+
+        /// @brief Evaluates only the force magnitude at a distance @p r.
+        Rep evalForce(const Rep r) const { return _impl->evalForce(r); }
+
+        /// @brief Returns both energy and force evaluated at @p r.
+        std::pair<Rep, Rep> eval(const Rep r) const { return _impl->eval(r); }
+
+        /// @brief Returns energy and force over distance from @p r2.
+        std::pair<Rep, Rep> evalFromR2(const Rep r2) const
+        {
+            return _impl->evalFromR2(r2);
+        }
+
+        /// @brief Evaluates energy and force for every distance in @p r.
+        void evalBatch(
+            std::span<const Rep> r,
+            std::span<Rep>       energy,
+            std::span<Rep>       force
+        ) const
+        {
+            _impl->evalBatch(r, energy, force);
+        }
+
+        /// @brief Batch counterpart of evalFromR2.
+        void evalBatchFromR2(
+            std::span<const Rep> r2,
+            std::span<Rep>       energy,
+            std::span<Rep>       forceOverR
+        ) const
+        {
+            _impl->evalBatchFromR2(r2, energy, forceOverR);
+        }
+    };
+
+}   // namespace mstd
+
+#endif   // __MSTD__PHYSICS__POTENTIALS__ANY_POTENTIAL_HPP__
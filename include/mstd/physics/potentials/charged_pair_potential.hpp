@@ -0,0 +1,242 @@
+/*****************************************************************************
+<GPL_HEADER>
+
+    mstd library
+    Copyright (C) 2025-now  Jakob Gamper
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+<GPL_HEADER>
+******************************************************************************/
+
+#ifndef __MSTD__PHYSICS__POTENTIALS__CHARGED_PAIR_POTENTIAL_HPP__
+#define __MSTD__PHYSICS__POTENTIALS__CHARGED_PAIR_POTENTIAL_HPP__
+
+#include <cassert>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <variant>
+
+#include "mstd/simd.hpp"
+#include "mstd/type_traits/physics_traits.hpp"
+
+namespace mstd
+{
+    /**
+     * @brief Coulomb interaction of per-particle charges, optionally fused
+     *        with a short-range potential.
+     *
+     * Evaluates \f$q_i q_j E_C(r) + E_{SR}(r)\f$ for the particle pair
+     * \f$(i, j)\f$, where @p Coulomb is one of the Coulomb potentials with
+     * its prefactor set to the electrostatic constant and @p ShortRange is
+     * e.g. a StaticLJPotential or a SpeciesPairPotential. Both are
+     * evaluated from the same squared distance in a single pass of the pair
+     * kernels, so charged Lennard-Jones systems need neither two kernel
+     * calls nor a second traversal of the pair source.
+     *
+     * The batch evaluation gathers the charges per lane and evaluates
+     * Coulomb and a statically dispatched short-range part in the same
+     * vector loop. Short-range potentials without lane-generic entry points
+     * (virtual or indexed ones) are evaluated in a separate batch first.
+     *
+     * @note Only a view of the charges is stored; they have to outlive the
+     *       potential.
+     *
+     * @tparam Coulomb static Coulomb potential, e.g. CoulombDSFPotential.
+     * @tparam ShortRange short-range potential or `void` for none.
+     */
+    template <typename Coulomb, typename ShortRange = void>
+        requires PairPotentialType<Coulomb> &&
+                 (std::is_void_v<ShortRange> ||
+                  PairKernelPotentialType<ShortRange>)
+    class ChargedPairPotential
+    {
+       public:
+        using rep = typename Coulomb::rep;
+
+       private:
+        static constexpr bool _hasShortRange = !std::is_void_v<ShortRange>;
+
+        using ShortRangeStorage =
+            std::conditional_t<_hasShortRange, ShortRange, std::monostate>;
+
+        Coulomb                                 _coulomb;
+        [[no_unique_address]] ShortRangeStorage _shortRange;
+        std::span<const rep>                    _charges;
+
+        /// @brief whether the short-range part is evaluated lane-wise
+        static constexpr bool _fusedShortRange =
+            _hasShortRange &&
+            requires(const ShortRangeStorage p, SimdVec<rep> r2) {
+                p.template evalFromR2<SimdVec<rep>>(r2);
+            };
+
+       public:
+        /**
+         * @brief Builds the pure Coulomb interaction of the @p charges.
+         */
+        ChargedPairPotential(
+            const Coulomb&       coulomb,
+            std::span<const rep> charges
+        )
+            requires(!_hasShortRange)
+            : _coulomb(coulomb), _charges(charges)
+        {
+        }
+
+        /**
+         * @brief Builds the Coulomb interaction of the @p charges fused with
+         *        the short-range potential @p shortRange.
+         */
+        ChargedPairPotential(
+            const Coulomb&           coulomb,
+            std::span<const rep>     charges,
+            const ShortRangeStorage& shortRange
+        )
+            requires _hasShortRange
+            : _coulomb(coulomb), _shortRange(shortRange), _charges(charges)
+        {
+            static_assert(
+                std::is_same_v<typename ShortRangeStorage::rep, rep>,
+                "Coulomb and short-range potential need the same rep"
+            );
+        }
+
+        /// @brief Returns the Coulomb part.
+        const Coulomb& coulomb() const { return _coulomb; }
+
+        /// @brief Returns the short-range part.
+        const ShortRangeStorage& shortRange() const
+            requires _hasShortRange
+        {
+            return _shortRange;
+        }
+
+        /// @brief Returns the charge of particle @p i.
+        rep charge(const size_t i) const { return _charges[i]; }
+
+        /**
+         * @brief Returns energy and force over distance of the particles
+         *        @p i and @p j at the squared distance @p r2.
+         */
+        std::pair<rep, rep> evalFromR2(
+            const size_t i,
+            const size_t j,
+            const rep    r2
+        ) const
+        {
+            const auto qq = _charges[i] * _charges[j];
+
+            auto [energy, forceOverR] = _coulomb.evalFromR2(r2);
+            energy                   *= qq;
+            forceOverR               *= qq;
+
+            if constexpr (IndexedPairPotentialType<ShortRange>)
+            {
+                const auto [e, f]  = _shortRange.evalFromR2(i, j, r2);
+                energy            += e;
+                forceOverR        += f;
+            }
+            else if constexpr (_hasShortRange)
+            {
+                const auto [e, f]  = _shortRange.evalFromR2(r2);
+                energy            += e;
+                forceOverR        += f;
+            }
+
+            return {energy, forceOverR};
+        }
+
+        /**
+         * @brief Batch counterpart of evalFromR2 for the particle pairs
+         *        (`i[k]`, `j[k]`).
+         *
+         * @pre all spans hold at least `r2.size()` entries.
+         */
+        void evalBatchFromR2(
+            std::span<const size_t> i,
+            std::span<const size_t> j,
+            std::span<const rep>    r2,
+            std::span<rep>          energy,
+            std::span<rep>          forceOverR
+        ) const
+        {
+            assert(i.size() >= r2.size() && j.size() >= r2.size());
+            assert(energy.size() >= r2.size());
+            assert(forceOverR.size() >= r2.size());
+
+            // short-range parts that cannot be evaluated lane-wise fill the
+            // outputs first, the Coulomb loop then adds to them
+            constexpr bool accumulate = _hasShortRange && !_fusedShortRange;
+
+            if constexpr (IndexedPairPotentialType<ShortRange>)
+                _shortRange.evalBatchFromR2(i, j, r2, energy, forceOverR);
+            else if constexpr (accumulate)
+                _shortRange.evalBatchFromR2(r2, energy, forceOverR);
+
+            const auto kernel = [&]<typename T>(const size_t k)
+            {
+                const auto qq =
+                    simdGather<T>(_charges.data(), i.data() + k) *
+                    simdGather<T>(_charges.data(), j.data() + k);
+
+                const auto x = simdLoad<T>(r2.data() + k);
+
+                auto [e, f] = _coulomb.template evalFromR2<T>(x);
+                e           = e * qq;
+                f           = f * qq;
+
+                if constexpr (_fusedShortRange)
+                {
+                    const auto [es, fs] =
+                        _shortRange.template evalFromR2<T>(x);
+                    e = e + es;
+                    f = f + fs;
+                }
+                else if constexpr (accumulate)
+                {
+                    e = e + simdLoad<T>(energy.data() + k);
+                    f = f + simdLoad<T>(forceOverR.data() + k);
+                }
+
+                simdStore(energy.data() + k, e);
+                simdStore(forceOverR.data() + k, f);
+            };
+
+            using V = SimdVec<rep>;
+
+            constexpr auto width   = simd_size_v<V>;
+            const auto     size    = r2.size();
+            const auto     vectors = size - size % width;
+
+            for (size_t k = 0; k < vectors; k += width)
+                kernel.template operator()<V>(k);
+
+            for (size_t k = vectors; k < size; ++k)
+                kernel.template operator()<rep>(k);
+        }
+    };
+
+    template <typename Coulomb, typename Charges>
+    ChargedPairPotential(const Coulomb&, const Charges&)
+        -> ChargedPairPotential<Coulomb>;
+
+    template <typename Coulomb, typename Charges, typename ShortRange>
+    ChargedPairPotential(const Coulomb&, const Charges&, const ShortRange&)
+        -> ChargedPairPotential<Coulomb, ShortRange>;
+
+}   // namespace mstd
+
+#endif   // __MSTD__PHYSICS__POTENTIALS__CHARGED_PAIR_POTENTIAL_HPP__
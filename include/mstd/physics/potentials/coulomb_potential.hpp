@@ -0,0 +1,575 @@
+/*****************************************************************************
+<GPL_HEADER>
+
+    mstd library
+    Copyright (C) 2025-now  Jakob Gamper
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+<GPL_HEADER>
+******************************************************************************/
+
+#ifndef __MSTD__PHYSICS__POTENTIALS__COULOMB_POTENTIAL_HPP__
+#define __MSTD__PHYSICS__POTENTIALS__COULOMB_POTENTIAL_HPP__
+
+#include <cmath>
+#include <numbers>
+#include <numeric>
+#include <span>
+#include <stdexcept>
+#include <tuple>
+#include <utility>
+
+#include "coulomb_potential_impl.hpp"
+#include "force_shift.hpp"
+#include "mstd/simd.hpp"
+#include "pair_distance.hpp"
+#include "potential_base.hpp"
+
+namespace mstd
+{
+    namespace details
+    {
+        /**
+         * @brief Coulomb self energy \f$-\frac{c}{2} s \sum_i q_i^2\f$ of
+         *        the cutoff based electrostatics below.
+         */
+        template <typename Rep>
+        Rep coulombSelfEnergy(
+            const Rep            c,
+            const Rep            s,
+            std::span<const Rep> charges
+        )
+        {
+            const auto sumQ2 = std::inner_product(
+                charges.begin(),
+                charges.end(),
+                charges.begin(),
+                Rep{}
+            );
+
+            return -c * s * sumQ2 / 2;
+        }
+
+        /// @brief Throws unless the cutoff radius @p rc is positive.
+        template <typename Rep>
+        void checkCoulombCutoff(const Rep rc, const char* message)
+        {
+            if (!(rc > 0))
+                throw std::invalid_argument(message);
+        }
+
+    }   // namespace details
+
+    /**
+     * @brief Bare Coulomb potential \f$E = c / r\f$.
+     *
+     * The prefactor \f$c\f$ combines the electrostatic constant of the unit
+     * system and, for a single pair, the charge product \f$q_i q_j\f$. Use
+     * ChargedPairPotential to take the charges per particle.
+     *
+     * As for LiePotential, the reported force is \f$dE/dr = -c / r^2\f$.
+     */
+    template <typename Rep = double>
+    class CoulombPotential : public PotentialBase<CoulombPotential<Rep>, Rep>
+    {
+       private:
+        friend class PotentialBase<CoulombPotential<Rep>, Rep>;
+
+        Rep _coeff{};
+
+       public:
+        /// @brief Constructs the potential from its prefactor @p c.
+        constexpr explicit CoulombPotential(Rep c) : _coeff(c) {}
+
+        /// @brief Returns the prefactor.
+        constexpr Rep coeff() const { return _coeff; }
+
+       private:
+        template <typename T>
+        constexpr std::pair<T, T> evalImpl(const T r) const
+        {
+            const auto invR   = 1 / r;
+            const auto energy = simdBroadcast<T>(_coeff) * invR;
+
+            return {energy, -energy * invR};
+        }
+
+        template <typename T>
+        std::pair<T, T> evalFromR2Impl(const T r2) const
+        {
+            return coulombFromR2<T>(simdBroadcast<T>(_coeff), r2);
+        }
+
+        template <typename T>
+        constexpr std::pair<T, T> evalFromDistanceImpl(
+            const PairDistance<T>& d
+        ) const
+        {
+            return coulombFromDistance<T>(simdBroadcast<T>(_coeff), d);
+        }
+    };
+
+    /**
+     * @brief Shifted-force Coulomb potential.
+     *
+     * Energy and force are shifted like in LieShiftedPotential so that both
+     * vanish at the cutoff:
+     * \f$E = c (1/r - 1/r_c + (r - r_c) / r_c^2)\f$. This is the undamped
+     * limit \f$\alpha = 0\f$ of CoulombDSFPotential.
+     */
+    template <typename Rep = double>
+    class CoulombShiftedPotential
+        : public PotentialBase<CoulombShiftedPotential<Rep>, Rep>
+    {
+       private:
+        friend class PotentialBase<CoulombShiftedPotential<Rep>, Rep>;
+
+        CoulombPotential<Rep> _potential;
+
+        details::ForceShift<Rep> _shift;
+
+       public:
+        /**
+         * @brief Builds the shifted potential from prefactor and cutoff
+         *        radius.
+         *
+         * @throws std::invalid_argument unless rc > 0.
+         */
+        CoulombShiftedPotential(Rep c, Rep rc) : _potential(c)
+        {
+            details::checkCoulombCutoff(
+                rc,
+                "CoulombShiftedPotential requires rc > 0"
+            );
+
+            _shift.radialCutoff = rc;
+            std::tie(_shift.energyCutoff, _shift.forceCutoff) =
+                _potential.eval(rc);
+        }
+
+        /// @brief Returns the prefactor.
+        constexpr Rep coeff() const { return _potential.coeff(); }
+
+        /// @brief Returns the radial cutoff.
+        constexpr Rep radialCutoff() const { return _shift.radialCutoff; }
+
+        /**
+         * @brief Returns the self energy
+         *        \f$-\frac{c}{2 r_c} \sum_i q_i^2\f$ of the @p charges.
+         */
+        Rep selfEnergy(std::span<const Rep> charges) const
+        {
+            return details::coulombSelfEnergy(
+                coeff(),
+                1 / _shift.radialCutoff,
+                charges
+            );
+        }
+
+       private:
+        template <typename T>
+        constexpr std::pair<T, T> evalImpl(const T r) const
+        {
+            return _shift.apply(_potential.template eval<T>(r), r);
+        }
+
+        template <typename T>
+        std::pair<T, T> evalFromR2Impl(const T r2) const
+        {
+            return evalFromDistanceImpl<T>(PairDistance<T>::fromR2(r2));
+        }
+
+        template <typename T>
+        constexpr std::pair<T, T> evalFromDistanceImpl(
+            const PairDistance<T>& d
+        ) const
+        {
+            return _shift.applyFromDistance(
+                _potential.template evalFromDistance<T>(d),
+                d
+            );
+        }
+    };
+
+    /**
+     * @brief Reaction-field Coulomb potential.
+     *
+     * Treats the surroundings beyond the cutoff as a dielectric continuum
+     * with permittivity \f$\epsilon_{rf}\f$:
+     * \f$E = c (1/r + k_{rf} r^2 - c_{rf})\f$ with
+     * \f$k_{rf} = (\epsilon_{rf} - 1) / ((2 \epsilon_{rf} + 1) r_c^3)\f$ and
+     * \f$c_{rf} = 1/r_c + k_{rf} r_c^2\f$, so the energy vanishes at the
+     * cutoff. An infinite \f$\epsilon_{rf}\f$ gives the conducting boundary
+     * \f$k_{rf} = 1 / (2 r_c^3)\f$, for which the force vanishes as well.
+     */
+    template <typename Rep = double>
+    class CoulombReactionFieldPotential
+        : public PotentialBase<CoulombReactionFieldPotential<Rep>, Rep>
+    {
+       private:
+        friend class PotentialBase<CoulombReactionFieldPotential<Rep>, Rep>;
+
+        Rep _coeff{};
+        Rep _radialCutoff{};
+        Rep _kRF{};
+        Rep _cRF{};
+
+       public:
+        /**
+         * @brief Builds the reaction-field potential from prefactor, cutoff
+         *        radius and the permittivity of the continuum.
+         *
+         * @throws std::invalid_argument unless rc > 0 and epsilonRF >= 1.
+         */
+        CoulombReactionFieldPotential(Rep c, Rep rc, Rep epsilonRF)
+            : _coeff(c), _radialCutoff(rc)
+        {
+            details::checkCoulombCutoff(
+                rc,
+                "CoulombReactionFieldPotential requires rc > 0"
+            );
+
+            if (!(epsilonRF >= 1))
+                throw std::invalid_argument(
+                    "CoulombReactionFieldPotential requires epsilonRF >= 1"
+                );
+
+            const auto ratio = std::isinf(epsilonRF)
+                                   ? Rep(0.5)
+                                   : (epsilonRF - 1) / (2 * epsilonRF + 1);
+
+            _kRF = ratio / (rc * rc * rc);
+            _cRF = 1 / rc + _kRF * rc * rc;
+        }
+
+        /// @brief Returns the prefactor.
+        constexpr Rep coeff() const { return _coeff; }
+
+        /// @brief Returns the radial cutoff.
+        constexpr Rep radialCutoff() const { return _radialCutoff; }
+
+        /// @brief Returns the reaction-field constant \f$k_{rf}\f$.
+        constexpr Rep reactionFieldConstant() const { return _kRF; }
+
+        /// @brief Returns the energy shift \f$c_{rf}\f$.
+        constexpr Rep energyShift() const { return _cRF; }
+
+        /**
+         * @brief Returns the self energy
+         *        \f$-\frac{c\,c_{rf}}{2} \sum_i q_i^2\f$ of the @p charges.
+         */
+        Rep selfEnergy(std::span<const Rep> charges) const
+        {
+            return details::coulombSelfEnergy(_coeff, _cRF, charges);
+        }
+
+       private:
+        template <typename T>
+        std::pair<T, T> evalImpl(const T r) const
+        {
+            const auto [energy, forceOverR] = evalFromR2Impl<T>(r * r);
+            return {energy, forceOverR * r};
+        }
+
+        template <typename T>
+        std::pair<T, T> evalFromR2Impl(const T r2) const
+        {
+            return coulombReactionFieldFromR2<T>(
+                simdBroadcast<T>(_coeff),
+                simdBroadcast<T>(_kRF),
+                simdBroadcast<T>(_cRF),
+                r2
+            );
+        }
+
+        template <typename T>
+        constexpr std::pair<T, T> evalFromDistanceImpl(
+            const PairDistance<T>& d
+        ) const
+        {
+            return coulombReactionFieldFromDistance<T>(
+                simdBroadcast<T>(_coeff),
+                simdBroadcast<T>(_kRF),
+                simdBroadcast<T>(_cRF),
+                d
+            );
+        }
+    };
+
+    /**
+     * @brief Real space part of the Ewald sum,
+     *        \f$E = c \, \mathrm{erfc}(\alpha r) / r\f$.
+     *
+     * Left unshifted, since the reciprocal space part (e.g.
+     * SmoothParticleMeshEwald) accounts for the interaction beyond the
+     * cutoff.
+     */
+    template <typename Rep = double>
+    class CoulombEwaldPotential
+        : public PotentialBase<CoulombEwaldPotential<Rep>, Rep>
+    {
+       private:
+        friend class PotentialBase<CoulombEwaldPotential<Rep>, Rep>;
+
+        Rep _coeff{};
+        Rep _alpha{};
+
+       public:
+        /**
+         * @brief Builds the potential from prefactor and splitting
+         *        parameter.
+         *
+         * @throws std::invalid_argument unless alpha > 0.
+         */
+        CoulombEwaldPotential(Rep c, Rep alpha) : _coeff(c), _alpha(alpha)
+        {
+            if (!(alpha > 0))
+                throw std::invalid_argument(
+                    "CoulombEwaldPotential requires alpha > 0"
+                );
+        }
+
+        /// @brief Returns the prefactor.
+        constexpr Rep coeff() const { return _coeff; }
+
+        /// @brief Returns the splitting parameter.
+        constexpr Rep alpha() const { return _alpha; }
+
+       private:
+        template <typename T>
+        std::pair<T, T> evalImpl(const T r) const
+        {
+            const auto [energy, forceOverR] = evalFromR2Impl<T>(r * r);
+            return {energy, forceOverR * r};
+        }
+
+        template <typename T>
+        std::pair<T, T> evalFromR2Impl(const T r2) const
+        {
+            return coulombDampedFromR2<T>(
+                simdBroadcast<T>(_coeff),
+                simdBroadcast<T>(_alpha),
+                r2
+            );
+        }
+
+        template <typename T>
+        std::pair<T, T> evalFromDistanceImpl(const PairDistance<T>& d) const
+        {
+            return coulombDampedFromDistance<T>(
+                simdBroadcast<T>(_coeff),
+                simdBroadcast<T>(_alpha),
+                d
+            );
+        }
+    };
+
+    /**
+     * @brief Damped shifted-force (DSF) Coulomb potential of Fennell and
+     *        Gezelter.
+     *
+     * The \f$\mathrm{erfc}(\alpha r) / r\f$ screened Coulomb interaction
+     * shifted like CoulombShiftedPotential, so energy and force vanish at
+     * the cutoff:
+     * \f$E = c \left(\mathrm{erfc}(\alpha r)/r - E_c - F_c (r - r_c)
+     * \right)\f$ with the screened energy \f$E_c\f$ and force \f$F_c\f$ at
+     * \f$r_c\f$. Together with selfEnergy it approximates Ewald sums without
+     * a reciprocal space part.
+     */
+    template <typename Rep = double>
+    class CoulombDSFPotential
+        : public PotentialBase<CoulombDSFPotential<Rep>, Rep>
+    {
+       private:
+        friend class PotentialBase<CoulombDSFPotential<Rep>, Rep>;
+
+        Rep _coeff{};
+        Rep _alpha{};
+
+        details::ForceShift<Rep> _shift;
+
+       public:
+        /**
+         * @brief Builds the DSF potential from prefactor, damping parameter
+         *        and cutoff radius.
+         *
+         * @throws std::invalid_argument unless alpha >= 0 and rc > 0.
+         */
+        CoulombDSFPotential(Rep c, Rep alpha, Rep rc)
+            : _coeff(c), _alpha(alpha)
+        {
+            details::checkCoulombCutoff(
+                rc,
+                "CoulombDSFPotential requires rc > 0"
+            );
+
+            if (!(alpha >= 0))
+                throw std::invalid_argument(
+                    "CoulombDSFPotential requires alpha >= 0"
+                );
+
+            const auto [energy, forceOverR] =
+                coulombDampedFromR2<Rep>(c, alpha, rc * rc);
+
+            _shift = {rc, energy, forceOverR * rc};
+        }
+
+        /// @brief Returns the prefactor.
+        constexpr Rep coeff() const { return _coeff; }
+
+        /// @brief Returns the damping parameter.
+        constexpr Rep alpha() const { return _alpha; }
+
+        /// @brief Returns the radial cutoff.
+        constexpr Rep radialCutoff() const { return _shift.radialCutoff; }
+
+        /**
+         * @brief Returns the self energy
+         *        \f$-c \left(\frac{\mathrm{erfc}(\alpha r_c)}{2 r_c} +
+         *        \frac{\alpha}{\sqrt{\pi}}\right) \sum_i q_i^2\f$ of the
+         *        @p charges.
+         */
+        Rep selfEnergy(std::span<const Rep> charges) const
+        {
+            const auto rc = _shift.radialCutoff;
+            const auto s  = simdErfc(_alpha * rc) / rc +
+                            2 * _alpha * std::numbers::inv_sqrtpi_v<Rep>;
+
+            return details::coulombSelfEnergy(_coeff, s, charges);
+        }
+
+       private:
+        template <typename T>
+        std::pair<T, T> evalImpl(const T r) const
+        {
+            const auto [energy, forceOverR] = evalFromR2Impl<T>(r * r);
+            return {energy, forceOverR * r};
+        }
+
+        template <typename T>
+        std::pair<T, T> evalFromR2Impl(const T r2) const
+        {
+            return evalFromDistanceImpl<T>(PairDistance<T>::fromR2(r2));
+        }
+
+        template <typename T>
+        std::pair<T, T> evalFromDistanceImpl(const PairDistance<T>& d) const
+        {
+            return _shift.applyFromDistance(
+                coulombDampedFromDistance<T>(
+                    simdBroadcast<T>(_coeff),
+                    simdBroadcast<T>(_alpha),
+                    d
+                ),
+                d
+            );
+        }
+    };
+
+    /**
+     * @brief Wolf summation: damped Coulomb potential shifted in energy only.
+     *
+     * \f$E = c \left(\mathrm{erfc}(\alpha r)/r - E_c\right)\f$. Unlike
+     * CoulombDSFPotential the force keeps a small jump at the cutoff, which
+     * makes it better suited for Monte Carlo than for MD.
+     */
+    template <typename Rep = double>
+    class CoulombWolfPotential
+        : public PotentialBase<CoulombWolfPotential<Rep>, Rep>
+    {
+       private:
+        friend class PotentialBase<CoulombWolfPotential<Rep>, Rep>;
+
+        Rep _coeff{};
+        Rep _alpha{};
+        Rep _radialCutoff{};
+        Rep _energyCutoff{};
+
+       public:
+        /**
+         * @brief Builds the Wolf potential from prefactor, damping parameter
+         *        and cutoff radius.
+         *
+         * @throws std::invalid_argument unless alpha >= 0 and rc > 0.
+         */
+        CoulombWolfPotential(Rep c, Rep alpha, Rep rc)
+            : _coeff(c), _alpha(alpha), _radialCutoff(rc)
+        {
+            details::checkCoulombCutoff(
+                rc,
+                "CoulombWolfPotential requires rc > 0"
+            );
+
+            if (!(alpha >= 0))
+                throw std::invalid_argument(
+                    "CoulombWolfPotential requires alpha >= 0"
+                );
+
+            _energyCutoff = coulombDampedFromR2<Rep>(c, alpha, rc * rc).first;
+        }
+
+        /// @brief Returns the prefactor.
+        constexpr Rep coeff() const { return _coeff; }
+
+        /// @brief Returns the damping parameter.
+        constexpr Rep alpha() const { return _alpha; }
+
+        /// @brief Returns the radial cutoff.
+        constexpr Rep radialCutoff() const { return _radialCutoff; }
+
+        /**
+         * @brief Returns the self energy
+         *        \f$-c \left(\frac{\mathrm{erfc}(\alpha r_c)}{2 r_c} +
+         *        \frac{\alpha}{\sqrt{\pi}}\right) \sum_i q_i^2\f$ of the
+         *        @p charges.
+         */
+        Rep selfEnergy(std::span<const Rep> charges) const
+        {
+            const auto s = simdErfc(_alpha * _radialCutoff) / _radialCutoff +
+                           2 * _alpha * std::numbers::inv_sqrtpi_v<Rep>;
+
+            return details::coulombSelfEnergy(_coeff, s, charges);
+        }
+
+       private:
+        template <typename T>
+        std::pair<T, T> evalImpl(const T r) const
+        {
+            const auto [energy, forceOverR] = evalFromR2Impl<T>(r * r);
+            return {energy, forceOverR * r};
+        }
+
+        template <typename T>
+        std::pair<T, T> evalFromR2Impl(const T r2) const
+        {
+            return evalFromDistanceImpl<T>(PairDistance<T>::fromR2(r2));
+        }
+
+        template <typename T>
+        std::pair<T, T> evalFromDistanceImpl(const PairDistance<T>& d) const
+        {
+            const auto [energy, forceOverR] = coulombDampedFromDistance<T>(
+                simdBroadcast<T>(_coeff),
+                simdBroadcast<T>(_alpha),
+                d
+            );
+
+            return {energy - simdBroadcast<T>(_energyCutoff), forceOverR};
+        }
+    };
+
+}   // namespace mstd
+
+#endif   // __MSTD__PHYSICS__POTENTIALS__COULOMB_POTENTIAL_HPP__
@@ -0,0 +1,153 @@
+/*****************************************************************************
+<GPL_HEADER>
+
+    mstd library
+    Copyright (C) 2025-now  Jakob Gamper
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+<GPL_HEADER>
+******************************************************************************/
+
+#ifndef __MSTD__PHYSICS__POTENTIALS__COULOMB_POTENTIAL_IMPL_HPP__
+#define __MSTD__PHYSICS__POTENTIALS__COULOMB_POTENTIAL_IMPL_HPP__
+
+#include <numbers>
+#include <utility>
+
+#include "mstd/simd.hpp"
+#include "pair_distance.hpp"
+
+namespace mstd
+{
+    /**
+     * @brief Bare Coulomb energy and force over distance evaluated from
+     *        shared powers of the distance.
+     *
+     * \f$E = c / r\f$ and \f$F / r = -c / r^3\f$, with the prefactor
+     * \f$c\f$ holding the charge product and the electrostatic constant.
+     *
+     * @note @p T may also be a `SimdVec`, in which case all lanes are
+     *       evaluated at once.
+     *
+     * @param c prefactor.
+     * @param d powers of the inter-particle distance.
+     * @return pair of energy and force over distance \f$F/r\f$.
+     */
+    template <typename T>
+    static inline constexpr std::pair<T, T> coulombFromDistance(
+        T                      c,
+        const PairDistance<T>& d
+    )
+    {
+        const auto energy = c * d.invR;
+
+        return {energy, -energy * d.invR2};
+    }
+
+    /// @brief coulombFromDistance evaluated from the squared distance.
+    template <typename T>
+    static inline std::pair<T, T> coulombFromR2(T c, T r2)
+    {
+        return coulombFromDistance(c, PairDistance<T>::fromR2(r2));
+    }
+
+    /**
+     * @brief Reaction-field Coulomb energy and force over distance evaluated
+     *        from shared powers of the distance.
+     *
+     * \f$E = c (1/r + k_{rf} r^2 - c_{rf})\f$ and
+     * \f$F / r = c (2 k_{rf} - 1/r^3)\f$.
+     *
+     * @param c prefactor.
+     * @param kRF reaction-field constant \f$k_{rf}\f$.
+     * @param cRF energy shift \f$c_{rf}\f$.
+     * @param d powers of the inter-particle distance.
+     * @return pair of energy and force over distance \f$F/r\f$.
+     */
+    template <typename T>
+    static inline constexpr std::pair<T, T> coulombReactionFieldFromDistance(
+        T                      c,
+        T                      kRF,
+        T                      cRF,
+        const PairDistance<T>& d
+    )
+    {
+        return {
+            c * (d.invR + kRF * d.r2 - cRF),
+            c * (kRF + kRF - d.invR * d.invR2)
+        };
+    }
+
+    /// @brief coulombReactionFieldFromDistance evaluated from @p r2.
+    template <typename T>
+    static inline std::pair<T, T> coulombReactionFieldFromR2(
+        T c,
+        T kRF,
+        T cRF,
+        T r2
+    )
+    {
+        return coulombReactionFieldFromDistance(
+            c,
+            kRF,
+            cRF,
+            PairDistance<T>::fromR2(r2)
+        );
+    }
+
+    /**
+     * @brief Damped Coulomb energy and force over distance evaluated from
+     *        shared powers of the distance.
+     *
+     * \f$E = c \, \mathrm{erfc}(\alpha r) / r\f$ and
+     * \f$F / r = -c \left(\mathrm{erfc}(\alpha r) / r + 2 \alpha
+     * e^{-\alpha^2 r^2} / \sqrt{\pi}\right) / r^2\f$, using the vectorized
+     * simdErfcAndExp approximation.
+     *
+     * @param c prefactor.
+     * @param alpha damping parameter \f$\alpha\f$.
+     * @param d powers of the inter-particle distance.
+     * @return pair of energy and force over distance \f$F/r\f$.
+     */
+    template <typename T>
+    static inline std::pair<T, T> coulombDampedFromDistance(
+        T                      c,
+        T                      alpha,
+        const PairDistance<T>& d
+    )
+    {
+        using Scalar = simd_scalar_t<T>;
+
+        constexpr auto twoOverSqrtPi = Scalar(2 * std::numbers::inv_sqrtpi);
+
+        const auto [erfc, gauss] = simdErfcAndExp(alpha * d.r);
+
+        const auto screened = erfc * d.invR;
+        const auto slope =
+            screened + simdBroadcast<T>(twoOverSqrtPi) * alpha * gauss;
+
+        return {c * screened, -c * slope * d.invR2};
+    }
+
+    /// @brief coulombDampedFromDistance evaluated from @p r2.
+    template <typename T>
+    static inline std::pair<T, T> coulombDampedFromR2(T c, T alpha, T r2)
+    {
+        return coulombDampedFromDistance(c, alpha, PairDistance<T>::fromR2(r2));
+    }
+
+}   // namespace mstd
+
+#endif   // __MSTD__PHYSICS__POTENTIALS__COULOMB_POTENTIAL_IMPL_HPP__
@@ -0,0 +1,453 @@
+/*****************************************************************************
+<GPL_HEADER>
+
+    mstd library
+    Copyright (C) 2025-now  Jakob Gamper
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+<GPL_HEADER>
+******************************************************************************/
+
+#ifndef __MSTD__PHYSICS__POTENTIALS__EXPONENTIAL_POTENTIAL_HPP__
+#define __MSTD__PHYSICS__POTENTIALS__EXPONENTIAL_POTENTIAL_HPP__
+
+#include <stdexcept>
+#include <tuple>
+#include <utility>
+
+#include "exponential_potential_impl.hpp"
+#include "force_shift.hpp"
+#include "mstd/simd.hpp"
+#include "pair_distance.hpp"
+#include "potential_base.hpp"
+
+namespace mstd
+{
+    namespace details
+    {
+        /// @brief Throws @p message unless @p value is positive.
+        template <typename Rep>
+        void checkPositive(const Rep value, const char* message)
+        {
+            if (!(value > 0))
+                throw std::invalid_argument(message);
+        }
+
+    }   // namespace details
+
+    /**
+     * @brief Morse potential
+     *        \f$E = D \left((1 - e^{-a (r - r_0)})^2 - 1\right)\f$.
+     *
+     * As for LiePotential, the reported force is \f$dE/dr\f$. The
+     * exponential is evaluated with simdExp, so the SIMD pair kernels run
+     * it on full vectors.
+     */
+    template <typename Rep = double>
+    class MorsePotential : public PotentialBase<MorsePotential<Rep>, Rep>
+    {
+       private:
+        friend class PotentialBase<MorsePotential<Rep>, Rep>;
+
+        Rep _wellDepth{};
+        Rep _width{};
+        Rep _equilibriumDistance{};
+
+       public:
+        /**
+         * @brief Constructs the potential.
+         *
+         * @param d well depth \f$D\f$.
+         * @param a width parameter \f$a\f$.
+         * @param r0 equilibrium distance \f$r_0\f$.
+         *
+         * @throws std::invalid_argument unless a > 0.
+         */
+        MorsePotential(Rep d, Rep a, Rep r0)
+            : _wellDepth(d), _width(a), _equilibriumDistance(r0)
+        {
+            details::checkPositive(a, "MorsePotential requires a > 0");
+        }
+
+        /// @brief Returns the well depth.
+        constexpr Rep wellDepth() const { return _wellDepth; }
+
+        /// @brief Returns the width parameter.
+        constexpr Rep width() const { return _width; }
+
+        /// @brief Returns the equilibrium distance.
+        constexpr Rep equilibriumDistance() const
+        {
+            return _equilibriumDistance;
+        }
+
+       private:
+        template <typename T>
+        std::pair<T, T> evalImpl(const T r) const
+        {
+            return morsePotential<T>(
+                simdBroadcast<T>(_wellDepth),
+                simdBroadcast<T>(_width),
+                simdBroadcast<T>(_equilibriumDistance),
+                r
+            );
+        }
+    };
+
+    /**
+     * @brief Born-Mayer repulsion \f$E = A e^{-r / \rho}\f$.
+     */
+    template <typename Rep = double>
+    class BornMayerPotential
+        : public PotentialBase<BornMayerPotential<Rep>, Rep>
+    {
+       private:
+        friend class PotentialBase<BornMayerPotential<Rep>, Rep>;
+
+        Rep _coeffA{};
+        Rep _rho{};
+        Rep _invRho{};
+
+       public:
+        /**
+         * @brief Constructs the potential from prefactor @p a and range
+         *        @p rho.
+         *
+         * @throws std::invalid_argument unless rho > 0.
+         */
+        BornMayerPotential(Rep a, Rep rho)
+            : _coeffA(a), _rho(rho), _invRho(1 / rho)
+        {
+            details::checkPositive(rho, "BornMayerPotential requires rho > 0");
+        }
+
+        /// @brief Returns the repulsive prefactor.
+        constexpr Rep coeffA() const { return _coeffA; }
+
+        /// @brief Returns the range of the repulsion.
+        constexpr Rep rho() const { return _rho; }
+
+       private:
+        template <typename T>
+        std::pair<T, T> evalImpl(const T r) const
+        {
+            return bornMayerPotential<T>(
+                simdBroadcast<T>(_coeffA),
+                simdBroadcast<T>(_invRho),
+                r
+            );
+        }
+    };
+
+    /**
+     * @brief Buckingham potential \f$E = A e^{-r / \rho} - C / r^6\f$.
+     *
+     * @note The energy diverges to \f$-\infty\f$ for \f$r \to 0\f$, so
+     *       particles must be kept outside the inner maximum.
+     */
+    template <typename Rep = double>
+    class BuckinghamPotential
+        : public PotentialBase<BuckinghamPotential<Rep>, Rep>
+    {
+       private:
+        friend class PotentialBase<BuckinghamPotential<Rep>, Rep>;
+
+        Rep _coeffA{};
+        Rep _rho{};
+        Rep _coeffC{};
+        Rep _invRho{};
+
+       public:
+        /**
+         * @brief Constructs the potential.
+         *
+         * @param a repulsive prefactor \f$A\f$.
+         * @param rho range of the repulsion \f$\rho\f$.
+         * @param c dispersion prefactor \f$C\f$.
+         *
+         * @throws std::invalid_argument unless rho > 0.
+         */
+        BuckinghamPotential(Rep a, Rep rho, Rep c)
+            : _coeffA(a), _rho(rho), _coeffC(c), _invRho(1 / rho)
+        {
+            details::checkPositive(
+                rho,
+                "BuckinghamPotential requires rho > 0"
+            );
+        }
+
+        /// @brief Returns the repulsive prefactor.
+        constexpr Rep coeffA() const { return _coeffA; }
+
+        /// @brief Returns the range of the repulsion.
+        constexpr Rep rho() const { return _rho; }
+
+        /// @brief Returns the dispersion prefactor.
+        constexpr Rep coeffC() const { return _coeffC; }
+
+       private:
+        template <typename T>
+        std::pair<T, T> evalImpl(const T r) const
+        {
+            return buckinghamPotential<T>(
+                simdBroadcast<T>(_coeffA),
+                simdBroadcast<T>(_invRho),
+                simdBroadcast<T>(_coeffC),
+                r
+            );
+        }
+
+        template <typename T>
+        std::pair<T, T> evalFromR2Impl(const T r2) const
+        {
+            return buckinghamFromR2<T>(
+                simdBroadcast<T>(_coeffA),
+                simdBroadcast<T>(_invRho),
+                simdBroadcast<T>(_coeffC),
+                r2
+            );
+        }
+
+        template <typename T>
+        std::pair<T, T> evalFromDistanceImpl(const PairDistance<T>& d) const
+        {
+            return buckinghamFromDistance<T>(
+                simdBroadcast<T>(_coeffA),
+                simdBroadcast<T>(_invRho),
+                simdBroadcast<T>(_coeffC),
+                d
+            );
+        }
+    };
+
+    /**
+     * @brief Shifted-force counterpart of MorsePotential.
+     *
+     * Energy and force are shifted like in LieShiftedPotential so that both
+     * vanish at the cutoff.
+     */
+    template <typename Rep = double>
+    class MorseShiftedPotential
+        : public PotentialBase<MorseShiftedPotential<Rep>, Rep>
+    {
+       private:
+        friend class PotentialBase<MorseShiftedPotential<Rep>, Rep>;
+
+        MorsePotential<Rep> _potential;
+
+        details::ForceShift<Rep> _shift;
+
+       public:
+        /**
+         * @brief Builds the shifted potential from well depth, width,
+         *        equilibrium distance and the cutoff radius.
+         *
+         * @throws std::invalid_argument unless rc > 0 and the parameters
+         *         are valid for MorsePotential.
+         */
+        MorseShiftedPotential(Rep d, Rep a, Rep r0, Rep rc)
+            : _potential(d, a, r0)
+        {
+            details::checkPositive(rc, "MorseShiftedPotential requires rc > 0");
+
+            _shift.radialCutoff = rc;
+            std::tie(_shift.energyCutoff, _shift.forceCutoff) =
+                _potential.eval(rc);
+        }
+
+        /// @brief Returns the well depth.
+        constexpr Rep wellDepth() const { return _potential.wellDepth(); }
+
+        /// @brief Returns the width parameter.
+        constexpr Rep width() const { return _potential.width(); }
+
+        /// @brief Returns the equilibrium distance.
+        constexpr Rep equilibriumDistance() const
+        {
+            return _potential.equilibriumDistance();
+        }
+
+        /// @brief Returns the radial cutoff.
+        constexpr Rep radialCutoff() const { return _shift.radialCutoff; }
+
+       private:
+        template <typename T>
+        std::pair<T, T> evalImpl(const T r) const
+        {
+            return _shift.apply(_potential.template eval<T>(r), r);
+        }
+
+        template <typename T>
+        std::pair<T, T> evalFromR2Impl(const T r2) const
+        {
+            return evalFromDistanceImpl<T>(PairDistance<T>::fromR2(r2));
+        }
+
+        template <typename T>
+        std::pair<T, T> evalFromDistanceImpl(const PairDistance<T>& d) const
+        {
+            return _shift.applyFromDistance(
+                _potential.template evalFromDistance<T>(d),
+                d
+            );
+        }
+    };
+
+    /**
+     * @brief Shifted-force counterpart of BornMayerPotential.
+     *
+     * Energy and force are shifted like in LieShiftedPotential so that both
+     * vanish at the cutoff.
+     */
+    template <typename Rep = double>
+    class BornMayerShiftedPotential
+        : public PotentialBase<BornMayerShiftedPotential<Rep>, Rep>
+    {
+       private:
+        friend class PotentialBase<BornMayerShiftedPotential<Rep>, Rep>;
+
+        BornMayerPotential<Rep> _potential;
+
+        details::ForceShift<Rep> _shift;
+
+       public:
+        /**
+         * @brief Builds the shifted potential from prefactor, range and
+         *        the cutoff radius.
+         *
+         * @throws std::invalid_argument unless rc > 0 and the parameters
+         *         are valid for BornMayerPotential.
+         */
+        BornMayerShiftedPotential(Rep a, Rep rho, Rep rc)
+            : _potential(a, rho)
+        {
+            details::checkPositive(
+                rc,
+                "BornMayerShiftedPotential requires rc > 0"
+            );
+
+            _shift.radialCutoff = rc;
+            std::tie(_shift.energyCutoff, _shift.forceCutoff) =
+                _potential.eval(rc);
+        }
+
+        /// @brief Returns the repulsive prefactor.
+        constexpr Rep coeffA() const { return _potential.coeffA(); }
+
+        /// @brief Returns the range of the repulsion.
+        constexpr Rep rho() const { return _potential.rho(); }
+
+        /// @brief Returns the radial cutoff.
+        constexpr Rep radialCutoff() const { return _shift.radialCutoff; }
+
+       private:
+        template <typename T>
+        std::pair<T, T> evalImpl(const T r) const
+        {
+            return _shift.apply(_potential.template eval<T>(r), r);
+        }
+
+        template <typename T>
+        std::pair<T, T> evalFromR2Impl(const T r2) const
+        {
+            return evalFromDistanceImpl<T>(PairDistance<T>::fromR2(r2));
+        }
+
+        template <typename T>
+        std::pair<T, T> evalFromDistanceImpl(const PairDistance<T>& d) const
+        {
+            return _shift.applyFromDistance(
+                _potential.template evalFromDistance<T>(d),
+                d
+            );
+        }
+    };
+
+    /**
+     * @brief Shifted-force counterpart of BuckinghamPotential.
+     *
+     * Energy and force are shifted like in LieShiftedPotential so that both
+     * vanish at the cutoff.
+     */
+    template <typename Rep = double>
+    class BuckinghamShiftedPotential
+        : public PotentialBase<BuckinghamShiftedPotential<Rep>, Rep>
+    {
+       private:
+        friend class PotentialBase<BuckinghamShiftedPotential<Rep>, Rep>;
+
+        BuckinghamPotential<Rep> _potential;
+
+        details::ForceShift<Rep> _shift;
+
+       public:
+        /**
+         * @brief Builds the shifted potential from prefactors, range and
+         *        the cutoff radius.
+         *
+         * @throws std::invalid_argument unless rc > 0 and the parameters
+         *         are valid for BuckinghamPotential.
+         */
+        BuckinghamShiftedPotential(Rep a, Rep rho, Rep c, Rep rc)
+            : _potential(a, rho, c)
+        {
+            details::checkPositive(
+                rc,
+                "BuckinghamShiftedPotential requires rc > 0"
+            );
+
+            _shift.radialCutoff = rc;
+            std::tie(_shift.energyCutoff, _shift.forceCutoff) =
+                _potential.eval(rc);
+        }
+
+        /// @brief Returns the repulsive prefactor.
+        constexpr Rep coeffA() const { return _potential.coeffA(); }
+
+        /// @brief Returns the range of the repulsion.
+        constexpr Rep rho() const { return _potential.rho(); }
+
+        /// @brief Returns the dispersion prefactor.
+        constexpr Rep coeffC() const { return _potential.coeffC(); }
+
+        /// @brief Returns the radial cutoff.
+        constexpr Rep radialCutoff() const { return _shift.radialCutoff; }
+
+       private:
+        template <typename T>
+        std::pair<T, T> evalImpl(const T r) const
+        {
+            return _shift.apply(_potential.template eval<T>(r), r);
+        }
+
+        template <typename T>
+        std::pair<T, T> evalFromR2Impl(const T r2) const
+        {
+            return evalFromDistanceImpl<T>(PairDistance<T>::fromR2(r2));
+        }
+
+        template <typename T>
+        std::pair<T, T> evalFromDistanceImpl(const PairDistance<T>& d) const
+        {
+            return _shift.applyFromDistance(
+                _potential.template evalFromDistance<T>(d),
+                d
+            );
+        }
+    };
+
+}   // namespace mstd
+
+#endif   // __MSTD__PHYSICS__POTENTIALS__EXPONENTIAL_POTENTIAL_HPP__
@@ -0,0 +1,159 @@
+/*****************************************************************************
+<GPL_HEADER>
+
+    mstd library
+    Copyright (C) 2025-now  Jakob Gamper
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+<GPL_HEADER>
+******************************************************************************/
+
+#ifndef __MSTD__PHYSICS__POTENTIALS__EXPONENTIAL_POTENTIAL_IMPL_HPP__
+#define __MSTD__PHYSICS__POTENTIALS__EXPONENTIAL_POTENTIAL_IMPL_HPP__
+
+#include <utility>
+
+#include "mstd/simd.hpp"
+#include "pair_distance.hpp"
+
+namespace mstd
+{
+    /**
+     * @brief Morse energy and force at distance @p r.
+     *
+     * \f$E = D \left((1 - e^{-a (r - r_0)})^2 - 1\right)\f$, which vanishes
+     * for large r and has its minimum \f$-D\f$ at \f$r_0\f$, and
+     * \f$F = 2 D a \, e^{-a (r - r_0)} (1 - e^{-a (r - r_0)})\f$.
+     *
+     * @note @p T may also be a `SimdVec`, in which case all lanes are
+     *       evaluated at once with simdExp.
+     *
+     * @param d well depth \f$D\f$.
+     * @param a width parameter \f$a\f$.
+     * @param r0 equilibrium distance \f$r_0\f$.
+     * @param r inter-particle distance.
+     * @return pair of energy and force.
+     */
+    template <typename T>
+    static inline std::pair<T, T> morsePotential(T d, T a, T r0, T r)
+    {
+        const auto decay      = simdExp(a * (r0 - r));
+        const auto complement = 1 - decay;
+
+        return {
+            d * (complement * complement - 1),
+            2 * d * a * decay * complement
+        };
+    }
+
+    /**
+     * @brief Born-Mayer energy and force at distance @p r.
+     *
+     * \f$E = A e^{-r / \rho}\f$ and \f$F = -E / \rho\f$.
+     *
+     * @param a repulsive prefactor \f$A\f$.
+     * @param invRho inverse range \f$1 / \rho\f$.
+     * @param r inter-particle distance.
+     * @return pair of energy and force.
+     */
+    template <typename T>
+    static inline std::pair<T, T> bornMayerPotential(T a, T invRho, T r)
+    {
+        const auto energy = a * simdExp(-r * invRho);
+
+        return {energy, -energy * invRho};
+    }
+
+    /**
+     * @brief Buckingham energy and force at distance @p r.
+     *
+     * \f$E = A e^{-r / \rho} - C / r^6\f$ and
+     * \f$F = -A e^{-r / \rho} / \rho + 6 C / r^7\f$.
+     *
+     * @param a repulsive prefactor \f$A\f$.
+     * @param invRho inverse range \f$1 / \rho\f$.
+     * @param c dispersion prefactor \f$C\f$.
+     * @param r inter-particle distance.
+     * @return pair of energy and force.
+     */
+    template <typename T>
+    static inline std::pair<T, T> buckinghamPotential(
+        T a,
+        T invRho,
+        T c,
+        T r
+    )
+    {
+        const auto invR  = 1 / r;
+        const auto invR2 = invR * invR;
+        const auto c6    = c * invR2 * invR2 * invR2;
+
+        const auto [repulsion, slope] = bornMayerPotential(a, invRho, r);
+
+        return {repulsion - c6, slope + 6 * c6 * invR};
+    }
+
+    /**
+     * @brief Buckingham potential evaluated from shared powers of the
+     *        distance.
+     *
+     * @param a repulsive prefactor \f$A\f$.
+     * @param invRho inverse range \f$1 / \rho\f$.
+     * @param c dispersion prefactor \f$C\f$.
+     * @param d powers of the inter-particle distance.
+     * @return pair of energy and force over distance \f$F/r\f$.
+     */
+    template <typename T>
+    static inline std::pair<T, T> buckinghamFromDistance(
+        T                      a,
+        T                      invRho,
+        T                      c,
+        const PairDistance<T>& d
+    )
+    {
+        const auto c6 = c * d.invR2 * d.invR2 * d.invR2;
+
+        const auto [repulsion, slope] = bornMayerPotential(a, invRho, d.r);
+
+        return {repulsion - c6, slope * d.invR + 6 * c6 * d.invR2};
+    }
+
+    /**
+     * @brief Buckingham potential evaluated from the squared distance.
+     *
+     * The exponential needs r itself; r and the inverse powers are taken
+     * from a single reciprocal square root, so one division less is needed
+     * than for `sqrt` followed by buckinghamPotential.
+     *
+     * @param a repulsive prefactor \f$A\f$.
+     * @param invRho inverse range \f$1 / \rho\f$.
+     * @param c dispersion prefactor \f$C\f$.
+     * @param r2 squared inter-particle distance.
+     * @return pair of energy and force over distance \f$F/r\f$.
+     */
+    template <typename T>
+    static inline std::pair<T, T> buckinghamFromR2(T a, T invRho, T c, T r2)
+    {
+        return buckinghamFromDistance(
+            a,
+            invRho,
+            c,
+            PairDistance<T>::fromR2(r2)
+        );
+    }
+
+}   // namespace mstd
+
+#endif   // __MSTD__PHYSICS__POTENTIALS__EXPONENTIAL_POTENTIAL_IMPL_HPP__
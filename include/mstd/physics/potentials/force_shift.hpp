@@ -0,0 +1,83 @@
+/*****************************************************************************
+<GPL_HEADER>
+
+    mstd library
+    Copyright (C) 2025-now  Jakob Gamper
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+<GPL_HEADER>
+******************************************************************************/
+
+#ifndef __MSTD__PHYSICS__POTENTIALS__FORCE_SHIFT_HPP__
+#define __MSTD__PHYSICS__POTENTIALS__FORCE_SHIFT_HPP__
+
+#include <utility>
+
+#include "mstd/simd.hpp"
+#include "pair_distance.hpp"
+
+namespace mstd
+{
+    namespace details
+    {
+        /**
+         * @brief shifted-force correction
+         *        \f$E - E_c - F_c (r - r_c)\f$, \f$F - F_c\f$ of an
+         *        energy/force pair, as in LieShiftedPotential
+         */
+        template <typename Rep>
+        struct ForceShift
+        {
+            Rep radialCutoff{};
+            Rep energyCutoff{};
+            Rep forceCutoff{};
+
+            template <typename T>
+            constexpr std::pair<T, T> apply(
+                const std::pair<T, T>& unshifted,
+                const T                r
+            ) const
+            {
+                const auto forceShift = simdBroadcast<T>(forceCutoff);
+
+                return {
+                    unshifted.first - simdBroadcast<T>(energyCutoff) -
+                        forceShift * (r - simdBroadcast<T>(radialCutoff)),
+                    unshifted.second - forceShift
+                };
+            }
+
+            /// @brief apply for an energy/force over distance pair
+            template <typename T>
+            constexpr std::pair<T, T> applyFromDistance(
+                const std::pair<T, T>& unshifted,
+                const PairDistance<T>& d
+            ) const
+            {
+                const auto forceShift = simdBroadcast<T>(forceCutoff);
+
+                return {
+                    unshifted.first - simdBroadcast<T>(energyCutoff) -
+                        forceShift * (d.r - simdBroadcast<T>(radialCutoff)),
+                    unshifted.second - forceShift * d.invR
+                };
+            }
+        };
+
+    }   // namespace details
+
+}   // namespace mstd
+
+#endif   // __MSTD__PHYSICS__POTENTIALS__FORCE_SHIFT_HPP__
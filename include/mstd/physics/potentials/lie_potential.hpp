@@ -23,8 +23,14 @@
 #ifndef __MSTD__PHYSICS__POTENTIALS__LIE_POTENTIAL_HPP__
 #define __MSTD__PHYSICS__POTENTIALS__LIE_POTENTIAL_HPP__
 
+#include <span>
+#include <stdexcept>
+#include <tuple>
+#include <utility>
+
 #include "lie_potential_impl.hpp"
 #include "mstd/math.hpp"
+#include "mstd/simd.hpp"
 
 namespace mstd
 {
@@ -46,6 +52,8 @@ namespace mstd
         Rep _coeff2{};
 
        public:
+        using rep = Rep;
+
         virtual ~LiePotential() = default;
 
         /**
@@ -78,6 +86,79 @@ namespace mstd
         {
             return liePotential<M, N, Rep>(_coeff1, _coeff2, r);
         }
+
+        /**
+         * @brief Evaluates energy and force for every distance in @p r.
+         *
+         * @pre `energy.size() >= r.size()` and `force.size() >= r.size()`
+         *
+         * @param r distances.
+         * @param energy output energies.
+         * @param force output force magnitudes.
+         */
+        virtual void evalBatch(
+            std::span<const Rep> r,
+            std::span<Rep>       energy,
+            std::span<Rep>       force
+        ) const
+        {
+            liePotentialBatch<M, N, Rep>(_coeff1, _coeff2, r, energy, force);
+        }
+
+        /**
+         * @brief Returns energy and force over distance from @p r2.
+         *
+         * @note No square root is taken if both exponents are even.
+         *
+         * @param r2 squared distance.
+         * @return pair of energy and \f$F/r\f$.
+         */
+        virtual std::pair<Rep, Rep> evalFromR2(const Rep r2) const
+        {
+            return liePotentialFromR2<M, N, Rep>(_coeff1, _coeff2, r2);
+        }
+
+        /**
+         * @brief Returns only the energy from @p r2.
+         *
+         * The force term is never formed, which is all Monte Carlo moves
+         * need.
+         */
+        virtual Rep energyFromR2(const Rep r2) const
+        {
+            return liePotentialEnergyFromR2<M, N, Rep>(_coeff1, _coeff2, r2);
+        }
+
+        /**
+         * @brief Batch counterpart of evalFromR2.
+         *
+         * @pre `energy.size() >= r2.size()` and
+         *      `forceOverR.size() >= r2.size()`
+         *
+         * @param r2 squared distances.
+         * @param energy output energies.
+         * @param forceOverR output forces divided by the distance.
+         */
+        virtual void evalBatchFromR2(
+            std::span<const Rep> r2,
+            std::span<Rep>       energy,
+            std::span<Rep>       forceOverR
+        ) const
+        {
+            liePotentialBatchFromR2<M, N, Rep>(
+                _coeff1,
+                _coeff2,
+                r2,
+                energy,
+                forceOverR
+            );
+        }
+
+        /// @brief Returns the coefficient of the attractive term.
+        constexpr Rep coeff1() const { return _coeff1; }
+
+        /// @brief Returns the coefficient of the repulsive term.
+        constexpr Rep coeff2() const { return _coeff2; }
     };
 
     template <typename Rep = double>
@@ -112,7 +193,7 @@ namespace mstd
         /// @brief Energy corrected so that it vanishes at the cutoff.
         Rep evalEnergy(const Rep r) const override
         {
-            return _Base::evalEnergy(r) - _energyCutoff +
+            return _Base::evalEnergy(r) - _energyCutoff -
                    _forceCutoff * (r - _radialCutoff);
         }
 
@@ -129,11 +210,438 @@ namespace mstd
             const auto force  = evalForce(r);
             return {energy, force};
         }
+
+        /// @brief Shifted counterpart of LiePotential::evalBatch.
+        void evalBatch(
+            std::span<const Rep> r,
+            std::span<Rep>       energy,
+            std::span<Rep>       force
+        ) const override
+        {
+            const auto c1 = _Base::coeff1();
+            const auto c2 = _Base::coeff2();
+            const auto rc = _radialCutoff;
+            const auto ec = _energyCutoff;
+            const auto fc = _forceCutoff;
+
+            simdTransform(
+                r,
+                energy,
+                force,
+                [=]<typename T>(const T x)
+                {
+                    const auto fcT = simdBroadcast<T>(fc);
+
+                    const auto [e, f] = liePotential<M, N, T>(
+                        simdBroadcast<T>(c1),
+                        simdBroadcast<T>(c2),
+                        x
+                    );
+
+                    return std::pair<T, T>{
+                        e - simdBroadcast<T>(ec) -
+                            fcT * (x - simdBroadcast<T>(rc)),
+                        f - fcT
+                    };
+                }
+            );
+        }
+
+        /**
+         * @brief Shifted energy and force over distance from @p r2.
+         *
+         * @note The linear energy correction depends on \f$r\f$ itself, so
+         *       this takes one square root even for even exponents.
+         */
+        std::pair<Rep, Rep> evalFromR2(const Rep r2) const override
+        {
+            return _shiftFromR2<Rep>(
+                _Base::coeff1(),
+                _Base::coeff2(),
+                r2,
+                _radialCutoff,
+                _energyCutoff,
+                _forceCutoff
+            );
+        }
+
+        /// @brief Shifted counterpart of LiePotential::energyFromR2.
+        Rep energyFromR2(const Rep r2) const override
+        {
+            return _Base::energyFromR2(r2) - _energyCutoff -
+                   _forceCutoff * (simdSqrt(r2) - _radialCutoff);
+        }
+
+        /// @brief Shifted counterpart of LiePotential::evalBatchFromR2.
+        void evalBatchFromR2(
+            std::span<const Rep> r2,
+            std::span<Rep>       energy,
+            std::span<Rep>       forceOverR
+        ) const override
+        {
+            const auto c1 = _Base::coeff1();
+            const auto c2 = _Base::coeff2();
+            const auto rc = _radialCutoff;
+            const auto ec = _energyCutoff;
+            const auto fc = _forceCutoff;
+
+            simdTransform(
+                r2,
+                energy,
+                forceOverR,
+                [=]<typename T>(const T x)
+                { return _shiftFromR2<T>(c1, c2, x, rc, ec, fc); }
+            );
+        }
+
+        /// @brief Returns the radial cutoff.
+        constexpr Rep radialCutoff() const { return _radialCutoff; }
+
+        /// @brief Returns the unshifted energy at the cutoff.
+        constexpr Rep energyCutoff() const { return _energyCutoff; }
+
+        /// @brief Returns the unshifted force at the cutoff.
+        constexpr Rep forceCutoff() const { return _forceCutoff; }
+
+       private:
+        template <typename T>
+        static std::pair<T, T> _shiftFromR2(
+            const Rep c1,
+            const Rep c2,
+            const T   r2,
+            const Rep rc,
+            const Rep ec,
+            const Rep fc
+        )
+        {
+            const auto r   = simdSqrt(r2);
+            const auto fcT = simdBroadcast<T>(fc);
+
+            const auto [energy, forceOverR] = liePotentialFromR2<M, N, T>(
+                simdBroadcast<T>(c1),
+                simdBroadcast<T>(c2),
+                r2
+            );
+
+            return {
+                energy - simdBroadcast<T>(ec) -
+                    fcT * (r - simdBroadcast<T>(rc)),
+                forceOverR - fcT / r
+            };
+        }
     };
 
     template <typename Rep = double>
     using LJShiftedPotential = LieShiftedPotential<6, 12, Rep>;
 
+    /**
+     * @brief Switched variant that brings energy and force smoothly to zero
+     *        between a switching radius and the cutoff.
+     *
+     * Below the switching radius the potential is unchanged, unlike the
+     * shifted variant whose linear correction acts on the whole range.
+     * Between \f$r_s\f$ and \f$r_c\f$ the energy is multiplied by the
+     * polynomial switch of switchingFromR2 and the force is its exact
+     * derivative. The switch is a polynomial in \f$r^2\f$, so the r² path
+     * takes no square root for even exponents.
+     *
+     * This switches the potential; the force between \f$r_s\f$ and
+     * \f$r_c\f$ picks up the \f$S' E\f$ term and can exceed the bare
+     * force. LieForceSwitchedPotential switches the force instead.
+     */
+    template <size_t M, size_t N, typename Rep = double>
+    class LieSwitchedPotential : public LiePotential<M, N, Rep>
+    {
+       private:
+        using _Base = LiePotential<M, N, Rep>;
+
+        Rep _switchRadius{};
+        Rep _radialCutoff{};
+        Rep _switch2{};
+        Rep _invWidth2{};
+
+       public:
+        /**
+         * @brief Builds the switched potential from coefficients, switching
+         *        radius and cutoff radius.
+         *
+         * @throws std::invalid_argument unless 0 <= rs < rc.
+         */
+        constexpr LieSwitchedPotential(Rep c1, Rep c2, Rep rs, Rep rc)
+            : LiePotential<M, N, Rep>(c1, c2),
+              _switchRadius(rs),
+              _radialCutoff(rc),
+              _switch2(rs * rs)
+        {
+            if (!(rs >= 0 && rs < rc))
+                throw std::invalid_argument(
+                    "LieSwitchedPotential requires 0 <= rs < rc"
+                );
+
+            _invWidth2 = 1 / (rc * rc - rs * rs);
+        }
+
+        /// @brief Energy switched smoothly to zero at the cutoff.
+        Rep evalEnergy(const Rep r) const override { return eval(r).first; }
+
+        /// @brief Force switched smoothly to zero at the cutoff.
+        Rep evalForce(const Rep r) const override { return eval(r).second; }
+
+        /// @brief Returns the switched energy/force pair evaluated at @p r.
+        std::pair<Rep, Rep> eval(const Rep r) const override
+        {
+            const auto [energy, forceOverR] = evalFromR2(r * r);
+            return {energy, forceOverR * r};
+        }
+
+        /// @brief Switched counterpart of LiePotential::evalBatch.
+        void evalBatch(
+            std::span<const Rep> r,
+            std::span<Rep>       energy,
+            std::span<Rep>       force
+        ) const override
+        {
+            const auto c1  = _Base::coeff1();
+            const auto c2  = _Base::coeff2();
+            const auto rs2 = _switch2;
+            const auto iw2 = _invWidth2;
+
+            simdTransform(
+                r,
+                energy,
+                force,
+                [=]<typename T>(const T x)
+                {
+                    const auto [e, forceOverR] = lieSwitchedFromR2<M, N, T>(
+                        simdBroadcast<T>(c1),
+                        simdBroadcast<T>(c2),
+                        x * x,
+                        simdBroadcast<T>(rs2),
+                        simdBroadcast<T>(iw2)
+                    );
+                    return std::pair<T, T>{e, forceOverR * x};
+                }
+            );
+        }
+
+        /// @brief Switched energy and force over distance from @p r2.
+        std::pair<Rep, Rep> evalFromR2(const Rep r2) const override
+        {
+            return lieSwitchedFromR2<M, N, Rep>(
+                _Base::coeff1(),
+                _Base::coeff2(),
+                r2,
+                _switch2,
+                _invWidth2
+            );
+        }
+
+        /// @brief Switched counterpart of LiePotential::energyFromR2.
+        Rep energyFromR2(const Rep r2) const override
+        {
+            const auto switching =
+                switchingFromR2<Rep>(r2, _switch2, _invWidth2);
+
+            return switching.first * _Base::energyFromR2(r2);
+        }
+
+        /// @brief Switched counterpart of LiePotential::evalBatchFromR2.
+        void evalBatchFromR2(
+            std::span<const Rep> r2,
+            std::span<Rep>       energy,
+            std::span<Rep>       forceOverR
+        ) const override
+        {
+            const auto c1  = _Base::coeff1();
+            const auto c2  = _Base::coeff2();
+            const auto rs2 = _switch2;
+            const auto iw2 = _invWidth2;
+
+            simdTransform(
+                r2,
+                energy,
+                forceOverR,
+                [=]<typename T>(const T x)
+                {
+                    return lieSwitchedFromR2<M, N, T>(
+                        simdBroadcast<T>(c1),
+                        simdBroadcast<T>(c2),
+                        x,
+                        simdBroadcast<T>(rs2),
+                        simdBroadcast<T>(iw2)
+                    );
+                }
+            );
+        }
+
+        /// @brief Returns the switching radius.
+        constexpr Rep switchRadius() const { return _switchRadius; }
+
+        /// @brief Returns the radial cutoff.
+        constexpr Rep radialCutoff() const { return _radialCutoff; }
+    };
+
+    template <typename Rep = double>
+    using LJSwitchedPotential = LieSwitchedPotential<6, 12, Rep>;
+
+    /**
+     * @brief Force-switched variant that brings the force and its
+     *        derivative smoothly to zero between a switching radius and the
+     *        cutoff.
+     *
+     * Each term \f$r^{-n}\f$ gets a force correction quadratic and cubic in
+     * \f$r - r_s\f$ (see details::ForceSwitch), so the force is unchanged
+     * below \f$r_s\f$ and decays monotonically to zero at \f$r_c\f$. The
+     * energy is the integral of that force: below \f$r_s\f$ it is the bare
+     * energy shifted by a constant, and it vanishes at \f$r_c\f$. The
+     * correction needs r itself, so one square root remains on the r² path.
+     */
+    template <size_t M, size_t N, typename Rep = double>
+    class LieForceSwitchedPotential : public LiePotential<M, N, Rep>
+    {
+       private:
+        using _Base = LiePotential<M, N, Rep>;
+
+        details::ForceSwitch<Rep> _switch;
+
+       public:
+        /**
+         * @brief Builds the force-switched potential from coefficients,
+         *        switching radius and cutoff radius.
+         *
+         * @throws std::invalid_argument unless 0 <= rs < rc.
+         */
+        LieForceSwitchedPotential(Rep c1, Rep c2, Rep rs, Rep rc)
+            : LiePotential<M, N, Rep>(c1, c2)
+        {
+            if (!(rs >= 0 && rs < rc))
+                throw std::invalid_argument(
+                    "LieForceSwitchedPotential requires 0 <= rs < rc"
+                );
+
+            _switch = details::ForceSwitch<Rep>::template forLie<M, N>(
+                c1,
+                c2,
+                rs,
+                rc
+            );
+        }
+
+        /// @brief Energy of the force-switched potential.
+        Rep evalEnergy(const Rep r) const override { return eval(r).first; }
+
+        /// @brief Force switched smoothly to zero at the cutoff.
+        Rep evalForce(const Rep r) const override { return eval(r).second; }
+
+        /// @brief Returns the force-switched energy/force pair at @p r.
+        std::pair<Rep, Rep> eval(const Rep r) const override
+        {
+            const auto d                    = PairDistance<Rep>::fromR(r);
+            const auto [energy, forceOverR] = _switch.applyFromDistance(
+                liePotentialFromDistance<M, N, Rep>(
+                    _Base::coeff1(),
+                    _Base::coeff2(),
+                    d
+                ),
+                d
+            );
+
+            return {energy, forceOverR * r};
+        }
+
+        /// @brief Force-switched counterpart of LiePotential::evalBatch.
+        void evalBatch(
+            std::span<const Rep> r,
+            std::span<Rep>       energy,
+            std::span<Rep>       force
+        ) const override
+        {
+            const auto c1        = _Base::coeff1();
+            const auto c2        = _Base::coeff2();
+            const auto switching = _switch;
+
+            simdTransform(
+                r,
+                energy,
+                force,
+                [=]<typename T>(const T x)
+                {
+                    const auto d               = PairDistance<T>::fromR(x);
+                    const auto [e, forceOverR] = switching.applyFromDistance(
+                        liePotentialFromDistance<M, N, T>(
+                            simdBroadcast<T>(c1),
+                            simdBroadcast<T>(c2),
+                            d
+                        ),
+                        d
+                    );
+                    return std::pair<T, T>{e, forceOverR * x};
+                }
+            );
+        }
+
+        /// @brief Force-switched energy and force over distance from @p r2.
+        std::pair<Rep, Rep> evalFromR2(const Rep r2) const override
+        {
+            const auto d = PairDistance<Rep>::fromR2(r2);
+
+            return _switch.applyFromDistance(
+                liePotentialFromDistance<M, N, Rep>(
+                    _Base::coeff1(),
+                    _Base::coeff2(),
+                    d
+                ),
+                d
+            );
+        }
+
+        /// @brief Force-switched counterpart of LiePotential::energyFromR2.
+        Rep energyFromR2(const Rep r2) const override
+        {
+            return evalFromR2(r2).first;
+        }
+
+        /// @brief Force-switched counterpart of
+        ///        LiePotential::evalBatchFromR2.
+        void evalBatchFromR2(
+            std::span<const Rep> r2,
+            std::span<Rep>       energy,
+            std::span<Rep>       forceOverR
+        ) const override
+        {
+            const auto c1        = _Base::coeff1();
+            const auto c2        = _Base::coeff2();
+            const auto switching = _switch;
+
+            simdTransform(
+                r2,
+                energy,
+                forceOverR,
+                [=]<typename T>(const T x)
+                {
+                    const auto d = PairDistance<T>::fromR2(x);
+                    return switching.applyFromDistance(
+                        liePotentialFromDistance<M, N, T>(
+                            simdBroadcast<T>(c1),
+                            simdBroadcast<T>(c2),
+                            d
+                        ),
+                        d
+                    );
+                }
+            );
+        }
+
+        /// @brief Returns the switching radius.
+        constexpr Rep switchRadius() const { return _switch.switchRadius; }
+
+        /// @brief Returns the radial cutoff.
+        constexpr Rep radialCutoff() const { return _switch.radialCutoff; }
+    };
+
+    template <typename Rep = double>
+    using LJForceSwitchedPotential = LieForceSwitchedPotential<6, 12, Rep>;
+
 }   // namespace mstd
 
 #endif   // __MSTD__PHYSICS__POTENTIALS__LIE_POTENTIAL_HPP__
@@ -23,7 +23,12 @@
 #ifndef __MSTD__PHYSICS__POTENTIALS__LIE_POTENTIAL_IMPL_HPP__
 #define __MSTD__PHYSICS__POTENTIALS__LIE_POTENTIAL_IMPL_HPP__
 
+#include <span>
+#include <utility>
+
 #include "mstd/math.hpp"
+#include "mstd/simd.hpp"
+#include "pair_distance.hpp"
 
 namespace mstd
 {
@@ -31,6 +36,9 @@ namespace mstd
     /**
      * @brief Generic helper returning the energy/force pair of a Lie potential.
      *
+     * @note @p Rep may also be a `SimdVec`, in which case all lanes are
+     *       evaluated at once.
+     *
      * @tparam M attractive exponent.
      * @tparam N repulsive exponent.
      * @tparam Rep numeric representation.
@@ -45,13 +53,14 @@ namespace mstd
         Rep r
     )
     {
-        const auto rm = cpow<M>(r);
-        const auto rn = cpow<N>(r);
+        // a single division keeps the vector instantiation from being
+        // bound by the divider throughput
+        const auto rinv = 1 / r;
 
-        const auto c1rm   = c1 / rm;
-        const auto c2rn   = c2 / rn;
+        const auto c1rm   = c1 * cpow<M>(rinv);
+        const auto c2rn   = c2 * cpow<N>(rinv);
         const auto energy = -c1rm + c2rn;
-        const auto force  = M * c1rm / r - N * c2rn / r;
+        const auto force  = (M * c1rm - N * c2rn) * rinv;
 
         return {energy, force};
     }
@@ -67,17 +76,430 @@ namespace mstd
         Rep r
     )
     {
-        const auto r2     = r * r;
-        const auto r6     = r2 * r2 * r2;
-        const auto r12    = r6 * r6;
-        const auto c1r6   = c1 / r6;
-        const auto c2r12  = c2 / r12;
+        const auto rinv   = 1 / r;
+        const auto r2inv  = rinv * rinv;
+        const auto r6inv  = r2inv * r2inv * r2inv;
+        const auto c1r6   = c1 * r6inv;
+        const auto c2r12  = c2 * r6inv * r6inv;
         const auto energy = -c1r6 + c2r12;
-        const auto force  = 6 * c1r6 / r - 12 * c2r12 / r;
+        const auto force  = (6 * c1r6 - 12 * c2r12) * rinv;
 
         return {energy, force};
     }
 
+    /**
+     * @brief Evaluates a Lie potential for a whole array of distances.
+     *
+     * Full SIMD vectors (AVX-512, AVX2 or SSE2/NEON, depending on the target
+     * flags) are processed with the vector instantiation of liePotential, the
+     * remainder with the scalar one.
+     *
+     * @pre `energy.size() >= r.size()` and `force.size() >= r.size()`
+     *
+     * @tparam M attractive exponent.
+     * @tparam N repulsive exponent.
+     * @tparam Rep numeric representation.
+     * @param c1 attractive prefactor.
+     * @param c2 repulsive prefactor.
+     * @param r  inter-particle distances.
+     * @param energy output energies.
+     * @param force  output force magnitudes.
+     */
+    template <size_t M, size_t N, typename Rep>
+    static inline void liePotentialBatch(
+        Rep                  c1,
+        Rep                  c2,
+        std::span<const Rep> r,
+        std::span<Rep>       energy,
+        std::span<Rep>       force
+    )
+    {
+        simdTransform(
+            r,
+            energy,
+            force,
+            [c1, c2]<typename T>(const T x)
+            {
+                return liePotential<M, N, T>(
+                    simdBroadcast<T>(c1),
+                    simdBroadcast<T>(c2),
+                    x
+                );
+            }
+        );
+    }
+
+    /**
+     * @brief Lie potential evaluated from the squared distance.
+     *
+     * Returns the energy and the force divided by the distance, so that the
+     * caller obtains the force vector by scaling the displacement vector. For
+     * even @p M and @p N only powers of \f$r^{-2}\f$ are needed, so neither a
+     * square root nor a division by \f$r\f$ is taken; odd exponents fall
+     * back to a single square root.
+     *
+     * @tparam M attractive exponent.
+     * @tparam N repulsive exponent.
+     * @tparam Rep numeric representation (scalar or `SimdVec`).
+     * @param c1 attractive prefactor.
+     * @param c2 repulsive prefactor.
+     * @param r2 squared inter-particle distance.
+     * @return pair of energy and force over distance \f$F/r\f$.
+     */
+    template <size_t M, size_t N, typename Rep>
+    static inline constexpr std::pair<Rep, Rep> liePotentialFromR2(
+        Rep c1,
+        Rep c2,
+        Rep r2
+    )
+    {
+        if constexpr (M % 2 == 0 && N % 2 == 0)
+        {
+            const auto r2inv = 1 / r2;
+
+            const auto c1rm       = c1 * cpow<M / 2>(r2inv);
+            const auto c2rn       = c2 * cpow<N / 2>(r2inv);
+            const auto energy     = -c1rm + c2rn;
+            const auto forceOverR = (M * c1rm - N * c2rn) * r2inv;
+
+            return {energy, forceOverR};
+        }
+        else
+        {
+            const auto rinv = 1 / simdSqrt(r2);
+
+            const auto c1rm       = c1 * cpow<M>(rinv);
+            const auto c2rn       = c2 * cpow<N>(rinv);
+            const auto energy     = -c1rm + c2rn;
+            const auto forceOverR = (M * c1rm - N * c2rn) * rinv * rinv;
+
+            return {energy, forceOverR};
+        }
+    }
+
+    /**
+     * @brief Energy of the Lie potential evaluated from the squared
+     *        distance.
+     *
+     * Energy-only counterpart of liePotentialFromR2 for callers that need
+     * no forces, e.g. Monte Carlo moves; the force term is never formed.
+     *
+     * @param c1 attractive prefactor.
+     * @param c2 repulsive prefactor.
+     * @param r2 squared inter-particle distance.
+     * @return the energy.
+     */
+    template <size_t M, size_t N, typename Rep>
+    static inline constexpr Rep liePotentialEnergyFromR2(
+        Rep c1,
+        Rep c2,
+        Rep r2
+    )
+    {
+        if constexpr (M % 2 == 0 && N % 2 == 0)
+        {
+            const auto r2inv = 1 / r2;
+
+            return -c1 * cpow<M / 2>(r2inv) + c2 * cpow<N / 2>(r2inv);
+        }
+        else
+        {
+            const auto rinv = 1 / simdSqrt(r2);
+
+            return -c1 * cpow<M>(rinv) + c2 * cpow<N>(rinv);
+        }
+    }
+
+    /**
+     * @brief Tail integral of the energy beyond the cutoff,
+     *        \f$\int_{r_c}^\infty r^2 E(r)\,dr
+     *        = -\frac{c_1 r_c^{3-M}}{M-3} + \frac{c_2 r_c^{3-N}}{N-3}\f$.
+     *
+     * The long-range energy correction of a homogeneous fluid follows as
+     * \f$E_{tail} = 2\pi N^2 / V\f$ times this integral.
+     *
+     * @param c1 attractive prefactor.
+     * @param c2 repulsive prefactor.
+     * @param rc cutoff radius.
+     */
+    template <size_t M, size_t N, typename Rep>
+    static inline constexpr Rep lieTailEnergyIntegral(Rep c1, Rep c2, Rep rc)
+    {
+        static_assert(M > 3, "the tail integral requires M > 3");
+
+        constexpr auto m = static_cast<Rep>(M);
+        constexpr auto n = static_cast<Rep>(N);
+
+        return -c1 * cpow<3 - static_cast<intmax_t>(M)>(rc) / (m - 3) +
+               c2 * cpow<3 - static_cast<intmax_t>(N)>(rc) / (n - 3);
+    }
+
+    /**
+     * @brief Tail integral of the virial beyond the cutoff,
+     *        \f$\int_{r_c}^\infty r^3 E'(r)\,dr
+     *        = \frac{M c_1 r_c^{3-M}}{M-3} - \frac{N c_2 r_c^{3-N}}{N-3}\f$.
+     *
+     * The long-range pressure correction of a homogeneous fluid follows as
+     * \f$P_{tail} = -2\pi N^2 / (3 V^2)\f$ times this integral.
+     *
+     * @param c1 attractive prefactor.
+     * @param c2 repulsive prefactor.
+     * @param rc cutoff radius.
+     */
+    template <size_t M, size_t N, typename Rep>
+    static inline constexpr Rep lieTailVirialIntegral(Rep c1, Rep c2, Rep rc)
+    {
+        static_assert(M > 3, "the tail integral requires M > 3");
+
+        constexpr auto m = static_cast<Rep>(M);
+        constexpr auto n = static_cast<Rep>(N);
+
+        return m * c1 * cpow<3 - static_cast<intmax_t>(M)>(rc) / (m - 3) -
+               n * c2 * cpow<3 - static_cast<intmax_t>(N)>(rc) / (n - 3);
+    }
+
+    /**
+     * @brief Lie potential evaluated from shared powers of the distance.
+     *
+     * Same result as liePotentialFromR2 without any square root or
+     * division; even exponents only use \f$r^{-2}\f$, odd ones \f$r^{-1}\f$.
+     *
+     * @param c1 attractive prefactor.
+     * @param c2 repulsive prefactor.
+     * @param d powers of the inter-particle distance.
+     * @return pair of energy and force over distance \f$F/r\f$.
+     */
+    template <size_t M, size_t N, typename Rep>
+    static inline constexpr std::pair<Rep, Rep> liePotentialFromDistance(
+        Rep                      c1,
+        Rep                      c2,
+        const PairDistance<Rep>& d
+    )
+    {
+        if constexpr (M % 2 == 0 && N % 2 == 0)
+        {
+            const auto c1rm       = c1 * cpow<M / 2>(d.invR2);
+            const auto c2rn       = c2 * cpow<N / 2>(d.invR2);
+            const auto energy     = -c1rm + c2rn;
+            const auto forceOverR = (M * c1rm - N * c2rn) * d.invR2;
+
+            return {energy, forceOverR};
+        }
+        else
+        {
+            const auto c1rm       = c1 * cpow<M>(d.invR);
+            const auto c2rn       = c2 * cpow<N>(d.invR);
+            const auto energy     = -c1rm + c2rn;
+            const auto forceOverR = (M * c1rm - N * c2rn) * d.invR2;
+
+            return {energy, forceOverR};
+        }
+    }
+
+    /**
+     * @brief Batch counterpart of liePotentialFromR2.
+     *
+     * @pre `energy.size() >= r2.size()` and `forceOverR.size() >= r2.size()`
+     *
+     * @param c1 attractive prefactor.
+     * @param c2 repulsive prefactor.
+     * @param r2 squared inter-particle distances.
+     * @param energy output energies.
+     * @param forceOverR output forces divided by the distance.
+     */
+    template <size_t M, size_t N, typename Rep>
+    static inline void liePotentialBatchFromR2(
+        Rep                  c1,
+        Rep                  c2,
+        std::span<const Rep> r2,
+        std::span<Rep>       energy,
+        std::span<Rep>       forceOverR
+    )
+    {
+        simdTransform(
+            r2,
+            energy,
+            forceOverR,
+            [c1, c2]<typename T>(const T x)
+            {
+                return liePotentialFromR2<M, N, T>(
+                    simdBroadcast<T>(c1),
+                    simdBroadcast<T>(c2),
+                    x
+                );
+            }
+        );
+    }
+
+    /**
+     * @brief Polynomial switching function evaluated from @p r2.
+     *
+     * Uses \f$S(x) = 1 - 10x^3 + 15x^4 - 6x^5\f$ with
+     * \f$x = (r^2 - r_s^2) / (r_c^2 - r_s^2)\f$ clamped to [0, 1]. \f$S\f$
+     * falls from one at \f$r_s\f$ to zero at \f$r_c\f$ with vanishing first
+     * and second derivatives at both ends, and needs no square root.
+     *
+     * @param r2 squared inter-particle distance.
+     * @param rs2 squared switching radius.
+     * @param invWidth2 \f$1 / (r_c^2 - r_s^2)\f$.
+     * @return pair of \f$S\f$ and \f$(dS/dr) / r\f$.
+     */
+    template <typename T>
+    static inline constexpr std::pair<T, T> switchingFromR2(
+        T r2,
+        T rs2,
+        T invWidth2
+    )
+    {
+        const auto zero = simdBroadcast<T>(0);
+        const auto one  = simdBroadcast<T>(1);
+
+        auto x = (r2 - rs2) * invWidth2;
+        x      = x < zero ? zero : x;
+        x      = x > one ? one : x;
+
+        const auto oneMinusX = one - x;
+        const auto x2        = x * x;
+
+        // factored S = (1 - x)^3 (1 + 3x + 6x^2) is exact at x = 1,
+        // dS/dx = -30 x^2 (1 - x)^2
+        const auto s = oneMinusX * oneMinusX * oneMinusX *
+                       (one + simdBroadcast<T>(3) * x +
+                        simdBroadcast<T>(6) * x2);
+        const auto dsdx =
+            simdBroadcast<T>(-30) * x2 * oneMinusX * oneMinusX;
+
+        return {s, simdBroadcast<T>(2) * dsdx * invWidth2};
+    }
+
+    /**
+     * @brief Lie potential switched smoothly to zero between \f$r_s\f$ and
+     *        \f$r_c\f$, evaluated from @p r2.
+     *
+     * The energy is \f$S(r) E(r)\f$ and the force its exact derivative
+     * \f$S F + S' E\f$, so energy and force both vanish smoothly at
+     * \f$r_c\f$. Distances beyond \f$r_c\f$ yield zero.
+     *
+     * @param c1 attractive prefactor.
+     * @param c2 repulsive prefactor.
+     * @param r2 squared inter-particle distance.
+     * @param rs2 squared switching radius.
+     * @param invWidth2 \f$1 / (r_c^2 - r_s^2)\f$.
+     * @return pair of energy and force over distance \f$F/r\f$.
+     */
+    template <size_t M, size_t N, typename Rep>
+    static inline constexpr std::pair<Rep, Rep> lieSwitchedFromR2(
+        Rep c1,
+        Rep c2,
+        Rep r2,
+        Rep rs2,
+        Rep invWidth2
+    )
+    {
+        const auto [energy, forceOverR] =
+            liePotentialFromR2<M, N, Rep>(c1, c2, r2);
+        const auto [s, dsOverR] = switchingFromR2<Rep>(r2, rs2, invWidth2);
+
+        return {s * energy, s * forceOverR + dsOverR * energy};
+    }
+
+    namespace details
+    {
+        /**
+         * @brief force-switch correction of an energy/force pair between
+         *        \f$r_s\f$ and \f$r_c\f$, as in LieForceSwitchedPotential
+         *
+         * With \f$\Delta = \max(r - r_s, 0)\f$ the force gains
+         * \f$-a \Delta^2 - b \Delta^3\f$ and the energy its integral
+         * \f$-a \Delta^3 / 3 - b \Delta^4 / 4 - c\f$. Distances beyond
+         * \f$r_c\f$ yield zero.
+         */
+        template <typename Rep>
+        struct ForceSwitch
+        {
+            Rep switchRadius{};
+            Rep radialCutoff{};
+            Rep a{};
+            Rep b{};
+            Rep c{};
+
+            /**
+             * @brief coefficients for the single term \f$r^{-n}\f$
+             *
+             * a and b take force and force derivative of the term to zero
+             * at \f$r_c\f$ and c its energy.
+             */
+            template <size_t Exp>
+            static constexpr ForceSwitch forTerm(const Rep rs, const Rep rc)
+            {
+                constexpr auto n = static_cast<Rep>(Exp);
+
+                const auto width = rc - rs;
+                const auto scale = n * cpow<Exp + 2>(1 / rc);
+                const auto a     = -scale * ((n + 4) * rc - (n + 1) * rs) /
+                               (width * width);
+                const auto b = scale * ((n + 3) * rc - (n + 1) * rs) /
+                               (width * width * width);
+                const auto c = cpow<Exp>(1 / rc) -
+                               a / 3 * cpow<3>(width) -
+                               b / 4 * cpow<4>(width);
+
+                return {rs, rc, a, b, c};
+            }
+
+            /// @brief coefficients for \f$-c_1 r^{-M} + c_2 r^{-N}\f$
+            template <size_t M, size_t N>
+            static constexpr ForceSwitch forLie(
+                const Rep c1,
+                const Rep c2,
+                const Rep rs,
+                const Rep rc
+            )
+            {
+                const auto m = forTerm<M>(rs, rc);
+                const auto n = forTerm<N>(rs, rc);
+
+                return {
+                    rs,
+                    rc,
+                    -c1 * m.a + c2 * n.a,
+                    -c1 * m.b + c2 * n.b,
+                    -c1 * m.c + c2 * n.c
+                };
+            }
+
+            /// @brief switches an energy/force over distance pair
+            template <typename T>
+            constexpr std::pair<T, T> applyFromDistance(
+                const std::pair<T, T>& unswitched,
+                const PairDistance<T>& d
+            ) const
+            {
+                const auto zero = simdBroadcast<T>(0);
+                const auto ca   = simdBroadcast<T>(a);
+                const auto cb   = simdBroadcast<T>(b);
+
+                auto delta = d.r - simdBroadcast<T>(switchRadius);
+                delta      = delta < zero ? zero : delta;
+
+                const auto delta2 = delta * delta;
+                const auto energy =
+                    unswitched.first -
+                    delta2 * delta *
+                        (ca * simdBroadcast<T>(Rep{1} / 3) +
+                         cb * simdBroadcast<T>(Rep{1} / 4) * delta) -
+                    simdBroadcast<T>(c);
+                const auto forceOverR =
+                    unswitched.second - delta2 * (ca + cb * delta) * d.invR;
+
+                const auto inside = d.r < simdBroadcast<T>(radialCutoff);
+
+                return {inside ? energy : zero, inside ? forceOverR : zero};
+            }
+        };
+
+    }   // namespace details
+
     /// @brief Convenience wrapper for Lennard-Jones (6-12) parameters.
     template <typename Rep>
     static constexpr std::pair<Rep, Rep> ljPotential(Rep c1, Rep c2, Rep r)
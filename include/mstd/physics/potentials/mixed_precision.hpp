@@ -0,0 +1,156 @@
+/*****************************************************************************
+<GPL_HEADER>
+
+    mstd library
+    Copyright (C) 2025-now  Jakob Gamper
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+<GPL_HEADER>
+******************************************************************************/
+
+#ifndef __MSTD__PHYSICS__POTENTIALS__MIXED_PRECISION_HPP__
+#define __MSTD__PHYSICS__POTENTIALS__MIXED_PRECISION_HPP__
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <span>
+#include <type_traits>
+
+#include "mstd/memory.hpp"
+#include "mstd/type_traits/physics_traits.hpp"
+
+namespace mstd
+{
+    namespace details
+    {
+        /// number of values converted per block by the mixed batch helpers
+        static constexpr size_t mixed_batch_size = 256;
+
+        /**
+         * @brief Evaluates @p batch on blocks converted to the precision of
+         *        the potential and converts the results back.
+         *
+         * @tparam Potential pair potential evaluated in `Potential::rep`.
+         * @tparam Acc input and output precision.
+         */
+        template <typename Potential, typename Acc, typename Batch>
+        void evalMixedBlocks(
+            std::span<const Acc> in,
+            std::span<Acc>       out1,
+            std::span<Acc>       out2,
+            Batch&&              batch
+        )
+        {
+            using Eval = typename Potential::rep;
+
+            assert(out1.size() >= in.size());
+            assert(out2.size() >= in.size());
+
+            alignas(cache_line_bytes) std::array<Eval, mixed_batch_size> x;
+            alignas(cache_line_bytes) std::array<Eval, mixed_batch_size> y1;
+            alignas(cache_line_bytes) std::array<Eval, mixed_batch_size> y2;
+
+            for (size_t begin = 0; begin < in.size(); begin += mixed_batch_size)
+            {
+                const auto n = std::min(mixed_batch_size, in.size() - begin);
+
+                for (size_t k = 0; k < n; ++k)
+                    x[k] = static_cast<Eval>(in[begin + k]);
+
+                batch(
+                    std::span<const Eval>(x).first(n),
+                    std::span<Eval>(y1).first(n),
+                    std::span<Eval>(y2).first(n)
+                );
+
+                for (size_t k = 0; k < n; ++k)
+                {
+                    out1[begin + k] = static_cast<Acc>(y1[k]);
+                    out2[begin + k] = static_cast<Acc>(y2[k]);
+                }
+            }
+        }
+
+    }   // namespace details
+
+    /**
+     * @brief Mixed precision counterpart of `evalBatch`.
+     *
+     * Converts the distances in blocks to the (narrower) representation of
+     * the potential, evaluates them with its SIMD batch path and widens the
+     * energies and forces again. With a `float` potential this runs at
+     * twice the SIMD width of the `double` path while callers keep `double`
+     * arrays and accumulators.
+     *
+     * @pre `energy.size() >= r.size()` and `force.size() >= r.size()`
+     *
+     * @tparam Acc precision of the arrays, wider than `Potential::rep`.
+     * @param potential pair potential evaluated in `Potential::rep`.
+     * @param r distances.
+     * @param energy output energies.
+     * @param force output force magnitudes.
+     */
+    template <typename Acc = double, PairPotentialType Potential>
+        requires is_mixed_precision_v<typename Potential::rep, Acc>
+    void evalBatchMixed(
+        const Potential&                            potential,
+        std::span<const std::type_identity_t<Acc>> r,
+        std::span<std::type_identity_t<Acc>>       energy,
+        std::span<std::type_identity_t<Acc>>       force
+    )
+    {
+        details::evalMixedBlocks<Potential, Acc>(
+            r,
+            energy,
+            force,
+            [&potential](const auto in, const auto out1, const auto out2)
+            { potential.evalBatch(in, out1, out2); }
+        );
+    }
+
+    /**
+     * @brief Mixed precision counterpart of `evalBatchFromR2`.
+     *
+     * @pre `energy.size() >= r2.size()` and
+     *      `forceOverR.size() >= r2.size()`
+     *
+     * @tparam Acc precision of the arrays, wider than `Potential::rep`.
+     * @param potential pair potential evaluated in `Potential::rep`.
+     * @param r2 squared distances.
+     * @param energy output energies.
+     * @param forceOverR output forces divided by the distance.
+     */
+    template <typename Acc = double, PairPotentialType Potential>
+        requires is_mixed_precision_v<typename Potential::rep, Acc>
+    void evalBatchFromR2Mixed(
+        const Potential&                            potential,
+        std::span<const std::type_identity_t<Acc>> r2,
+        std::span<std::type_identity_t<Acc>>       energy,
+        std::span<std::type_identity_t<Acc>>       forceOverR
+    )
+    {
+        details::evalMixedBlocks<Potential, Acc>(
+            r2,
+            energy,
+            forceOverR,
+            [&potential](const auto in, const auto out1, const auto out2)
+            { potential.evalBatchFromR2(in, out1, out2); }
+        );
+    }
+
+}   // namespace mstd
+
+#endif   // __MSTD__PHYSICS__POTENTIALS__MIXED_PRECISION_HPP__
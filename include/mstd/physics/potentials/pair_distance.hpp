@@ -0,0 +1,66 @@
+/*****************************************************************************
+<GPL_HEADER>
+
+    mstd library
+    Copyright (C) 2025-now  Jakob Gamper
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+<GPL_HEADER>
+******************************************************************************/
+
+#ifndef __MSTD__PHYSICS__POTENTIALS__PAIR_DISTANCE_HPP__
+#define __MSTD__PHYSICS__POTENTIALS__PAIR_DISTANCE_HPP__
+
+#include "mstd/simd.hpp"
+
+namespace mstd
+{
+    /**
+     * @brief Powers of an inter-particle distance shared between the terms
+     *        of a pair potential.
+     *
+     * Built once per pair (or per vector of pairs) from either r or
+     * \f$r^2\f$ with a single square root and a single division, so that
+     * potentials evaluated through `evalFromDistance` (e.g. the terms of a
+     * SumPotential) do not repeat them.
+     *
+     * @tparam T floating point scalar or `SimdVec`.
+     */
+    template <typename T>
+    struct PairDistance
+    {
+        T r2;      ///< squared distance
+        T r;       ///< distance
+        T invR;    ///< inverse distance
+        T invR2;   ///< inverse squared distance
+
+        /// @brief Builds all powers from the squared distance @p r2.
+        static PairDistance fromR2(const T r2)
+        {
+            const auto invR = 1 / simdSqrt(r2);
+            return {r2, r2 * invR, invR, invR * invR};
+        }
+
+        /// @brief Builds all powers from the distance @p r.
+        static constexpr PairDistance fromR(const T r)
+        {
+            const auto invR = 1 / r;
+            return {r * r, r, invR, invR * invR};
+        }
+    };
+
+}   // namespace mstd
+
+#endif   // __MSTD__PHYSICS__POTENTIALS__PAIR_DISTANCE_HPP__
@@ -0,0 +1,221 @@
+/*****************************************************************************
+<GPL_HEADER>
+
+    mstd library
+    Copyright (C) 2025-now  Jakob Gamper
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+<GPL_HEADER>
+******************************************************************************/
+
+#ifndef __MSTD__PHYSICS__POTENTIALS__POTENTIAL_BASE_HPP__
+#define __MSTD__PHYSICS__POTENTIALS__POTENTIAL_BASE_HPP__
+
+#include <span>
+#include <type_traits>
+#include <utility>
+
+#include "mstd/simd.hpp"
+#include "pair_distance.hpp"
+
+namespace mstd
+{
+    /**
+     * @brief CRTP base class for statically dispatched pair potentials.
+     *
+     * The derived class only has to provide a lane-generic
+     * `template <typename T> std::pair<T, T> evalImpl(T r) const` returning
+     * energy and force magnitude. It may additionally provide
+     * `evalFromR2Impl(T r2)` returning energy and force over distance if it
+     * can do better than taking the square root of @p r2, and
+     * `evalFromDistanceImpl(const PairDistance<T>&)` if it can reuse
+     * precomputed powers of the distance, and `energyFromR2Impl(T r2)` if
+     * it can skip the force term when only energies are requested. All
+     * public entry points are non-virtual and can therefore be inlined into
+     * the calling pair loop.
+     *
+     * As for LiePotential, the reported force is the radial derivative
+     * \f$dE/dr\f$ of the energy, i.e. the force acting on particle \f$i\f$
+     * is \f$-F \, \vec{r}_{ij} / r\f$ with \f$\vec{r}_{ij} = \vec{r}_i -
+     * \vec{r}_j\f$.
+     *
+     * The lane type `T` of the scalar entry points defaults to @p Rep and can
+     * be set explicitly to a `SimdVec<Rep>` to evaluate several distances at
+     * once.
+     *
+     * @tparam Derived the concrete potential.
+     * @tparam Rep numeric representation.
+     */
+    template <typename Derived, typename Rep>
+    class PotentialBase
+    {
+       public:
+        using rep = Rep;
+
+        /// @brief Evaluates only the potential energy at a distance @p r.
+        template <typename T = Rep>
+        constexpr T evalEnergy(const std::type_identity_t<T> r) const
+        {
+            return _derived().template evalImpl<T>(r).first;
+        }
+
+        /// @brief Evaluates only the force magnitude at a distance @p r.
+        template <typename T = Rep>
+        constexpr T evalForce(const std::type_identity_t<T> r) const
+        {
+            return _derived().template evalImpl<T>(r).second;
+        }
+
+        /// @brief Returns both energy and force evaluated at @p r.
+        template <typename T = Rep>
+        constexpr std::pair<T, T> eval(const std::type_identity_t<T> r) const
+        {
+            return _derived().template evalImpl<T>(r);
+        }
+
+        /**
+         * @brief Evaluates energy and force for every distance in @p r.
+         *
+         * @pre `energy.size() >= r.size()` and `force.size() >= r.size()`
+         *
+         * @param r distances.
+         * @param energy output energies.
+         * @param force output force magnitudes.
+         */
+        void evalBatch(
+            std::span<const Rep> r,
+            std::span<Rep>       energy,
+            std::span<Rep>       force
+        ) const
+        {
+            const auto& self = _derived();
+
+            simdTransform(
+                r,
+                energy,
+                force,
+                [&self]<typename T>(const T x)
+                { return self.template evalImpl<T>(x); }
+            );
+        }
+
+        /**
+         * @brief Returns energy and force over distance from @p r2.
+         *
+         * @param r2 squared distance.
+         * @return pair of energy and \f$F/r\f$.
+         */
+        template <typename T = Rep>
+        constexpr std::pair<T, T> evalFromR2(
+            const std::type_identity_t<T> r2
+        ) const
+        {
+            const auto& self = _derived();
+
+            if constexpr (requires { self.template evalFromR2Impl<T>(r2); })
+                return self.template evalFromR2Impl<T>(r2);
+            else
+            {
+                const auto r               = simdSqrt(r2);
+                const auto [energy, force] = self.template evalImpl<T>(r);
+                return {energy, force / r};
+            }
+        }
+
+        /**
+         * @brief Returns only the energy from @p r2.
+         *
+         * Uses `energyFromR2Impl` if the derived class provides it and the
+         * energy of evalFromR2 otherwise.
+         */
+        template <typename T = Rep>
+        constexpr T energyFromR2(const std::type_identity_t<T> r2) const
+        {
+            const auto& self = _derived();
+
+            if constexpr (requires { self.template energyFromR2Impl<T>(r2); })
+                return self.template energyFromR2Impl<T>(r2);
+            else
+                return evalFromR2<T>(r2).first;
+        }
+
+        /**
+         * @brief Returns energy and force over distance from the shared
+         *        powers @p distance of the distance.
+         *
+         * Falls back to `evalFromR2Impl` and then to `evalImpl` if the
+         * derived class does not use the precomputed powers.
+         *
+         * @param distance powers of the distance, see PairDistance.
+         * @return pair of energy and \f$F/r\f$.
+         */
+        template <typename T = Rep>
+        constexpr std::pair<T, T> evalFromDistance(
+            const PairDistance<T>& distance
+        ) const
+        {
+            const auto& self = _derived();
+
+            if constexpr (requires {
+                              self.template evalFromDistanceImpl<T>(distance);
+                          })
+                return self.template evalFromDistanceImpl<T>(distance);
+            else if constexpr (requires {
+                                   self.template evalFromR2Impl<T>(distance.r2);
+                               })
+                return self.template evalFromR2Impl<T>(distance.r2);
+            else
+            {
+                const auto [energy, force] =
+                    self.template evalImpl<T>(distance.r);
+                return {energy, force * distance.invR};
+            }
+        }
+
+        /**
+         * @brief Batch counterpart of evalFromR2.
+         *
+         * @pre `energy.size() >= r2.size()` and
+         *      `forceOverR.size() >= r2.size()`
+         *
+         * @param r2 squared distances.
+         * @param energy output energies.
+         * @param forceOverR output forces divided by the distance.
+         */
+        void evalBatchFromR2(
+            std::span<const Rep> r2,
+            std::span<Rep>       energy,
+            std::span<Rep>       forceOverR
+        ) const
+        {
+            simdTransform(
+                r2,
+                energy,
+                forceOverR,
+                [this]<typename T>(const T x)
+                { return this->template evalFromR2<T>(x); }
+            );
+        }
+
+       private:
+        constexpr const Derived& _derived() const
+        {
+            return static_cast<const Derived&>(*this);
+        }
+    };
+
+}   // namespace mstd
+
+#endif   // __MSTD__PHYSICS__POTENTIALS__POTENTIAL_BASE_HPP__
@@ -0,0 +1,406 @@
+/*****************************************************************************
+<GPL_HEADER>
+
+    mstd library
+    Copyright (C) 2025-now  Jakob Gamper
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+<GPL_HEADER>
+******************************************************************************/
+
+#ifndef __MSTD__PHYSICS__POTENTIALS__STATIC_LIE_POTENTIAL_HPP__
+#define __MSTD__PHYSICS__POTENTIALS__STATIC_LIE_POTENTIAL_HPP__
+
+#include <stdexcept>
+#include <tuple>
+#include <utility>
+
+#include "lie_potential_impl.hpp"
+#include "mstd/simd.hpp"
+#include "pair_distance.hpp"
+#include "potential_base.hpp"
+
+namespace mstd
+{
+    /**
+     * @brief Non-virtual counterpart of LiePotential.
+     *
+     * Carries no vptr and dispatches statically through PotentialBase, so the
+     * whole evaluation can be inlined into the pair loop. Use AnyPotential if
+     * runtime polymorphism is required.
+     */
+    template <size_t M, size_t N, typename Rep = double>
+    class StaticLiePotential
+        : public PotentialBase<StaticLiePotential<M, N, Rep>, Rep>
+    {
+       private:
+        friend class PotentialBase<StaticLiePotential<M, N, Rep>, Rep>;
+
+        Rep _coeff1{};
+        Rep _coeff2{};
+
+       public:
+        /**
+         * @brief Constructs the potential with prefactors for the attractive
+         *        and repulsive terms.
+         *
+         * @param c1 Coefficient for the attractive term.
+         * @param c2 Coefficient for the repulsive term.
+         */
+        constexpr StaticLiePotential(Rep c1, Rep c2)
+            : _coeff1(c1), _coeff2(c2)
+        {
+        }
+
+        /// @brief Returns the coefficient of the attractive term.
+        constexpr Rep coeff1() const { return _coeff1; }
+
+        /// @brief Returns the coefficient of the repulsive term.
+        constexpr Rep coeff2() const { return _coeff2; }
+
+       private:
+        template <typename T>
+        constexpr std::pair<T, T> evalImpl(const T r) const
+        {
+            return liePotential<M, N, T>(
+                simdBroadcast<T>(_coeff1),
+                simdBroadcast<T>(_coeff2),
+                r
+            );
+        }
+
+        template <typename T>
+        constexpr std::pair<T, T> evalFromR2Impl(const T r2) const
+        {
+            return liePotentialFromR2<M, N, T>(
+                simdBroadcast<T>(_coeff1),
+                simdBroadcast<T>(_coeff2),
+                r2
+            );
+        }
+
+        template <typename T>
+        constexpr T energyFromR2Impl(const T r2) const
+        {
+            return liePotentialEnergyFromR2<M, N, T>(
+                simdBroadcast<T>(_coeff1),
+                simdBroadcast<T>(_coeff2),
+                r2
+            );
+        }
+
+        template <typename T>
+        constexpr std::pair<T, T> evalFromDistanceImpl(
+            const PairDistance<T>& d
+        ) const
+        {
+            return liePotentialFromDistance<M, N, T>(
+                simdBroadcast<T>(_coeff1),
+                simdBroadcast<T>(_coeff2),
+                d
+            );
+        }
+    };
+
+    template <typename Rep = double>
+    using StaticLJPotential = StaticLiePotential<6, 12, Rep>;
+
+    /**
+     * @brief Non-virtual counterpart of LieShiftedPotential.
+     */
+    template <size_t M, size_t N, typename Rep = double>
+    class StaticLieShiftedPotential
+        : public PotentialBase<StaticLieShiftedPotential<M, N, Rep>, Rep>
+    {
+       private:
+        friend class PotentialBase<StaticLieShiftedPotential<M, N, Rep>, Rep>;
+
+        StaticLiePotential<M, N, Rep> _potential;
+
+        Rep _radialCutoff{};
+        Rep _energyCutoff{};
+        Rep _forceCutoff{};
+
+       public:
+        /// @brief Builds the shifted potential from coefficients and cutoff
+        ///        radius.
+        constexpr StaticLieShiftedPotential(Rep c1, Rep c2, Rep rc)
+            : _potential(c1, c2), _radialCutoff(rc)
+        {
+            std::tie(_energyCutoff, _forceCutoff) = _potential.eval(rc);
+        }
+
+        /// @brief Returns the coefficient of the attractive term.
+        constexpr Rep coeff1() const { return _potential.coeff1(); }
+
+        /// @brief Returns the coefficient of the repulsive term.
+        constexpr Rep coeff2() const { return _potential.coeff2(); }
+
+        /// @brief Returns the radial cutoff.
+        constexpr Rep radialCutoff() const { return _radialCutoff; }
+
+        /// @brief Returns the unshifted energy at the cutoff.
+        constexpr Rep energyCutoff() const { return _energyCutoff; }
+
+        /// @brief Returns the unshifted force at the cutoff.
+        constexpr Rep forceCutoff() const { return _forceCutoff; }
+
+       private:
+        template <typename T>
+        constexpr std::pair<T, T> evalImpl(const T r) const
+        {
+            const auto forceCutoff = simdBroadcast<T>(_forceCutoff);
+
+            const auto [energy, force] = _potential.template eval<T>(r);
+
+            return {
+                energy - simdBroadcast<T>(_energyCutoff) -
+                    forceCutoff * (r - simdBroadcast<T>(_radialCutoff)),
+                force - forceCutoff
+            };
+        }
+
+        // the linear energy correction needs r itself, so one square root
+        // remains even for even exponents
+        template <typename T>
+        std::pair<T, T> evalFromR2Impl(const T r2) const
+        {
+            return evalFromDistanceImpl<T>(PairDistance<T>::fromR2(r2));
+        }
+
+        template <typename T>
+        T energyFromR2Impl(const T r2) const
+        {
+            return _potential.template energyFromR2<T>(r2) -
+                   simdBroadcast<T>(_energyCutoff) -
+                   simdBroadcast<T>(_forceCutoff) *
+                       (simdSqrt(r2) - simdBroadcast<T>(_radialCutoff));
+        }
+
+        template <typename T>
+        constexpr std::pair<T, T> evalFromDistanceImpl(
+            const PairDistance<T>& d
+        ) const
+        {
+            const auto forceCutoff = simdBroadcast<T>(_forceCutoff);
+
+            const auto [energy, forceOverR] =
+                _potential.template evalFromDistance<T>(d);
+
+            return {
+                energy - simdBroadcast<T>(_energyCutoff) -
+                    forceCutoff * (d.r - simdBroadcast<T>(_radialCutoff)),
+                forceOverR - forceCutoff * d.invR
+            };
+        }
+    };
+
+    template <typename Rep = double>
+    using StaticLJShiftedPotential = StaticLieShiftedPotential<6, 12, Rep>;
+
+    /**
+     * @brief Non-virtual counterpart of LieSwitchedPotential.
+     */
+    template <size_t M, size_t N, typename Rep = double>
+    class StaticLieSwitchedPotential
+        : public PotentialBase<StaticLieSwitchedPotential<M, N, Rep>, Rep>
+    {
+       private:
+        friend class PotentialBase<StaticLieSwitchedPotential<M, N, Rep>, Rep>;
+
+        StaticLiePotential<M, N, Rep> _potential;
+
+        Rep _switchRadius{};
+        Rep _radialCutoff{};
+        Rep _switch2{};
+        Rep _invWidth2{};
+
+       public:
+        /**
+         * @brief Builds the switched potential from coefficients, switching
+         *        radius and cutoff radius.
+         *
+         * @throws std::invalid_argument unless 0 <= rs < rc.
+         */
+        constexpr StaticLieSwitchedPotential(Rep c1, Rep c2, Rep rs, Rep rc)
+            : _potential(c1, c2),
+              _switchRadius(rs),
+              _radialCutoff(rc),
+              _switch2(rs * rs)
+        {
+            if (!(rs >= 0 && rs < rc))
+                throw std::invalid_argument(
+                    "StaticLieSwitchedPotential requires 0 <= rs < rc"
+                );
+
+            _invWidth2 = 1 / (rc * rc - rs * rs);
+        }
+
+        /// @brief Returns the coefficient of the attractive term.
+        constexpr Rep coeff1() const { return _potential.coeff1(); }
+
+        /// @brief Returns the coefficient of the repulsive term.
+        constexpr Rep coeff2() const { return _potential.coeff2(); }
+
+        /// @brief Returns the switching radius.
+        constexpr Rep switchRadius() const { return _switchRadius; }
+
+        /// @brief Returns the radial cutoff.
+        constexpr Rep radialCutoff() const { return _radialCutoff; }
+
+       private:
+        template <typename T>
+        constexpr std::pair<T, T> evalImpl(const T r) const
+        {
+            const auto [energy, forceOverR] = evalFromR2Impl<T>(r * r);
+            return {energy, forceOverR * r};
+        }
+
+        template <typename T>
+        constexpr std::pair<T, T> evalFromR2Impl(const T r2) const
+        {
+            return lieSwitchedFromR2<M, N, T>(
+                simdBroadcast<T>(coeff1()),
+                simdBroadcast<T>(coeff2()),
+                r2,
+                simdBroadcast<T>(_switch2),
+                simdBroadcast<T>(_invWidth2)
+            );
+        }
+
+        template <typename T>
+        constexpr T energyFromR2Impl(const T r2) const
+        {
+            const auto switching = switchingFromR2<T>(
+                r2,
+                simdBroadcast<T>(_switch2),
+                simdBroadcast<T>(_invWidth2)
+            );
+
+            return switching.first * _potential.template energyFromR2<T>(r2);
+        }
+
+        template <typename T>
+        constexpr std::pair<T, T> evalFromDistanceImpl(
+            const PairDistance<T>& d
+        ) const
+        {
+            const auto [energy, forceOverR] =
+                _potential.template evalFromDistance<T>(d);
+            const auto [s, dsOverR] = switchingFromR2<T>(
+                d.r2,
+                simdBroadcast<T>(_switch2),
+                simdBroadcast<T>(_invWidth2)
+            );
+
+            return {s * energy, s * forceOverR + dsOverR * energy};
+        }
+    };
+
+    template <typename Rep = double>
+    using StaticLJSwitchedPotential = StaticLieSwitchedPotential<6, 12, Rep>;
+
+    /**
+     * @brief Non-virtual counterpart of LieForceSwitchedPotential.
+     */
+    template <size_t M, size_t N, typename Rep = double>
+    class StaticLieForceSwitchedPotential
+        : public PotentialBase<StaticLieForceSwitchedPotential<M, N, Rep>, Rep>
+    {
+       private:
+        friend class PotentialBase<
+            StaticLieForceSwitchedPotential<M, N, Rep>,
+            Rep>;
+
+        StaticLiePotential<M, N, Rep> _potential;
+
+        details::ForceSwitch<Rep> _switch;
+
+       public:
+        /**
+         * @brief Builds the force-switched potential from coefficients,
+         *        switching radius and cutoff radius.
+         *
+         * @throws std::invalid_argument unless 0 <= rs < rc.
+         */
+        constexpr StaticLieForceSwitchedPotential(
+            Rep c1,
+            Rep c2,
+            Rep rs,
+            Rep rc
+        )
+            : _potential(c1, c2)
+        {
+            if (!(rs >= 0 && rs < rc))
+                throw std::invalid_argument(
+                    "StaticLieForceSwitchedPotential requires 0 <= rs < rc"
+                );
+
+            _switch = details::ForceSwitch<Rep>::template forLie<M, N>(
+                c1,
+                c2,
+                rs,
+                rc
+            );
+        }
+
+        /// @brief Returns the coefficient of the attractive term.
+        constexpr Rep coeff1() const { return _potential.coeff1(); }
+
+        /// @brief Returns the coefficient of the repulsive term.
+        constexpr Rep coeff2() const { return _potential.coeff2(); }
+
+        /// @brief Returns the switching radius.
+        constexpr Rep switchRadius() const { return _switch.switchRadius; }
+
+        /// @brief Returns the radial cutoff.
+        constexpr Rep radialCutoff() const { return _switch.radialCutoff; }
+
+       private:
+        template <typename T>
+        constexpr std::pair<T, T> evalImpl(const T r) const
+        {
+            const auto [energy, forceOverR] =
+                evalFromDistanceImpl<T>(PairDistance<T>::fromR(r));
+            return {energy, forceOverR * r};
+        }
+
+        // the correction needs r itself, so one square root remains even
+        // for even exponents
+        template <typename T>
+        std::pair<T, T> evalFromR2Impl(const T r2) const
+        {
+            return evalFromDistanceImpl<T>(PairDistance<T>::fromR2(r2));
+        }
+
+        template <typename T>
+        constexpr std::pair<T, T> evalFromDistanceImpl(
+            const PairDistance<T>& d
+        ) const
+        {
+            return _switch.applyFromDistance(
+                _potential.template evalFromDistance<T>(d),
+                d
+            );
+        }
+    };
+
+    template <typename Rep = double>
+    using StaticLJForceSwitchedPotential =
+        StaticLieForceSwitchedPotential<6, 12, Rep>;
+
+}   // namespace mstd
+
+#endif   // __MSTD__PHYSICS__POTENTIALS__STATIC_LIE_POTENTIAL_HPP__
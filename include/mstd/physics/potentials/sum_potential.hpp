@@ -0,0 +1,151 @@
+/*****************************************************************************
+<GPL_HEADER>
+
+    mstd library
+    Copyright (C) 2025-now  Jakob Gamper
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+<GPL_HEADER>
+******************************************************************************/
+
+#ifndef __MSTD__PHYSICS__POTENTIALS__SUM_POTENTIAL_HPP__
+#define __MSTD__PHYSICS__POTENTIALS__SUM_POTENTIAL_HPP__
+
+#include <concepts>
+#include <cstddef>
+#include <tuple>
+#include <utility>
+
+#include "pair_distance.hpp"
+#include "potential_base.hpp"
+
+namespace mstd
+{
+    namespace details
+    {
+        /// @brief representation of the first potential in @p Terms
+        template <typename... Terms>
+        using FirstRep =
+            typename std::tuple_element_t<0, std::tuple<Terms...>>::rep;
+
+    }   // namespace details
+
+    /**
+     * @brief Compile-time sum of statically dispatched pair potentials.
+     *
+     * All terms are evaluated for the same pair inside one call, so a pair
+     * kernel walks the pair list once for the whole sum instead of once per
+     * term. The square root and the division are taken once per pair and
+     * handed to every term as PairDistance through `evalFromDistance`.
+     *
+     * Sums may be nested and used as short-range part of a
+     * ChargedPairPotential.
+     *
+     * @code
+     * const SumPotential sum(
+     *     StaticLJShiftedPotential<>(c6, c12, rc),
+     *     CoulombReactionFieldPotential<>(c, rc, epsRF)
+     * );
+     * @endcode
+     *
+     * @tparam Terms potentials derived from PotentialBase sharing one
+     *         representation.
+     */
+    template <typename... Terms>
+        requires(sizeof...(Terms) > 0) &&
+                (std::derived_from<
+                     Terms,
+                     PotentialBase<Terms, typename Terms::rep>> &&
+                 ...) &&
+                (std::same_as<
+                     typename Terms::rep,
+                     details::FirstRep<Terms...>> &&
+                 ...)
+    class SumPotential
+        : public PotentialBase<
+              SumPotential<Terms...>,
+              details::FirstRep<Terms...>>
+    {
+       private:
+        using Rep = details::FirstRep<Terms...>;
+
+        friend class PotentialBase<SumPotential<Terms...>, Rep>;
+
+        std::tuple<Terms...> _terms;
+
+       public:
+        /// @brief Builds the sum from its terms.
+        constexpr explicit SumPotential(Terms... terms)
+            : _terms(std::move(terms)...)
+        {
+        }
+
+        /// @brief Returns the number of terms.
+        static constexpr size_t size() { return sizeof...(Terms); }
+
+        /// @brief Returns the term @p I.
+        template <size_t I>
+        constexpr const auto& term() const
+        {
+            return std::get<I>(_terms);
+        }
+
+       private:
+        template <typename T>
+        constexpr std::pair<T, T> evalImpl(const T r) const
+        {
+            const auto [energy, forceOverR] =
+                evalFromDistanceImpl<T>(PairDistance<T>::fromR(r));
+            return {energy, forceOverR * r};
+        }
+
+        template <typename T>
+        std::pair<T, T> evalFromR2Impl(const T r2) const
+        {
+            return evalFromDistanceImpl<T>(PairDistance<T>::fromR2(r2));
+        }
+
+        template <typename T>
+        constexpr std::pair<T, T> evalFromDistanceImpl(
+            const PairDistance<T>& d
+        ) const
+        {
+            return std::apply(
+                [&d](const auto&... terms)
+                {
+                    std::pair<T, T> sum{};
+                    (
+                        [&]
+                        {
+                            const auto [e, f] =
+                                terms.template evalFromDistance<T>(d);
+                            sum.first  += e;
+                            sum.second += f;
+                        }(),
+                        ...
+                    );
+                    return sum;
+                },
+                _terms
+            );
+        }
+    };
+
+    template <typename... Terms>
+    SumPotential(Terms...) -> SumPotential<Terms...>;
+
+}   // namespace mstd
+
+#endif   // __MSTD__PHYSICS__POTENTIALS__SUM_POTENTIAL_HPP__
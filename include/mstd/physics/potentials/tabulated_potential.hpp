@@ -0,0 +1,491 @@
+/*****************************************************************************
+<GPL_HEADER>
+
+    mstd library
+    Copyright (C) 2025-now  Jakob Gamper
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+<GPL_HEADER>
+******************************************************************************/
+
+#ifndef __MSTD__PHYSICS__POTENTIALS__TABULATED_POTENTIAL_HPP__
+#define __MSTD__PHYSICS__POTENTIALS__TABULATED_POTENTIAL_HPP__
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "mstd/memory.hpp"
+#include "mstd/simd.hpp"
+#include "mstd/type_traits/physics_traits.hpp"
+#include "potential_base.hpp"
+#include "static_lie_potential.hpp"
+
+namespace mstd
+{
+    /**
+     * @brief Variable in which the grid of a TabulatedPotential is uniform.
+     */
+    enum class TableSpacing
+    {
+        R,    ///< uniform in the distance r
+        R2    ///< uniform in r², evaluable from r² without a square root
+    };
+
+    namespace details
+    {
+        /**
+         * @brief Cubic Hermite polynomial on the unit interval.
+         *
+         * Returns the coefficients \f$a_0 \dots a_3\f$ of
+         * \f$p(t) = a_0 + a_1 t + a_2 t^2 + a_3 t^3\f$ with \f$p(0) = p_0\f$,
+         * \f$p(1) = p_1\f$, \f$p'(0) = m_0\f$ and \f$p'(1) = m_1\f$.
+         */
+        template <typename Rep>
+        constexpr std::array<Rep, 4> hermiteSegment(
+            const Rep p0,
+            const Rep p1,
+            const Rep m0,
+            const Rep m1
+        )
+        {
+            return {
+                p0,
+                m0,
+                3 * (p1 - p0) - 2 * m0 - m1,
+                2 * (p0 - p1) + m0 + m1
+            };
+        }
+
+    }   // namespace details
+
+    /**
+     * @brief Pair potential interpolated from a precomputed table.
+     *
+     * The energy of any PairPotentialType is sampled together with its
+     * derivative on a grid that is uniform in r or in r² (see TableSpacing)
+     * and interpolated with cubic Hermite polynomials, so energy and force are
+     * continuous and consistent with each other. Beyond the radial cutoff the
+     * table returns zero; below the first grid point the first segment is
+     * extrapolated.
+     *
+     * Each segment stores its four polynomial coefficients contiguously, so a
+     * lookup touches exactly one 32 byte block (double) of a cache-line
+     * aligned array. A table of 1024 segments therefore occupies 32 KiB and
+     * stays resident in L1, 8192 segments (256 KiB) in L2.
+     *
+     * The maximum deviation from the analytic potential is measured during
+     * construction and reported by maxEnergyError and maxForceError.
+     *
+     * With a fixed number of segments the table is a `std::array` built by
+     * a `consteval` constructor from any potential that evaluates in
+     * constant expressions, e.g. StaticLieShiftedPotential. A `constexpr`
+     * table then sits in `.rodata`, costs nothing at startup, and its grid
+     * spacing folds into the code evaluating it, see tabulateLiePotential.
+     *
+     * @tparam Rep numeric representation.
+     * @tparam Spacing grid variable.
+     * @tparam NSegments number of segments, `std::dynamic_extent` for tables
+     *         sized at runtime.
+     */
+    template <
+        typename Rep         = double,
+        TableSpacing Spacing = TableSpacing::R2,
+        size_t NSegments     = std::dynamic_extent>
+    class TabulatedPotential
+        : public PotentialBase<TabulatedPotential<Rep, Spacing, NSegments>, Rep>
+    {
+       private:
+        friend class PotentialBase<
+            TabulatedPotential<Rep, Spacing, NSegments>,
+            Rep>;
+
+        static constexpr bool _isDynamic = NSegments == std::dynamic_extent;
+
+        struct alignas(4 * sizeof(Rep)) Segment
+        {
+            std::array<Rep, 4> coeffs;
+        };
+
+        using Storage = std::conditional_t<
+            _isDynamic,
+            AlignedVector<Segment>,
+            std::array<Segment, NSegments>>;
+
+        alignas(_isDynamic ? alignof(Storage) : cache_line_bytes)
+            Storage _segments{};
+
+        Rep _rMin{};
+        Rep _rCut{};
+        Rep _gridMin{};
+        Rep _gridCut{};
+        Rep _invSpacing{};
+
+        Rep _maxEnergyError{};
+        Rep _maxForceError{};
+
+       public:
+        /**
+         * @brief Tabulates @p potential on [@p rMin, @p rCut].
+         *
+         * @param potential analytic source potential.
+         * @param rMin smallest tabulated distance.
+         * @param rCut radial cutoff, the table is zero beyond.
+         * @param nSegments number of interpolation segments.
+         *
+         * @throws std::invalid_argument if `0 < rMin < rCut` is violated or
+         *         @p nSegments is zero.
+         */
+        template <PairPotentialType P>
+        requires std::is_same_v<typename P::rep, Rep> && _isDynamic
+        TabulatedPotential(
+            const P&     potential,
+            const Rep    rMin,
+            const Rep    rCut,
+            const size_t nSegments
+        )
+            : _rMin(rMin), _rCut(rCut)
+        {
+            _init(potential, nSegments);
+        }
+
+        /**
+         * @brief Tabulates @p potential on [@p rMin, @p rCut] at compile
+         *        time into NSegments segments.
+         *
+         * @p potential has to be evaluable in constant expressions. Invalid
+         * arguments are reported as compile errors.
+         */
+        template <PairPotentialType P>
+        requires std::is_same_v<typename P::rep, Rep> && (!_isDynamic)
+        consteval TabulatedPotential(
+            const P&  potential,
+            const Rep rMin,
+            const Rep rCut
+        )
+            : _rMin(rMin), _rCut(rCut)
+        {
+            _init(potential, NSegments);
+        }
+
+        /**
+         * @brief Builds the smallest power-of-two table meeting @p tolerance.
+         *
+         * Starting from 64 segments the table size is doubled until both the
+         * measured energy and force errors are below @p tolerance.
+         *
+         * @param potential analytic source potential.
+         * @param rMin smallest tabulated distance.
+         * @param rCut radial cutoff.
+         * @param tolerance absolute error bound for energy and force.
+         * @param maxSegments upper limit of the table size.
+         *
+         * @throws std::runtime_error if @p maxSegments segments do not reach
+         *         the requested tolerance.
+         */
+        template <PairPotentialType P>
+        requires std::is_same_v<typename P::rep, Rep> && _isDynamic
+        static TabulatedPotential withTolerance(
+            const P&     potential,
+            const Rep    rMin,
+            const Rep    rCut,
+            const Rep    tolerance,
+            const size_t maxSegments = size_t{1} << 16
+        )
+        {
+            for (size_t n = 64; n <= maxSegments; n *= 2)
+            {
+                TabulatedPotential table(potential, rMin, rCut, n);
+                if (table.maxError() <= tolerance)
+                    return table;
+            }
+
+            throw std::runtime_error(
+                "TabulatedPotential: tolerance not reachable within "
+                "maxSegments"
+            );
+        }
+
+        /// @brief Returns the number of interpolation segments.
+        constexpr size_t size() const { return _segments.size(); }
+
+        /// @brief Returns the size of the table in bytes.
+        constexpr size_t memoryBytes() const
+        {
+            return size() * sizeof(Segment);
+        }
+
+        /// @brief Returns the smallest tabulated distance.
+        constexpr Rep rMin() const { return _rMin; }
+
+        /// @brief Returns the radial cutoff.
+        constexpr Rep radialCutoff() const { return _rCut; }
+
+        /// @brief Returns the grid spacing in the grid variable.
+        constexpr Rep spacing() const { return 1 / _invSpacing; }
+
+        /// @brief Largest measured absolute energy error.
+        constexpr Rep maxEnergyError() const { return _maxEnergyError; }
+
+        /// @brief Largest measured absolute force error.
+        constexpr Rep maxForceError() const { return _maxForceError; }
+
+        /// @brief Largest of maxEnergyError and maxForceError.
+        constexpr Rep maxError() const
+        {
+            return std::max(_maxEnergyError, _maxForceError);
+        }
+
+       private:
+        template <typename P>
+        constexpr void _init(const P& potential, const size_t nSegments)
+        {
+            if (!(_rMin > 0) || !(_rCut > _rMin))
+                throw std::invalid_argument(
+                    "TabulatedPotential requires 0 < rMin < rCut"
+                );
+
+            if (nSegments == 0)
+                throw std::invalid_argument(
+                    "TabulatedPotential requires at least one segment"
+                );
+
+            _gridMin = _toGrid(_rMin);
+            _gridCut = _toGrid(_rCut);
+
+            const auto spacing =
+                (_gridCut - _gridMin) / static_cast<Rep>(nSegments);
+            _invSpacing = 1 / spacing;
+
+            _build(potential, nSegments, spacing);
+            _measureError(potential);
+        }
+
+        static constexpr Rep _toGrid(const Rep r)
+        {
+            if constexpr (Spacing == TableSpacing::R)
+                return r;
+            else
+                return r * r;
+        }
+
+        /// derivative of the energy with respect to the grid variable
+        static constexpr Rep _gridDerivative(const Rep r, const Rep force)
+        {
+            if constexpr (Spacing == TableSpacing::R)
+                return force;
+            else
+                return force / (2 * r);
+        }
+
+        template <typename P>
+        constexpr void _build(
+            const P&     potential,
+            const size_t nSegments,
+            const Rep    spacing
+        )
+        {
+            if constexpr (_isDynamic)
+                _segments.resize(nSegments);
+
+            const auto node = [&](const size_t k)
+            {
+                const auto s = _gridMin + spacing * static_cast<Rep>(k);
+                const auto r = k == nSegments ? _rCut : _fromGrid(s);
+
+                const auto [energy, force] = potential.eval(r);
+                return std::pair<Rep, Rep>{
+                    energy,
+                    _gridDerivative(r, force) * spacing
+                };
+            };
+
+            auto [p0, m0] = node(0);
+            for (size_t k = 0; k < nSegments; ++k)
+            {
+                const auto [p1, m1] = node(k + 1);
+                _segments[k].coeffs = details::hermiteSegment(p0, p1, m0, m1);
+                p0                  = p1;
+                m0                  = m1;
+            }
+        }
+
+        template <typename P>
+        constexpr void _measureError(const P& potential)
+        {
+            const auto spacing = 1 / _invSpacing;
+
+            for (size_t k = 0; k < _segments.size(); ++k)
+            {
+                for (const Rep t : {Rep(0.25), Rep(0.5), Rep(0.75)})
+                {
+                    const auto s =
+                        _gridMin + spacing * (static_cast<Rep>(k) + t);
+                    const auto r = _fromGrid(s);
+
+                    const auto [energy, force] = potential.eval(r);
+                    const auto [e, f]          = evalImpl(r);
+
+                    _maxEnergyError =
+                        std::max(_maxEnergyError, std::abs(e - energy));
+                    _maxForceError =
+                        std::max(_maxForceError, std::abs(f - force));
+                }
+            }
+        }
+
+        static constexpr Rep _fromGrid(const Rep s)
+        {
+            if constexpr (Spacing == TableSpacing::R)
+                return s;
+            else
+                return simdSqrt(s);
+        }
+
+        /// index of the segment containing grid coordinate @p x
+        constexpr size_t _segmentIndex(const Rep x) const
+        {
+            const auto last = static_cast<Rep>(_segments.size() - 1);
+            return x > 0 ? static_cast<size_t>(std::min(x, last)) : 0;
+        }
+
+        /**
+         * @brief Interpolated energy and its derivative with respect to the
+         *        grid variable @p s.
+         */
+        template <typename T>
+        constexpr std::pair<T, T> _interpolate(const T s) const
+        {
+            const auto x = (s - simdBroadcast<T>(_gridMin)) *
+                           simdBroadcast<T>(_invSpacing);
+
+            T t{};
+            T c0{};
+            T c1{};
+            T c2{};
+            T c3{};
+
+            if constexpr (is_simd_vec_v<T>)
+            {
+                for (size_t lane = 0; lane < simd_size_v<T>; ++lane)
+                {
+                    const auto  index  = _segmentIndex(x[lane]);
+                    const auto& coeffs = _segments[index].coeffs;
+
+                    t[lane]  = x[lane] - static_cast<Rep>(index);
+                    c0[lane] = coeffs[0];
+                    c1[lane] = coeffs[1];
+                    c2[lane] = coeffs[2];
+                    c3[lane] = coeffs[3];
+                }
+            }
+            else
+            {
+                const auto  index  = _segmentIndex(x);
+                const auto& coeffs = _segments[index].coeffs;
+
+                t  = x - static_cast<Rep>(index);
+                c0 = coeffs[0];
+                c1 = coeffs[1];
+                c2 = coeffs[2];
+                c3 = coeffs[3];
+            }
+
+            const auto energy     = ((c3 * t + c2) * t + c1) * t + c0;
+            const auto derivative = ((3 * c3 * t + 2 * c2) * t + c1) *
+                                    simdBroadcast<T>(_invSpacing);
+
+            const auto inside = s < simdBroadcast<T>(_gridCut);
+            return {inside ? energy : T{}, inside ? derivative : T{}};
+        }
+
+        template <typename T>
+        constexpr std::pair<T, T> evalImpl(const T r) const
+        {
+            if constexpr (Spacing == TableSpacing::R)
+            {
+                const auto [energy, derivative] = _interpolate(r);
+                return {energy, derivative};
+            }
+            else
+            {
+                const auto [energy, derivative] = _interpolate(r * r);
+                return {energy, 2 * derivative * r};
+            }
+        }
+
+        template <typename T>
+        constexpr std::pair<T, T> evalFromR2Impl(const T r2) const
+        {
+            if constexpr (Spacing == TableSpacing::R)
+            {
+                const auto r                    = simdSqrt(r2);
+                const auto [energy, derivative] = _interpolate(r);
+                return {energy, derivative / r};
+            }
+            else
+            {
+                const auto [energy, derivative] = _interpolate(r2);
+                return {energy, 2 * derivative};
+            }
+        }
+    };
+
+    /**
+     * @brief Compile-time table of the truncated, shifted-force Lie
+     *        potential with constant coefficients and cutoff.
+     *
+     * Declared `constexpr`, the result is placed in `.rodata`:
+     * @code
+     * static constexpr auto table =
+     *     mstd::tabulateLiePotential<6, 12, 1024>(4.0, 4.0, 0.8, 2.5);
+     * @endcode
+     *
+     * @tparam M attractive exponent.
+     * @tparam N repulsive exponent.
+     * @tparam NSegments number of interpolation segments.
+     * @tparam Spacing grid variable.
+     * @param c1 attractive prefactor.
+     * @param c2 repulsive prefactor.
+     * @param rMin smallest tabulated distance.
+     * @param rCut radial cutoff of the potential and the table.
+     */
+    template <
+        size_t M,
+        size_t N,
+        size_t NSegments,
+        TableSpacing Spacing = TableSpacing::R2,
+        typename Rep>
+    consteval TabulatedPotential<Rep, Spacing, NSegments> tabulateLiePotential(
+        const Rep c1,
+        const Rep c2,
+        const Rep rMin,
+        const Rep rCut
+    )
+    {
+        return TabulatedPotential<Rep, Spacing, NSegments>(
+            StaticLieShiftedPotential<M, N, Rep>(c1, c2, rCut),
+            rMin,
+            rCut
+        );
+    }
+
+}   // namespace mstd
+
+#endif   // __MSTD__PHYSICS__POTENTIALS__TABULATED_POTENTIAL_HPP__
@@ -0,0 +1,592 @@
+/*****************************************************************************
+<GPL_HEADER>
+
+    mstd library
+    Copyright (C) 2025-now  Jakob Gamper
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+<GPL_HEADER>
+******************************************************************************/
+
+#ifndef __MSTD__PHYSICS__SPME_HPP__
+#define __MSTD__PHYSICS__SPME_HPP__
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cmath>
+#include <complex>
+#include <cstddef>
+#include <numbers>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+#include "box.hpp"
+#include "ewald.hpp"
+#include "mstd/math/fft.hpp"
+#include "mstd/memory.hpp"
+#include "mstd/parallel.hpp"
+#include "mstd/type_traits/physics_traits.hpp"
+#include "potentials/coulomb_potential.hpp"
+
+namespace mstd
+{
+    namespace details
+    {
+        /**
+         * @brief cardinal B-spline weights and their derivatives
+         *
+         * For the fractional part @p w of a scaled coordinate u,
+         * `theta[i] = M_n(w + n - 1 - i)` is the weight of the grid point
+         * `floor(u) + i` (up to a constant shift of the whole grid) and
+         * `dtheta[i]` its derivative with respect to u.
+         *
+         * @pre order >= 2
+         */
+        template <typename Rep>
+        void bsplineWeights(
+            const Rep    w,
+            const size_t order,
+            Rep*         theta,
+            Rep*         dtheta
+        )
+        {
+            assert(order >= 2);
+
+            // order 2, then raise the order in place:
+            // M_j(x) = (x M_{j-1}(x) + (j - x) M_{j-1}(x - 1)) / (j - 1)
+            const auto raise = [&](const size_t j)
+            {
+                const auto div = 1 / static_cast<Rep>(j - 1);
+
+                theta[j - 1] = div * w * theta[j - 2];
+                for (size_t k = 1; k + 1 < j; ++k)
+                {
+                    const auto rk = static_cast<Rep>(k);
+                    const auto rj = static_cast<Rep>(j);
+
+                    theta[j - k - 1] = div * ((w + rk) * theta[j - k - 2] +
+                                              (rj - rk - w) * theta[j - k - 1]);
+                }
+                theta[0] = div * (1 - w) * theta[0];
+            };
+
+            theta[0] = 1 - w;
+            theta[1] = w;
+            for (size_t j = 2; j < order; ++j)
+                theta[j] = 0;
+
+            for (size_t j = 3; j < order; ++j)
+                raise(j);
+
+            // dM_n(x)/dx = M_{n-1}(x) - M_{n-1}(x - 1)
+            dtheta[0] = -theta[0];
+            for (size_t j = 1; j < order; ++j)
+                dtheta[j] = theta[j - 1] - theta[j];
+
+            if (order > 2)
+                raise(order);
+        }
+
+        /**
+         * @brief squared moduli \f$|b(m)|^2\f$ of the Euler exponential
+         *        splines for one dimension of @p size grid points
+         *
+         * Zeros of the denominator (e.g. m = K/2 for odd orders) are
+         * replaced by the mean of the neighbouring values.
+         */
+        template <typename Rep>
+        std::vector<Rep> bsplineModuli(const size_t size, const size_t order)
+        {
+            constexpr auto twoPi = 2 * std::numbers::pi_v<Rep>;
+
+            std::vector<Rep> theta(order), dtheta(order);
+            bsplineWeights(Rep{}, order, theta.data(), dtheta.data());
+
+            // theta[i] = M_n(n - 1 - i), so M_n(k + 1) = theta[n - 2 - k]
+            std::vector<Rep> moduli(size);
+            for (size_t m = 0; m < size; ++m)
+            {
+                Rep re{}, im{};
+                for (size_t k = 0; k + 1 < order; ++k)
+                {
+                    const auto angle = twoPi * static_cast<Rep>(m * k % size) /
+                                       static_cast<Rep>(size);
+
+                    re += theta[order - 2 - k] * std::cos(angle);
+                    im += theta[order - 2 - k] * std::sin(angle);
+                }
+
+                const auto denominator = re * re + im * im;
+                moduli[m] = denominator > Rep(1e-7) ? 1 / denominator : Rep{};
+            }
+
+            for (size_t m = 0; m < size; ++m)
+                if (moduli[m] == Rep{})
+                    moduli[m] = (moduli[(m + size - 1) % size] +
+                                 moduli[(m + 1) % size]) /
+                                2;
+
+            return moduli;
+        }
+
+    }   // namespace details
+
+    /**
+     * @brief Smooth particle mesh Ewald (SPME) reciprocal space
+     *        electrostatics of Essmann et al.
+     *
+     * The charges are spread onto a regular grid with cardinal B-splines
+     * of order n, the grid is convolved with the Ewald influence function
+     * by a real-to-complex RealFft3d and the forces are interpolated back
+     * with the analytic spline derivatives. The cost is
+     * \f$O(N n^3 + K \log K)\f$ for \f$K\f$ grid points.
+     *
+     * The full Ewald energy is the real space part, evaluated by the pair
+     * kernels with realSpacePotential() inside a cutoff, plus compute()
+     * plus selfEnergy() (plus neutralizingEnergy() for a net charge).
+     *
+     * With `nThreads > 1` every thread spreads its particles into a
+     * private grid, the grids are reduced in parallel and FFT lines as
+     * well as the force interpolation are distributed over the threads.
+     *
+     * @tparam Rep floating point representation.
+     * @tparam Box orthorhombic or triclinic periodic box.
+     */
+    template <
+        std::floating_point Rep = double,
+        BoxType Box             = OrthorhombicBox<Rep>>
+        requires std::same_as<typename Box::rep, Rep>
+    class SmoothParticleMeshEwald
+    {
+       private:
+        using Complex = std::complex<Rep>;
+
+        Box                   _box;
+        Rep                   _coeff;
+        Rep                   _alpha;
+        std::array<size_t, 3> _grid;
+        size_t                _order;
+        size_t                _nThreads;
+
+        RealFft3d<Rep>                      _fft;
+        std::array<std::vector<Rep>, 3>     _moduli;
+        std::array<std::array<Rep, 3>, 3>   _inverse{};
+        std::vector<Rep>                    _influence;
+
+        std::vector<AlignedVector<Rep>> _grids;       ///< one per thread
+        std::vector<Complex>            _spectrum;
+        AlignedVector<Rep>              _potential;
+        AlignedVector<Rep>              _theta;       ///< 3 * order per atom
+        AlignedVector<Rep>              _dtheta;      ///< 3 * order per atom
+        std::vector<size_t>             _base;        ///< 3 per atom
+        std::vector<Rep>                _energies;    ///< one per thread
+
+       public:
+        /**
+         * @brief Sets up the mesh for @p box.
+         *
+         * @param box periodic box.
+         * @param coeff electrostatic prefactor.
+         * @param alpha splitting parameter, see ewaldSplittingParameter.
+         * @param grid number of grid points per box vector.
+         * @param order B-spline order (4 is cubic).
+         * @param nThreads number of threads including the calling one.
+         *
+         * @throws std::invalid_argument unless alpha > 0, order >= 3,
+         *         every grid dimension is at least @p order and
+         *         nThreads > 0.
+         */
+        SmoothParticleMeshEwald(
+            const Box&                  box,
+            const Rep                   coeff,
+            const Rep                   alpha,
+            const std::array<size_t, 3> grid,
+            const size_t                order    = 4,
+            const size_t                nThreads = 1
+        )
+            : _box(box),
+              _coeff(coeff),
+              _alpha(alpha),
+              _grid(grid),
+              _order(order),
+              _nThreads(nThreads),
+              _fft(grid[0], grid[1], grid[2])
+        {
+            if (!(alpha > 0))
+                throw std::invalid_argument(
+                    "SmoothParticleMeshEwald requires alpha > 0"
+                );
+            if (order < 3)
+                throw std::invalid_argument(
+                    "SmoothParticleMeshEwald requires order >= 3"
+                );
+            if (std::ranges::any_of(grid, [&](auto k) { return k < order; }))
+                throw std::invalid_argument(
+                    "SmoothParticleMeshEwald requires grid >= order"
+                );
+            if (nThreads == 0)
+                throw std::invalid_argument(
+                    "SmoothParticleMeshEwald requires nThreads > 0"
+                );
+
+            for (size_t dim = 0; dim < 3; ++dim)
+                _moduli[dim] = details::bsplineModuli<Rep>(grid[dim], order);
+
+            _grids.resize(nThreads, AlignedVector<Rep>(_fft.realSize()));
+            _spectrum.resize(_fft.complexSize());
+            _potential.resize(_fft.realSize());
+            _energies.resize(nThreads);
+
+            setBox(box);
+        }
+
+        /// @brief Replaces the box and rebuilds the influence function.
+        void setBox(const Box& box)
+        {
+            constexpr auto pi = std::numbers::pi_v<Rep>;
+
+            _box     = box;
+            _inverse = details::inverseBoxMatrix(box);
+
+            const auto [nx, ny, nz] = _grid;
+            const auto nzComplex    = _fft.nzComplex();
+            const auto volume       = box.volume();
+            const auto factor       = pi * pi / (_alpha * _alpha);
+
+            const auto signedIndex = [](const size_t k, const size_t n)
+            {
+                return k <= n / 2
+                           ? static_cast<Rep>(k)
+                           : static_cast<Rep>(k) - static_cast<Rep>(n);
+            };
+
+            _influence.assign(_fft.complexSize(), Rep{});
+            for (size_t kx = 0; kx < nx; ++kx)
+                for (size_t ky = 0; ky < ny; ++ky)
+                    for (size_t kz = 0; kz < nzComplex; ++kz)
+                    {
+                        if (kx == 0 && ky == 0 && kz == 0)
+                            continue;
+
+                        const auto m = details::reciprocalVector(
+                            _inverse,
+                            signedIndex(kx, nx),
+                            signedIndex(ky, ny),
+                            signedIndex(kz, nz)
+                        );
+
+                        const auto m2 = m[0] * m[0] + m[1] * m[1] + m[2] * m[2];
+                        const auto moduli =
+                            _moduli[0][kx] * _moduli[1][ky] * _moduli[2][kz];
+
+                        _influence[(kx * ny + ky) * nzComplex + kz] =
+                            moduli * std::exp(-factor * m2) /
+                            (pi * volume * m2);
+                    }
+        }
+
+        /// @brief Returns the box.
+        const Box& box() const { return _box; }
+
+        /// @brief Returns the electrostatic prefactor.
+        Rep coeff() const { return _coeff; }
+
+        /// @brief Returns the splitting parameter.
+        Rep alpha() const { return _alpha; }
+
+        /// @brief Returns the number of grid points per box vector.
+        const std::array<size_t, 3>& grid() const { return _grid; }
+
+        /// @brief Returns the B-spline order.
+        size_t order() const { return _order; }
+
+        /// @brief Returns the number of threads.
+        size_t nThreads() const { return _nThreads; }
+
+        /// @brief Returns the matching real space pair potential.
+        CoulombEwaldPotential<Rep> realSpacePotential() const
+        {
+            return CoulombEwaldPotential<Rep>(_coeff, _alpha);
+        }
+
+        /**
+         * @brief Returns the self interaction correction
+         *        \f$-c \alpha / \sqrt{\pi} \sum_i q_i^2\f$.
+         */
+        Rep selfEnergy(std::span<const Rep> charges) const
+        {
+            constexpr auto invSqrtPi = std::numbers::inv_sqrtpi_v<Rep>;
+
+            return details::coulombSelfEnergy(
+                _coeff,
+                2 * _alpha * invSqrtPi,
+                charges
+            );
+        }
+
+        /**
+         * @brief Returns the energy \f$-c \pi Q^2 / (2 V \alpha^2)\f$ of a
+         *        uniform background neutralizing the net charge Q.
+         */
+        Rep neutralizingEnergy(std::span<const Rep> charges) const
+        {
+            constexpr auto pi = std::numbers::pi_v<Rep>;
+
+            Rep total{};
+            for (const auto q : charges)
+                total += q;
+
+            return -_coeff * pi * total * total /
+                   (2 * _box.volume() * _alpha * _alpha);
+        }
+
+        /**
+         * @brief Computes the reciprocal space energy and adds the
+         *        reciprocal space forces.
+         *
+         * @pre all spans have the same size.
+         *
+         * @return the reciprocal space energy.
+         */
+        Rep compute(
+            std::span<const Rep> x,
+            std::span<const Rep> y,
+            std::span<const Rep> z,
+            std::span<const Rep> charges,
+            std::span<Rep>       fx,
+            std::span<Rep>       fy,
+            std::span<Rep>       fz
+        )
+        {
+            assert(x.size() == y.size() && x.size() == z.size());
+            assert(charges.size() == x.size() && fx.size() == x.size());
+            assert(fy.size() == x.size() && fz.size() == x.size());
+
+            const auto n = x.size();
+
+            _theta.resize(3 * _order * n);
+            _dtheta.resize(3 * _order * n);
+            _base.resize(3 * n);
+
+            parallelFor(
+                _nThreads,
+                n,
+                [&](const size_t begin, const size_t end, const size_t thread)
+                { _spread(x, y, z, charges, begin, end, _grids[thread]); }
+            );
+
+            _reduceGrids();
+
+            _fft.forward(_grids[0], _spectrum, _nThreads);
+
+            parallelFor(
+                _nThreads,
+                _spectrum.size(),
+                [&](const size_t begin, const size_t end, size_t)
+                {
+                    for (size_t k = begin; k < end; ++k)
+                        _spectrum[k] *= _influence[k];
+                }
+            );
+
+            _fft.backward(_spectrum, _potential, _nThreads);
+
+            parallelFor(
+                _nThreads,
+                n,
+                [&](const size_t begin, const size_t end, const size_t thread)
+                {
+                    _energies[thread] =
+                        _interpolate(charges, fx, fy, fz, begin, end);
+                }
+            );
+
+            Rep energy{};
+            for (const auto e : _energies)
+                energy += e;
+
+            return _coeff * energy / 2;
+        }
+
+       private:
+        /// @brief spline weights of particles [begin, end) spread into grid
+        void _spread(
+            std::span<const Rep> x,
+            std::span<const Rep> y,
+            std::span<const Rep> z,
+            std::span<const Rep> charges,
+            const size_t         begin,
+            const size_t         end,
+            AlignedVector<Rep>&  grid
+        )
+        {
+            const auto [nx, ny, nz] = _grid;
+            const auto order        = _order;
+
+            std::ranges::fill(grid, Rep{});
+
+            for (size_t i = begin; i < end; ++i)
+            {
+                const auto s = _box.fractional(x[i], y[i], z[i]);
+
+                for (size_t dim = 0; dim < 3; ++dim)
+                {
+                    const auto u    = s[dim] * static_cast<Rep>(_grid[dim]);
+                    const auto base = std::floor(u);
+
+                    // s may round to 1, wrap the grid index
+                    _base[3 * i + dim] =
+                        static_cast<size_t>(base) % _grid[dim];
+
+                    details::bsplineWeights(
+                        u - base,
+                        order,
+                        &_theta[(3 * i + dim) * order],
+                        &_dtheta[(3 * i + dim) * order]
+                    );
+                }
+
+                const auto* thetaX = &_theta[3 * i * order];
+                const auto* thetaY = thetaX + order;
+                const auto* thetaZ = thetaY + order;
+
+                for (size_t a = 0; a < order; ++a)
+                {
+                    const auto gx = _wrap(_base[3 * i] + a, nx);
+                    const auto qx = charges[i] * thetaX[a];
+
+                    for (size_t b = 0; b < order; ++b)
+                    {
+                        const auto gy  = _wrap(_base[3 * i + 1] + b, ny);
+                        const auto qxy = qx * thetaY[b];
+                        auto*      row = &grid[(gx * ny + gy) * nz];
+
+                        for (size_t c = 0; c < order; ++c)
+                            row[_wrap(_base[3 * i + 2] + c, nz)] +=
+                                qxy * thetaZ[c];
+                    }
+                }
+            }
+        }
+
+        /// @brief sums the per-thread grids into the first one
+        void _reduceGrids()
+        {
+            if (_nThreads == 1)
+                return;
+
+            parallelFor(
+                _nThreads,
+                _grids[0].size(),
+                [&](const size_t begin, const size_t end, size_t)
+                {
+                    for (size_t thread = 1; thread < _nThreads; ++thread)
+                    {
+                        const auto& other = _grids[thread];
+                        for (size_t k = begin; k < end; ++k)
+                            _grids[0][k] += other[k];
+                    }
+                }
+            );
+        }
+
+        /**
+         * @brief adds the forces of particles [begin, end) and returns
+         *        their \f$\sum_i q_i \phi(r_i)\f$
+         */
+        Rep _interpolate(
+            std::span<const Rep> charges,
+            std::span<Rep>       fx,
+            std::span<Rep>       fy,
+            std::span<Rep>       fz,
+            const size_t         begin,
+            const size_t         end
+        ) const
+        {
+            const auto [nx, ny, nz] = _grid;
+            const auto order        = _order;
+
+            const auto kx = static_cast<Rep>(nx);
+            const auto ky = static_cast<Rep>(ny);
+            const auto kz = static_cast<Rep>(nz);
+
+            Rep energy{};
+
+            for (size_t i = begin; i < end; ++i)
+            {
+                const auto* thetaX  = &_theta[3 * i * order];
+                const auto* thetaY  = thetaX + order;
+                const auto* thetaZ  = thetaY + order;
+                const auto* dthetaX = &_dtheta[3 * i * order];
+                const auto* dthetaY = dthetaX + order;
+                const auto* dthetaZ = dthetaY + order;
+
+                Rep phi{}, gx{}, gy{}, gz{};
+
+                for (size_t a = 0; a < order; ++a)
+                {
+                    const auto ix = _wrap(_base[3 * i] + a, nx);
+
+                    for (size_t b = 0; b < order; ++b)
+                    {
+                        const auto  iy  = _wrap(_base[3 * i + 1] + b, ny);
+                        const auto* row = &_potential[(ix * ny + iy) * nz];
+
+                        Rep sum{}, dsum{};
+                        for (size_t c = 0; c < order; ++c)
+                        {
+                            const auto value =
+                                row[_wrap(_base[3 * i + 2] + c, nz)];
+
+                            sum  += thetaZ[c] * value;
+                            dsum += dthetaZ[c] * value;
+                        }
+
+                        phi += thetaX[a] * thetaY[b] * sum;
+                        gx  += dthetaX[a] * thetaY[b] * sum;
+                        gy  += thetaX[a] * dthetaY[b] * sum;
+                        gz  += thetaX[a] * thetaY[b] * dsum;
+                    }
+                }
+
+                energy += charges[i] * phi;
+
+                // gradient in scaled coordinates u = K H^-1 r
+                const auto scale = -_coeff * charges[i];
+                const auto ux    = kx * gx;
+                const auto uy    = ky * gy;
+                const auto uz    = kz * gz;
+
+                fx[i] += scale * ux * _inverse[0][0];
+                fy[i] += scale * (ux * _inverse[0][1] + uy * _inverse[1][1]);
+                fz[i] += scale * (ux * _inverse[0][2] + uy * _inverse[1][2] +
+                                  uz * _inverse[2][2]);
+            }
+
+            return energy;
+        }
+
+        /// @brief wraps a grid index below 2 * n into [0, n)
+        static size_t _wrap(const size_t index, const size_t n)
+        {
+            return index < n ? index : index - n;
+        }
+    };
+
+}   // namespace mstd
+
+#endif   // __MSTD__PHYSICS__SPME_HPP__
@@ -0,0 +1,406 @@
+/*****************************************************************************
+<GPL_HEADER>
+
+    mstd library
+    Copyright (C) 2025-now  Jakob Gamper
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+<GPL_HEADER>
+******************************************************************************/
+
+#ifndef __MSTD__PHYSICS__THERMOSTAT_HPP__
+#define __MSTD__PHYSICS__THERMOSTAT_HPP__
+
+#include <cmath>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+#include "integrator.hpp"
+#include "mstd/parallel.hpp"
+#include "mstd/random/distributions.hpp"
+#include "mstd/random/philox.hpp"
+#include "mstd/type_traits/physics_traits.hpp"
+#include "particles.hpp"
+
+namespace mstd
+{
+    /**
+     * @brief Langevin dynamics with the BAOAB splitting of Leimkuhler and
+     *        Matthews.
+     *
+     * A step consists of a half kick (B), a half drift (A), the exact
+     * Ornstein-Uhlenbeck update of the velocities (O), a second half drift,
+     * the force evaluation and a second half kick. BAOAB samples
+     * configurations with an error of order dt² and is robust at large
+     * time steps.
+     *
+     * The noise of particle i at step s is drawn from a Philox4x32
+     * generator keyed by the seed with the counter (i, s). It needs no
+     * shared state, so the O step runs on @p nThreads threads and the
+     * trajectory is bitwise identical for every thread count.
+     *
+     * @tparam Rep floating point representation.
+     */
+    template <std::floating_point Rep = double>
+    class LangevinBAOAB
+    {
+       private:
+        Rep           _dt;
+        Rep           _temperature;
+        Rep           _friction;
+        Philox4x32<>  _generator;
+        size_t        _nThreads;
+        std::uint64_t _step = 0;
+
+        /// velocity decay and noise amplitude of the O step
+        Rep _decay;
+        Rep _noise;
+
+       public:
+        using rep = Rep;
+
+        /**
+         * @brief Creates a Langevin integrator.
+         *
+         * @param dt time step.
+         * @param temperature thermal energy \f$k_B T\f$.
+         * @param friction friction coefficient \f$\gamma\f$ in inverse
+         *        time units.
+         * @param seed key of the noise generator.
+         * @param nThreads number of threads of the O step.
+         *
+         * @throws std::invalid_argument unless dt > 0, temperature >= 0,
+         *         friction >= 0 and nThreads >= 1.
+         */
+        LangevinBAOAB(
+            const Rep           dt,
+            const Rep           temperature,
+            const Rep           friction,
+            const std::uint64_t seed,
+            const size_t        nThreads = 1
+        )
+            : _dt(details::checkedTimeStep(
+                  dt,
+                  "LangevinBAOAB requires dt > 0"
+              )),
+              _temperature(temperature),
+              _friction(friction),
+              _generator(seed),
+              _nThreads(nThreads),
+              _decay(std::exp(-friction * dt)),
+              _noise(std::sqrt(1 - _decay * _decay))
+        {
+            if (!(temperature >= 0))
+                throw std::invalid_argument(
+                    "LangevinBAOAB requires temperature >= 0"
+                );
+            if (!(friction >= 0))
+                throw std::invalid_argument(
+                    "LangevinBAOAB requires friction >= 0"
+                );
+            if (nThreads == 0)
+                throw std::invalid_argument(
+                    "LangevinBAOAB requires nThreads >= 1"
+                );
+        }
+
+        /// @brief Returns the time step.
+        Rep timeStep() const { return _dt; }
+
+        /// @brief Returns the thermal energy \f$k_B T\f$.
+        Rep temperature() const { return _temperature; }
+
+        /// @brief Returns the friction coefficient.
+        Rep friction() const { return _friction; }
+
+        /// @brief Returns the number of steps taken, the noise counter.
+        std::uint64_t stepCount() const { return _step; }
+
+        /// @brief Sets the noise counter, e.g. to continue a restart.
+        void setStepCount(const std::uint64_t step) { _step = step; }
+
+        /**
+         * @brief Computes the initial forces.
+         *
+         * @return the potential energy.
+         */
+        template <ForceProviderType<Rep> F>
+        Rep setup(ParticleArrays<Rep>& particles, F&& forces) const
+        {
+            return details::evaluateForces(particles, forces);
+        }
+
+        /**
+         * @brief Advances @p particles by one time step.
+         *
+         * @pre the forces belong to the current positions, see setup().
+         * @return the potential energy at the new positions.
+         */
+        template <ForceProviderType<Rep> F>
+        Rep step(ParticleArrays<Rep>& particles, F&& forces)
+        {
+            details::kickDrift<true>(particles, _dt / 2, _dt / 2);
+
+            parallelFor(
+                _nThreads,
+                particles.size(),
+                [&](const size_t begin, const size_t end, size_t)
+                { _thermalizeAndDrift(particles, begin, end); }
+            );
+
+            const Rep energy = details::evaluateForces(particles, forces);
+
+            details::kickDrift<false>(particles, _dt / 2, Rep{0});
+
+            ++_step;
+
+            return energy;
+        }
+
+       private:
+        /// O step followed by the second half drift for `[begin, end)`
+        void _thermalizeAndDrift(
+            ParticleArrays<Rep>& particles,
+            const size_t         begin,
+            const size_t         end
+        ) const
+        {
+            const auto invMass = particles.inverseMasses();
+            const Rep  drift   = _dt / 2;
+
+            for (size_t i = begin; i < end; ++i)
+            {
+                const auto bits = _generator(i, _step);
+
+                const auto [n0, n1] = boxMuller(
+                    uniformOpen<Rep>(bits[0]),
+                    uniformOpen<Rep>(bits[1])
+                );
+
+                // the second normal of this pair is dropped on purpose, so
+                // one counter (i, step) feeds exactly one particle
+                [[maybe_unused]] const auto [n2, dropped] = boxMuller(
+                    uniformOpen<Rep>(bits[2]),
+                    uniformOpen<Rep>(bits[3])
+                );
+
+                const Rep sigma =
+                    _noise * std::sqrt(_temperature * invMass[i]);
+
+                particles.vx[i] = _decay * particles.vx[i] + sigma * n0;
+                particles.vy[i] = _decay * particles.vy[i] + sigma * n1;
+                particles.vz[i] = _decay * particles.vz[i] + sigma * n2;
+
+                particles.x[i] += drift * particles.vx[i];
+                particles.y[i] += drift * particles.vy[i];
+                particles.z[i] += drift * particles.vz[i];
+            }
+        }
+    };
+
+    /**
+     * @brief Velocity Verlet coupled to a Nosé-Hoover chain thermostat.
+     *
+     * The chain of Martyna, Klein and Tuckerman is propagated for half a
+     * time step before and after every velocity Verlet step (Trotter
+     * splitting), scaling all velocities by a common factor. The thermostat
+     * masses follow from the relaxation time @p tau as
+     * \f$Q_1 = N_f k_B T \tau^2\f$ and \f$Q_j = k_B T \tau^2\f$.
+     *
+     * The dynamics is deterministic, so energyOfThermostat() plus the
+     * total energy of the particles is conserved and serves as a check of
+     * the time step.
+     *
+     * @tparam Rep floating point representation.
+     */
+    template <std::floating_point Rep = double>
+    class NoseHooverChain
+    {
+       private:
+        Rep _dt;
+        Rep _temperature;
+        Rep _degreesOfFreedom;
+
+        /// masses, positions and velocities of the chain variables
+        std::vector<Rep> _masses;
+        std::vector<Rep> _positions;
+        std::vector<Rep> _velocities;
+
+       public:
+        using rep = Rep;
+
+        /**
+         * @brief Creates a thermostatted integrator.
+         *
+         * @param dt time step.
+         * @param temperature thermal energy \f$k_B T\f$.
+         * @param tau relaxation time of the thermostat.
+         * @param degreesOfFreedom number of degrees of freedom \f$N_f\f$,
+         *        e.g. 3N - 3 with conserved momentum.
+         * @param chainLength number of chained thermostats.
+         *
+         * @throws std::invalid_argument unless dt, temperature, tau,
+         *         degreesOfFreedom and chainLength are positive.
+         */
+        NoseHooverChain(
+            const Rep    dt,
+            const Rep    temperature,
+            const Rep    tau,
+            const Rep    degreesOfFreedom,
+            const size_t chainLength = 3
+        )
+            : _dt(details::checkedTimeStep(
+                  dt,
+                  "NoseHooverChain requires dt > 0"
+              )),
+              _temperature(temperature),
+              _degreesOfFreedom(degreesOfFreedom),
+              _masses(chainLength, temperature * tau * tau),
+              _positions(chainLength),
+              _velocities(chainLength)
+        {
+            if (!(temperature > 0) || !(tau > 0) || !(degreesOfFreedom > 0))
+                throw std::invalid_argument(
+                    "NoseHooverChain requires temperature, tau and degrees "
+                    "of freedom > 0"
+                );
+            if (chainLength == 0)
+                throw std::invalid_argument(
+                    "NoseHooverChain requires chainLength >= 1"
+                );
+
+            _masses[0] *= degreesOfFreedom;
+        }
+
+        /// @brief Returns the time step.
+        Rep timeStep() const { return _dt; }
+
+        /// @brief Returns the thermal energy \f$k_B T\f$.
+        Rep temperature() const { return _temperature; }
+
+        /// @brief Returns the number of chained thermostats.
+        size_t chainLength() const { return _masses.size(); }
+
+        /**
+         * @brief Returns the energy stored in the chain,
+         *        \f$\sum_j Q_j v_j^2 / 2 + N_f k_B T \xi_1 +
+         *        k_B T \sum_{j > 1} \xi_j\f$.
+         */
+        Rep energyOfThermostat() const
+        {
+            Rep energy = _degreesOfFreedom * _temperature * _positions[0];
+
+            for (size_t j = 0; j < chainLength(); ++j)
+            {
+                energy += _masses[j] * _velocities[j] * _velocities[j] / 2;
+
+                if (j > 0)
+                    energy += _temperature * _positions[j];
+            }
+
+            return energy;
+        }
+
+        /**
+         * @brief Computes the initial forces.
+         *
+         * @return the potential energy.
+         */
+        template <ForceProviderType<Rep> F>
+        Rep setup(ParticleArrays<Rep>& particles, F&& forces) const
+        {
+            return details::evaluateForces(particles, forces);
+        }
+
+        /**
+         * @brief Advances @p particles and the chain by one time step.
+         *
+         * @pre the forces belong to the current positions, see setup().
+         * @return the potential energy at the new positions.
+         */
+        template <ForceProviderType<Rep> F>
+        Rep step(ParticleArrays<Rep>& particles, F&& forces)
+        {
+            _propagateChain(particles);
+
+            details::kickDrift<true>(particles, _dt / 2, _dt);
+
+            const Rep energy = details::evaluateForces(particles, forces);
+
+            details::kickDrift<false>(particles, _dt / 2, Rep{0});
+
+            _propagateChain(particles);
+
+            return energy;
+        }
+
+       private:
+        /// force on chain variable j given twice the kinetic energy
+        Rep _chainForce(const size_t j, const Rep twiceKinetic) const
+        {
+            const Rep driving =
+                j == 0 ? twiceKinetic - _degreesOfFreedom * _temperature
+                       : _masses[j - 1] * _velocities[j - 1] *
+                                 _velocities[j - 1] -
+                             _temperature;
+
+            return driving / _masses[j];
+        }
+
+        /// updates chain velocity j by a quarter step, scaled by its
+        /// successor on both sides
+        void _updateChainVelocity(const size_t j, const Rep twiceKinetic)
+        {
+            const Rep quarter = _dt / 4;
+            const Rep scale   = j + 1 < chainLength()
+                                    ? std::exp(-_dt / 8 * _velocities[j + 1])
+                                    : Rep{1};
+
+            _velocities[j] *= scale;
+            _velocities[j] += quarter * _chainForce(j, twiceKinetic);
+            _velocities[j] *= scale;
+        }
+
+        /// propagates the chain and scales the velocities by half a step
+        void _propagateChain(ParticleArrays<Rep>& particles)
+        {
+            const size_t length = chainLength();
+
+            Rep twiceKinetic = 2 * particles.kineticEnergy();
+
+            for (size_t j = length; j-- > 0;)
+                _updateChainVelocity(j, twiceKinetic);
+
+            const Rep scale  = std::exp(-_dt / 2 * _velocities[0]);
+            twiceKinetic    *= scale * scale;
+
+            for (auto* v : {&particles.vx, &particles.vy, &particles.vz})
+                for (auto& value : *v)
+                    value *= scale;
+
+            for (size_t j = 0; j < length; ++j)
+                _positions[j] += _dt / 2 * _velocities[j];
+
+            for (size_t j = 0; j < length; ++j)
+                _updateChainVelocity(j, twiceKinetic);
+        }
+    };
+
+}   // namespace mstd
+
+#endif   // __MSTD__PHYSICS__THERMOSTAT_HPP__
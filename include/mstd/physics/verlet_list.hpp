@@ -0,0 +1,477 @@
+/*****************************************************************************
+<GPL_HEADER>
+
+    mstd library
+    Copyright (C) 2025-now  Jakob Gamper
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+<GPL_HEADER>
+******************************************************************************/
+
+#ifndef __MSTD__PHYSICS__VERLET_LIST_HPP__
+#define __MSTD__PHYSICS__VERLET_LIST_HPP__
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <span>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "cell_list.hpp"
+
+namespace mstd
+{
+    /**
+     * @brief Verlet neighbour list with a skin on top of the cutoff.
+     *
+     * The list stores, for every particle i, the partners j > i within
+     * cutoff + skin in a CSR layout (row offsets plus neighbour indices). It
+     * is built from a CellList and stays valid until some particle has moved
+     * more than skin / 2 since the last build, so update() only rebuilds
+     * every few steps. Pair enumeration re-checks the true cutoff with the
+     * current coordinates.
+     *
+     * @tparam Rep numeric representation.
+     * @tparam Box periodic box type, see BoxType.
+     */
+    template <typename Rep = double, typename Box = OrthorhombicBox<Rep>>
+    class VerletList
+    {
+       private:
+        CellList<Rep, Box> _cellList;
+        Rep                _cutoff{};
+        Rep                _skin{};
+
+        /// CSR offsets and neighbour indices of the half list
+        std::vector<size_t> _offsets{0};
+        std::vector<size_t> _neighbours;
+
+        /// coordinates at the last rebuild
+        std::vector<Rep> _refX;
+        std::vector<Rep> _refY;
+        std::vector<Rep> _refZ;
+
+        size_t _nUpdates  = 0;
+        size_t _nRebuilds = 0;
+
+       public:
+        using rep      = Rep;
+        using box_type = Box;
+
+        /**
+         * @brief Sets up the list for a box, cutoff and skin.
+         *
+         * @param box periodic box, e.g. the edge lengths of an orthorhombic
+         *        box.
+         * @param cutoff interaction cutoff.
+         * @param skin extra distance buffered in the list.
+         *
+         * @throws std::invalid_argument if the cutoff is not positive, the
+         *         skin is negative or the box is thinner than twice
+         *         cutoff + skin in any direction.
+         */
+        VerletList(const Box& box, const Rep cutoff, const Rep skin)
+            : _cellList(box, _checkedListCutoff(cutoff, skin)),
+              _cutoff(cutoff),
+              _skin(skin)
+        {
+        }
+
+        /**
+         * @brief Rebuilds the list if it is no longer valid for the given
+         *        coordinates.
+         *
+         * The list is rebuilt on the first call, when the number of
+         * particles changed or when the largest displacement since the last
+         * build exceeds skin / 2.
+         *
+         * @return true if the list was rebuilt.
+         */
+        bool update(
+            std::span<const Rep> x,
+            std::span<const Rep> y,
+            std::span<const Rep> z
+        )
+        {
+            ++_nUpdates;
+
+            if (x.size() == _refX.size() &&
+                maxDisplacement(x, y, z) <= _skin / 2)
+                return false;
+
+            rebuild(x, y, z);
+            return true;
+        }
+
+        /**
+         * @brief Unconditionally rebuilds the list.
+         *
+         * @pre `x`, `y` and `z` have the same size.
+         */
+        void rebuild(
+            std::span<const Rep> x,
+            std::span<const Rep> y,
+            std::span<const Rep> z
+        )
+        {
+            assert(x.size() == y.size() && x.size() == z.size());
+
+            const size_t nParticles = x.size();
+
+            _cellList.build(x, y, z);
+
+            // first pass counts the partners of every particle
+            _offsets.assign(nParticles + 1, 0);
+            _cellList.forEachPair(
+                x,
+                y,
+                z,
+                [this](size_t i, size_t j, Rep, Rep, Rep, Rep)
+                { ++_offsets[std::min(i, j) + 1]; }
+            );
+
+            for (size_t i = 0; i < nParticles; ++i)
+                _offsets[i + 1] += _offsets[i];
+
+            // second pass scatters them into their rows
+            std::vector<size_t> fill(_offsets.begin(), _offsets.end() - 1);
+            _neighbours.resize(_offsets.back());
+            _cellList.forEachPair(
+                x,
+                y,
+                z,
+                [this, &fill](size_t i, size_t j, Rep, Rep, Rep, Rep)
+                { _neighbours[fill[std::min(i, j)]++] = std::max(i, j); }
+            );
+
+            // ascending rows keep the partner loads close together
+            for (size_t i = 0; i < nParticles; ++i)
+                std::sort(
+                    _neighbours.begin() + _diff(_offsets[i]),
+                    _neighbours.begin() + _diff(_offsets[i + 1])
+                );
+
+            _refX.assign(x.begin(), x.end());
+            _refY.assign(y.begin(), y.end());
+            _refZ.assign(z.begin(), z.end());
+
+            ++_nRebuilds;
+        }
+
+        /**
+         * @brief Returns the largest minimum image displacement of any
+         *        particle since the last rebuild.
+         *
+         * @pre the coordinates have the size of the last rebuild.
+         */
+        Rep maxDisplacement(
+            std::span<const Rep> x,
+            std::span<const Rep> y,
+            std::span<const Rep> z
+        ) const
+        {
+            assert(x.size() == _refX.size());
+            assert(y.size() == _refY.size() && z.size() == _refZ.size());
+
+            Rep maxR2{};
+
+            for (size_t i = 0; i < x.size(); ++i)
+            {
+                const auto r2 = _minimumImageR2(
+                    x[i] - _refX[i],
+                    y[i] - _refY[i],
+                    z[i] - _refZ[i]
+                );
+                maxR2 = std::max(maxR2, r2);
+            }
+
+            return std::sqrt(maxR2);
+        }
+
+        /**
+         * @brief Calls @p callback once for every pair within the cutoff.
+         *
+         * The callback receives `(i, j, dx, dy, dz, r2)` with `i < j`,
+         * `(dx, dy, dz)` the minimum image of \f$\vec{r}_i - \vec{r}_j\f$
+         * and `r2` its squared length, evaluated at the given coordinates.
+         *
+         * @pre update() or rebuild() has been called with these coordinates.
+         */
+        template <typename Callback>
+        void forEachPair(
+            std::span<const Rep> x,
+            std::span<const Rep> y,
+            std::span<const Rep> z,
+            Callback&&           callback
+        ) const
+        {
+            forEachPairInRange(0, nParticles(), x, y, z, callback);
+        }
+
+        /**
+         * @brief Like forEachPair, restricted to pairs whose first particle
+         *        lies in [@p iBegin, @p iEnd).
+         *
+         * Splitting the particle range yields disjoint pair sets.
+         */
+        template <typename Callback>
+        void forEachPairInRange(
+            const size_t         iBegin,
+            const size_t         iEnd,
+            std::span<const Rep> x,
+            std::span<const Rep> y,
+            std::span<const Rep> z,
+            Callback&&           callback
+        ) const
+        {
+            const auto& box     = _cellList.box();
+            const auto  cutoff2 = _cutoff * _cutoff;
+
+            for (size_t i = iBegin; i < iEnd; ++i)
+            {
+                const auto xi = x[i];
+                const auto yi = y[i];
+                const auto zi = z[i];
+
+                for (auto n = _offsets[i]; n < _offsets[i + 1]; ++n)
+                {
+                    const auto j = _neighbours[n];
+
+                    const auto [dx, dy, dz] =
+                        box.minimumImage(xi - x[j], yi - y[j], zi - z[j]);
+
+                    const auto r2 = dx * dx + dy * dy + dz * dz;
+
+                    if (r2 < cutoff2)
+                        callback(i, j, dx, dy, dz, r2);
+                }
+            }
+        }
+
+        /**
+         * @brief Like forEachPair, restricted to chunk @p chunk of
+         *        @p nChunks.
+         *
+         * The rows are split so that every chunk holds about the same
+         * number of listed pairs.
+         */
+        template <typename Callback>
+        void forEachPairInChunk(
+            const size_t         chunk,
+            const size_t         nChunks,
+            std::span<const Rep> x,
+            std::span<const Rep> y,
+            std::span<const Rep> z,
+            Callback&&           callback
+        ) const
+        {
+            assert(chunk < nChunks);
+
+            forEachPairInRange(
+                _chunkBegin(chunk, nChunks),
+                _chunkBegin(chunk + 1, nChunks),
+                x,
+                y,
+                z,
+                callback
+            );
+        }
+
+        /**
+         * @brief Calls @p callback with `(i, neighbours(i))` for every
+         *        particle.
+         *
+         * The rows hold all partners within cutoff + skin at the last
+         * rebuild, so the caller has to apply the cutoff itself. Used by
+         * the SIMD pair kernel.
+         */
+        template <typename Callback>
+        void forEachCandidateRow(Callback&& callback) const
+        {
+            forEachCandidateRowInRange(0, nParticles(), callback);
+        }
+
+        /**
+         * @brief Like forEachCandidateRow, restricted to the particles
+         *        [@p iBegin, @p iEnd).
+         */
+        template <typename Callback>
+        void forEachCandidateRowInRange(
+            const size_t iBegin,
+            const size_t iEnd,
+            Callback&&   callback
+        ) const
+        {
+            for (size_t i = iBegin; i < iEnd; ++i)
+                callback(i, neighbours(i));
+        }
+
+        /**
+         * @brief Like forEachCandidateRow, restricted to chunk @p chunk of
+         *        @p nChunks (same split as forEachPairInChunk).
+         */
+        template <typename Callback>
+        void forEachCandidateRowInChunk(
+            const size_t chunk,
+            const size_t nChunks,
+            Callback&&   callback
+        ) const
+        {
+            assert(chunk < nChunks);
+
+            forEachCandidateRowInRange(
+                _chunkBegin(chunk, nChunks),
+                _chunkBegin(chunk + 1, nChunks),
+                callback
+            );
+        }
+
+        /**
+         * @brief Returns the particles `[first, last)` that the pairs of
+         *        chunk @p chunk of @p nChunks can touch.
+         */
+        std::pair<size_t, size_t> chunkParticleRange(
+            const size_t chunk,
+            const size_t nChunks,
+            [[maybe_unused]] const size_t nParticles
+        ) const
+        {
+            assert(nParticles == this->nParticles());
+
+            const auto begin = _chunkBegin(chunk, nChunks);
+            const auto end   = _chunkBegin(chunk + 1, nChunks);
+
+            // rows are sorted, so the last partner is the largest
+            auto last = end;
+            for (size_t i = begin; i < end; ++i)
+                if (_offsets[i + 1] > _offsets[i])
+                    last = std::max(last, _neighbours[_offsets[i + 1] - 1] + 1);
+
+            return {begin, last};
+        }
+
+        /// @brief Returns the partners j > i of particle @p i.
+        std::span<const size_t> neighbours(const size_t i) const
+        {
+            return std::span<const size_t>(_neighbours)
+                .subspan(_offsets[i], _offsets[i + 1] - _offsets[i]);
+        }
+
+        /// @brief Returns the CSR row offsets, one more than particles.
+        std::span<const size_t> offsets() const { return _offsets; }
+
+        /// @brief Returns the CSR neighbour indices.
+        std::span<const size_t> neighbourIndices() const
+        {
+            return _neighbours;
+        }
+
+        /// @brief Returns the number of particles of the last rebuild.
+        size_t nParticles() const { return _offsets.size() - 1; }
+
+        /// @brief Returns the number of stored pairs (within cutoff + skin).
+        size_t nPairs() const { return _neighbours.size(); }
+
+        /// @brief Returns the interaction cutoff.
+        Rep cutoff() const { return _cutoff; }
+
+        /// @brief Returns the skin.
+        Rep skin() const { return _skin; }
+
+        /// @brief Returns the list cutoff, i.e. cutoff + skin.
+        Rep listCutoff() const { return _cellList.cutoff(); }
+
+        /// @brief Returns the periodic box.
+        const Box& box() const { return _cellList.box(); }
+
+        /// @brief Returns how often update() was called.
+        size_t updateCount() const { return _nUpdates; }
+
+        /// @brief Returns how often the list was rebuilt.
+        size_t rebuildCount() const { return _nRebuilds; }
+
+        /**
+         * @brief Returns the fraction of update() calls that rebuilt the
+         *        list, or zero before the first update.
+         */
+        double rebuildFrequency() const
+        {
+            if (_nUpdates == 0)
+                return 0.0;
+
+            return static_cast<double>(_nRebuilds) /
+                   static_cast<double>(_nUpdates);
+        }
+
+        /**
+         * @brief Returns the average number of list neighbours per particle,
+         *        counting every stored pair for both partners.
+         */
+        double averageNeighbours() const
+        {
+            if (nParticles() == 0)
+                return 0.0;
+
+            return 2.0 * static_cast<double>(nPairs()) /
+                   static_cast<double>(nParticles());
+        }
+
+       private:
+        /// first row of a chunk, balanced by the number of listed pairs
+        size_t _chunkBegin(const size_t chunk, const size_t nChunks) const
+        {
+            if (chunk >= nChunks)
+                return nParticles();
+
+            const auto target = nPairs() * chunk / nChunks;
+            const auto it     = std::ranges::lower_bound(_offsets, target);
+
+            return std::min(
+                static_cast<size_t>(it - _offsets.begin()),
+                nParticles()
+            );
+        }
+
+        static Rep _checkedListCutoff(const Rep cutoff, const Rep skin)
+        {
+            if (!(cutoff > 0))
+                throw std::invalid_argument("VerletList requires cutoff > 0");
+
+            if (!(skin >= 0))
+                throw std::invalid_argument("VerletList requires skin >= 0");
+
+            return cutoff + skin;
+        }
+
+        static std::ptrdiff_t _diff(const size_t index)
+        {
+            return static_cast<std::ptrdiff_t>(index);
+        }
+
+        Rep _minimumImageR2(const Rep dx, const Rep dy, const Rep dz) const
+        {
+            const auto [mx, my, mz] = _cellList.box().minimumImage(dx, dy, dz);
+
+            return mx * mx + my * my + mz * mz;
+        }
+    };
+
+}   // namespace mstd
+
+#endif   // __MSTD__PHYSICS__VERLET_LIST_HPP__
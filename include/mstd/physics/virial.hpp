@@ -0,0 +1,194 @@
+/*****************************************************************************
+<GPL_HEADER>
+
+    mstd library
+    Copyright (C) 2025-now  Jakob Gamper
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+<GPL_HEADER>
+******************************************************************************/
+
+#ifndef __MSTD__PHYSICS__VIRIAL_HPP__
+#define __MSTD__PHYSICS__VIRIAL_HPP__
+
+#include <array>
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+
+#include "particles.hpp"
+
+namespace mstd
+{
+    /**
+     * @brief Pair virial tensor
+     *        \f$W = \sum_{i<j} \vec{r}_{ij} \otimes \vec{f}_{ij}\f$.
+     *
+     * Pair forces are central, so the tensor is symmetric and only its six
+     * independent components are stored. Pass it to computePairForces or
+     * ParallelPairForces::compute to accumulate it in the same pass as the
+     * forces; the overloads without a tensor do not compute it at all.
+     *
+     * @tparam Rep floating point representation.
+     */
+    template <std::floating_point Rep = double>
+    class VirialTensor
+    {
+       private:
+        // xx, yy, zz, xy, xz, yz
+        std::array<Rep, 6> _w{};
+
+       public:
+        using rep = Rep;
+
+        /**
+         * @brief Adds a pair with displacement @p dx, @p dy, @p dz and
+         *        force over distance @p forceOverR.
+         *
+         * Follows the sign convention of the pair kernels: the force on
+         * the first particle is `-forceOverR * d`.
+         */
+        void addPair(
+            const Rep forceOverR,
+            const Rep dx,
+            const Rep dy,
+            const Rep dz
+        )
+        {
+            const auto sx = forceOverR * dx;
+            const auto sy = forceOverR * dy;
+            const auto sz = forceOverR * dz;
+
+            _w[0] -= sx * dx;
+            _w[1] -= sy * dy;
+            _w[2] -= sz * dz;
+            _w[3] -= sx * dy;
+            _w[4] -= sx * dz;
+            _w[5] -= sy * dz;
+        }
+
+        /// @brief Adds the sums of @p other, e.g. of another thread.
+        VirialTensor& operator+=(const VirialTensor& other)
+        {
+            for (size_t k = 0; k < _w.size(); ++k)
+                _w[k] += other._w[k];
+
+            return *this;
+        }
+
+        /**
+         * @brief Returns the component @p a, @p b.
+         *
+         * @pre a < 3 and b < 3
+         */
+        Rep operator()(const size_t a, const size_t b) const
+        {
+            assert(a < 3 && b < 3);
+
+            if (a == b)
+                return _w[a];
+
+            return _w[a + b + 2];
+        }
+
+        /**
+         * @brief Returns the trace
+         *        \f$\sum_{i<j} \vec{r}_{ij} \cdot \vec{f}_{ij}\f$.
+         */
+        Rep trace() const { return _w[0] + _w[1] + _w[2]; }
+    };
+
+    namespace details
+    {
+        /**
+         * @brief Stand-in for VirialTensor in the pair kernels when the
+         *        virial is not requested.
+         *
+         * Its members do nothing, so the compiler removes the virial
+         * arithmetic from the kernels entirely.
+         */
+        template <typename Rep>
+        struct NoVirial
+        {
+            void addPair(Rep, Rep, Rep, Rep) {}
+
+            NoVirial& operator+=(const NoVirial&) { return *this; }
+        };
+
+    }   // namespace details
+
+    /**
+     * @brief Returns the pressure tensor
+     *        \f$P = (\sum_i m_i \vec{v}_i \otimes \vec{v}_i + W) / V\f$.
+     *
+     * @param particles masses and velocities.
+     * @param virial pair virial of the current positions.
+     * @param volume box volume.
+     * @return the tensor, row by row.
+     */
+    template <std::floating_point Rep>
+    std::array<std::array<Rep, 3>, 3> pressureTensor(
+        const ParticleArrays<Rep>& particles,
+        const VirialTensor<Rep>&   virial,
+        const Rep                  volume
+    )
+    {
+        const auto masses = particles.masses();
+
+        const std::array<const AlignedVector<Rep>*, 3> v{
+            &particles.vx,
+            &particles.vy,
+            &particles.vz
+        };
+
+        std::array<std::array<Rep, 3>, 3> tensor{};
+
+        for (size_t a = 0; a < 3; ++a)
+            for (size_t b = a; b < 3; ++b)
+            {
+                Rep kinetic{};
+
+                for (size_t i = 0; i < particles.size(); ++i)
+                    kinetic += masses[i] * (*v[a])[i] * (*v[b])[i];
+
+                tensor[a][b] = (kinetic + virial(a, b)) / volume;
+                tensor[b][a] = tensor[a][b];
+            }
+
+        return tensor;
+    }
+
+    /**
+     * @brief Returns the scalar pressure
+     *        \f$p = (2 E_\mathrm{kin} + \mathrm{tr}\,W) / (3V)\f$.
+     *
+     * @param particles masses and velocities.
+     * @param virial pair virial of the current positions.
+     * @param volume box volume.
+     */
+    template <std::floating_point Rep>
+    Rep pressure(
+        const ParticleArrays<Rep>& particles,
+        const VirialTensor<Rep>&   virial,
+        const Rep                  volume
+    )
+    {
+        return (2 * particles.kineticEnergy() + virial.trace()) /
+               (3 * volume);
+    }
+
+}   // namespace mstd
+
+#endif   // __MSTD__PHYSICS__VIRIAL_HPP__
@@ -0,0 +1,31 @@
+/*****************************************************************************
+<GPL_HEADER>
+
+    mstd library
+    Copyright (C) 2025-now  Jakob Gamper
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+<GPL_HEADER>
+******************************************************************************/
+
+#ifndef __MSTD__RANDOM_HPP__
+#define __MSTD__RANDOM_HPP__
+
+#include "random/distributions.hpp"   // IWYU pragma: export
+#include "random/philox.hpp"          // IWYU pragma: export
+#include "random/stream.hpp"          // IWYU pragma: export
+#include "random/threefry.hpp"        // IWYU pragma: export
+
+#endif   // __MSTD__RANDOM_HPP__
@@ -0,0 +1,206 @@
+/*****************************************************************************
+<GPL_HEADER>
+
+    mstd library
+    Copyright (C) 2025-now  Jakob Gamper
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+<GPL_HEADER>
+******************************************************************************/
+
+#ifndef __MSTD__RANDOM__DISTRIBUTIONS_HPP__
+#define __MSTD__RANDOM__DISTRIBUTIONS_HPP__
+
+#include <array>
+#include <bit>
+#include <cmath>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <numbers>
+#include <type_traits>
+#include <utility>
+
+#include "mstd/simd/vec.hpp"
+#include "mstd/type_traits/simd_traits.hpp"
+
+namespace mstd
+{
+    /**
+     * @brief Maps 32 random bits to a uniform value in the open interval
+     *        (0, 1).
+     *
+     * The result is never 0 or 1, so it can be passed to `log` directly.
+     */
+    template <std::floating_point Rep = double>
+    constexpr Rep uniformOpen(const std::uint32_t bits)
+    {
+        constexpr Rep scale = Rep{1} / Rep{4294967296.0};
+
+        return (static_cast<Rep>(bits) + Rep{0.5}) * scale;
+    }
+
+    /**
+     * @brief Maps 64 random bits to a uniform double in [0, 1).
+     *
+     * The upper 52 bits become the mantissa of a double in [1, 2), which
+     * is shifted down by one. This needs no integer to floating point
+     * conversion, which 64 bit vector lanes lack before AVX-512, and gives
+     * identical results for scalars and vectors.
+     *
+     * @tparam T `std::uint64_t` or a vector of it.
+     * @return `double` or a vector of doubles with the same lane count.
+     */
+    template <typename T>
+    inline auto uniformFromBits(const T bits)
+    {
+        using Result = std::conditional_t<
+            is_simd_vec_v<T>,
+            SimdVec<double, simd_size_v<T>>,
+            double>;
+
+        constexpr std::uint64_t one = 0x3FF0000000000000;
+
+        return std::bit_cast<Result>((bits >> 12) | one) - 1.0;
+    }
+
+    /**
+     * @brief Box–Muller transform of two uniform values in (0, 1) into two
+     *        independent standard normal values.
+     */
+    template <std::floating_point Rep>
+    std::pair<Rep, Rep> boxMuller(const Rep u1, const Rep u2)
+    {
+        const Rep radius = std::sqrt(-2 * std::log(u1));
+        const Rep angle  = 2 * std::numbers::pi_v<Rep> * u2;
+
+        return {radius * std::cos(angle), radius * std::sin(angle)};
+    }
+
+    namespace details
+    {
+        /// number of layers of the normal Ziggurat
+        static constexpr size_t ziggurat_layers = 128;
+
+        /**
+         * @brief layer boundaries of the 128 layer normal Ziggurat
+         *        (Doornik's ZIGNOR)
+         *
+         * `x[i]` is the right edge of layer i with `x[0]` the width of the
+         * base layer including the tail and `x[128] = 0`; `ratio[i]` is
+         * `x[i + 1] / x[i]`, below which a sample is accepted at once.
+         */
+        struct ZigguratTables
+        {
+            /// start of the tail and area of every layer
+            static constexpr double tail_start = 3.442619855899;
+            static constexpr double layer_area = 9.91256303526217e-3;
+
+            std::array<double, ziggurat_layers + 1> x{};
+            std::array<double, ziggurat_layers>     ratio{};
+
+            ZigguratTables()
+            {
+                double density = std::exp(-0.5 * tail_start * tail_start);
+
+                x[0] = layer_area / density;
+                x[1] = tail_start;
+
+                for (size_t i = 2; i < ziggurat_layers; ++i)
+                {
+                    x[i] = std::sqrt(
+                        -2 * std::log(layer_area / x[i - 1] + density)
+                    );
+                    density = std::exp(-0.5 * x[i] * x[i]);
+                }
+
+                for (size_t i = 0; i < ziggurat_layers; ++i)
+                    ratio[i] = x[i + 1] / x[i];
+            }
+        };
+
+        /// @brief returns the shared Ziggurat tables
+        inline const ZigguratTables& zigguratTables()
+        {
+            static const ZigguratTables tables;
+            return tables;
+        }
+
+        /// @brief uniform value in (0, 1] from 64 random bits
+        inline double uniformOpenFromBits(const std::uint64_t bits)
+        {
+            return 1.0 - uniformFromBits(bits);
+        }
+
+    }   // namespace details
+
+    /**
+     * @brief Standard normal value by the Ziggurat method.
+     *
+     * The low 7 bits of @p bits select the layer and the upper 52 bits a
+     * signed position in it. About 98.8% of all samples are accepted
+     * right away at the cost of a multiplication and a comparison; the
+     * rest calls @p next for more random bits to sample the wedges or the
+     * tail.
+     *
+     * @param bits 64 random bits.
+     * @param next callable returning further 64 bit random words.
+     */
+    template <typename Next>
+    double zigguratNormal(std::uint64_t bits, Next&& next)
+    {
+        const auto& tables = details::zigguratTables();
+
+        for (;;)
+        {
+            const double u = 2 * uniformFromBits(bits) - 1;
+            const size_t i = bits & (details::ziggurat_layers - 1);
+
+            if (std::abs(u) < tables.ratio[i])
+                return u * tables.x[i];
+
+            if (i == 0)
+            {
+                // Marsaglia's tail algorithm beyond the base layer
+                constexpr double start = details::ZigguratTables::tail_start;
+
+                double x, y;
+                do
+                {
+                    x = std::log(details::uniformOpenFromBits(next())) / start;
+                    y = std::log(details::uniformOpenFromBits(next()));
+                } while (-2 * y < x * x);
+
+                return u < 0 ? x - start : start - x;
+            }
+
+            const double x  = u * tables.x[i];
+            const double f0 = std::exp(
+                -0.5 * (tables.x[i] * tables.x[i] - x * x)
+            );
+            const double f1 = std::exp(
+                -0.5 * (tables.x[i + 1] * tables.x[i + 1] - x * x)
+            );
+
+            if (f1 + uniformFromBits(next()) * (f0 - f1) < 1.0)
+                return x;
+
+            bits = next();
+        }
+    }
+
+}   // namespace mstd
+
+#endif   // __MSTD__RANDOM__DISTRIBUTIONS_HPP__
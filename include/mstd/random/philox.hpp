@@ -0,0 +1,320 @@
+/*****************************************************************************
+<GPL_HEADER>
+
+    mstd library
+    Copyright (C) 2025-now  Jakob Gamper
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+<GPL_HEADER>
+******************************************************************************/
+
+#ifndef __MSTD__RANDOM__PHILOX_HPP__
+#define __MSTD__RANDOM__PHILOX_HPP__
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "mstd/simd/math.hpp"
+#include "mstd/simd/vec.hpp"
+
+namespace mstd
+{
+    namespace details
+    {
+        static constexpr std::uint64_t low_word_mask = 0xFFFFFFFF;
+
+        /**
+         * @brief high and low 64 bits of the 128 bit product `a * b`
+         *
+         * Built from four 32 x 32 bit products, so that the same code
+         * runs on scalars and on vectors of 64 bit lanes, which have no
+         * wide multiply.
+         *
+         * @tparam T `std::uint64_t` or a vector of it.
+         */
+        template <typename T>
+        constexpr std::array<T, 2> mulHiLo64(const T a, const std::uint64_t b)
+        {
+            const T aHigh = a >> 32;
+            const T bLow  = simdBroadcast<T>(b);
+            const T bHigh = simdBroadcast<T>(b >> 32);
+
+            const T lowLow   = simdMulLow32(a, bLow);
+            const T lowHigh  = simdMulLow32(a, bHigh);
+            const T highLow  = simdMulLow32(aHigh, bLow);
+            const T highHigh = simdMulLow32(aHigh, bHigh);
+
+            const T middle = (lowLow >> 32) + (lowHigh & low_word_mask) +
+                             (highLow & low_word_mask);
+
+            return {
+                highHigh + (lowHigh >> 32) + (highLow >> 32) + (middle >> 32),
+                (middle << 32) | (lowLow & low_word_mask)
+            };
+        }
+
+    }   // namespace details
+
+    /**
+     * @brief Counter-based Philox4x32 generator (Salmon et al., SC'11).
+     *
+     * The generator is a keyed bijection: it maps a 128 bit counter to 128
+     * random bits without any internal state. Random numbers for a
+     * particle at a given step are drawn by encoding both in the counter,
+     * so they do not depend on the order in which particles are visited or
+     * on how the work is split between threads.
+     *
+     * `bits()` evaluates the rounds lane-generically on `std::uint64_t` or
+     * on vectors of it, each lane holding one 32 bit word, and is used by
+     * RandomStream for SIMD bulk generation.
+     *
+     * @tparam Rounds number of rounds, 10 passes BigCrush.
+     */
+    template <size_t Rounds = 10>
+    class Philox4x32
+    {
+       public:
+        using word_type    = std::uint32_t;
+        using counter_type = std::array<std::uint32_t, 4>;
+        using key_type     = std::array<std::uint32_t, 2>;
+
+        /// number of 64 bit words returned by bits()
+        static constexpr size_t words_per_call = 2;
+
+       private:
+        static constexpr std::uint32_t _multiplier0 = 0xD2511F53;
+        static constexpr std::uint32_t _multiplier1 = 0xCD9E8D57;
+        static constexpr std::uint32_t _weyl0       = 0x9E3779B9;
+        static constexpr std::uint32_t _weyl1       = 0xBB67AE85;
+
+        key_type _key;
+
+       public:
+        constexpr explicit Philox4x32(const key_type key) : _key(key) {}
+
+        /// @brief Creates a generator keyed by a 64 bit seed.
+        constexpr explicit Philox4x32(const std::uint64_t seed)
+            : _key{
+                  static_cast<std::uint32_t>(seed),
+                  static_cast<std::uint32_t>(seed >> 32)
+              }
+        {
+        }
+
+        /// @brief Returns the key.
+        constexpr key_type key() const { return _key; }
+
+        /**
+         * @brief Applies the rounds to a counter held in 64 bit lanes.
+         *
+         * @tparam T `std::uint64_t` or a vector of it; every lane holds a
+         *         32 bit word.
+         */
+        template <typename T>
+        constexpr std::array<T, 4> generate(std::array<T, 4> counter) const
+        {
+            const T multiplier0 = simdBroadcast<T>(_multiplier0);
+            const T multiplier1 = simdBroadcast<T>(_multiplier1);
+
+            std::uint64_t key0 = _key[0];
+            std::uint64_t key1 = _key[1];
+
+            for (size_t round = 0; round < Rounds; ++round)
+            {
+                const T product0 = simdMulLow32(counter[0], multiplier0);
+                const T product1 = simdMulLow32(counter[2], multiplier1);
+
+                counter = {
+                    (product1 >> 32) ^ counter[1] ^ key0,
+                    product1 & details::low_word_mask,
+                    (product0 >> 32) ^ counter[3] ^ key1,
+                    product0 & details::low_word_mask
+                };
+
+                key0 = (key0 + _weyl0) & details::low_word_mask;
+                key1 = (key1 + _weyl1) & details::low_word_mask;
+            }
+
+            return counter;
+        }
+
+        /// @brief Returns the random bits belonging to @p counter.
+        constexpr counter_type operator()(const counter_type counter) const
+        {
+            const auto result = generate(std::array<std::uint64_t, 4>{
+                counter[0],
+                counter[1],
+                counter[2],
+                counter[3]
+            });
+
+            return {
+                static_cast<std::uint32_t>(result[0]),
+                static_cast<std::uint32_t>(result[1]),
+                static_cast<std::uint32_t>(result[2]),
+                static_cast<std::uint32_t>(result[3])
+            };
+        }
+
+        /**
+         * @brief Returns the random bits of item @p index at @p step.
+         *
+         * Both 64 bit values are split into the four counter words.
+         */
+        constexpr counter_type operator()(
+            const std::uint64_t index,
+            const std::uint64_t step
+        ) const
+        {
+            return (*this)(counter_type{
+                static_cast<std::uint32_t>(index),
+                static_cast<std::uint32_t>(index >> 32),
+                static_cast<std::uint32_t>(step),
+                static_cast<std::uint32_t>(step >> 32)
+            });
+        }
+
+        /**
+         * @brief Returns the bits of item @p index at @p step packed into
+         *        64 bit words, lane-generic version of operator().
+         *
+         * @tparam T `std::uint64_t` or a vector of it.
+         */
+        template <typename T>
+        constexpr std::array<T, words_per_call> bits(
+            const T             index,
+            const std::uint64_t step
+        ) const
+        {
+            const auto result = generate(std::array<T, 4>{
+                index & details::low_word_mask,
+                index >> 32,
+                T{} + (step & details::low_word_mask),
+                T{} + (step >> 32)
+            });
+
+            return {
+                result[0] | (result[1] << 32),
+                result[2] | (result[3] << 32)
+            };
+        }
+    };
+
+    /**
+     * @brief Counter-based Philox4x64 generator (Salmon et al., SC'11).
+     *
+     * The 64 bit variant of Philox4x32 with a 256 bit counter and a 128
+     * bit key. The wide multiplication is composed of 32 bit products, so
+     * bits() vectorizes as well.
+     *
+     * @tparam Rounds number of rounds, 10 passes BigCrush.
+     */
+    template <size_t Rounds = 10>
+    class Philox4x64
+    {
+       public:
+        using word_type    = std::uint64_t;
+        using counter_type = std::array<std::uint64_t, 4>;
+        using key_type     = std::array<std::uint64_t, 2>;
+
+        /// number of 64 bit words returned by bits()
+        static constexpr size_t words_per_call = 4;
+
+       private:
+        static constexpr std::uint64_t _multiplier0 = 0xD2E7470EE14C6C93;
+        static constexpr std::uint64_t _multiplier1 = 0xCA5A826395121157;
+        static constexpr std::uint64_t _weyl0       = 0x9E3779B97F4A7C15;
+        static constexpr std::uint64_t _weyl1       = 0xBB67AE8584CAA73B;
+
+        key_type _key;
+
+       public:
+        constexpr explicit Philox4x64(const key_type key) : _key(key) {}
+
+        /// @brief Creates a generator keyed by a 64 bit seed.
+        constexpr explicit Philox4x64(const std::uint64_t seed)
+            : _key{seed, 0}
+        {
+        }
+
+        /// @brief Returns the key.
+        constexpr key_type key() const { return _key; }
+
+        /**
+         * @brief Applies the rounds to a counter.
+         *
+         * @tparam T `std::uint64_t` or a vector of it.
+         */
+        template <typename T>
+        constexpr std::array<T, 4> generate(std::array<T, 4> counter) const
+        {
+            auto key = _key;
+
+            for (size_t round = 0; round < Rounds; ++round)
+            {
+                const auto [high0, low0] =
+                    details::mulHiLo64(counter[0], _multiplier0);
+                const auto [high1, low1] =
+                    details::mulHiLo64(counter[2], _multiplier1);
+
+                counter = {
+                    high1 ^ counter[1] ^ key[0],
+                    low1,
+                    high0 ^ counter[3] ^ key[1],
+                    low0
+                };
+
+                key[0] += _weyl0;
+                key[1] += _weyl1;
+            }
+
+            return counter;
+        }
+
+        /// @brief Returns the random bits belonging to @p counter.
+        constexpr counter_type operator()(const counter_type counter) const
+        {
+            return generate(counter);
+        }
+
+        /// @brief Returns the random bits of item @p index at @p step.
+        constexpr counter_type operator()(
+            const std::uint64_t index,
+            const std::uint64_t step
+        ) const
+        {
+            return generate(counter_type{index, step, 0, 0});
+        }
+
+        /**
+         * @brief Returns the bits of item @p index at @p step, lane-generic
+         *        version of operator().
+         *
+         * @tparam T `std::uint64_t` or a vector of it.
+         */
+        template <typename T>
+        constexpr std::array<T, words_per_call> bits(
+            const T             index,
+            const std::uint64_t step
+        ) const
+        {
+            return generate(std::array<T, 4>{index, T{} + step, T{}, T{}});
+        }
+    };
+
+}   // namespace mstd
+
+#endif   // __MSTD__RANDOM__PHILOX_HPP__
@@ -0,0 +1,327 @@
+/*****************************************************************************
+<GPL_HEADER>
+
+    mstd library
+    Copyright (C) 2025-now  Jakob Gamper
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+<GPL_HEADER>
+******************************************************************************/
+
+#ifndef __MSTD__RANDOM__STREAM_HPP__
+#define __MSTD__RANDOM__STREAM_HPP__
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <span>
+
+#include "distributions.hpp"
+#include "mstd/simd.hpp"
+#include "mstd/type_traits/random_traits.hpp"
+#include "philox.hpp"
+
+namespace mstd
+{
+    /**
+     * @brief Selects how RandomStream::fillNormal draws normal values.
+     *
+     * `Ziggurat` needs one 64 bit word for almost every value. `BoxMuller`
+     * turns two words into two values with a logarithm, a square root and
+     * a sine and cosine.
+     */
+    enum class NormalMethod
+    {
+        Ziggurat,
+        BoxMuller
+    };
+
+    /**
+     * @brief Sequence of random 64 bit words drawn from a counter-based
+     *        generator.
+     *
+     * The stream evaluates the generator at consecutive indices within its
+     * stream id. Indices are processed in groups of eight, word-major
+     * within a group, so that fill() stores whole SIMD vectors: word `w`
+     * of index `8g + l` is element `g * 8 * W + 8 * w + l` of the sequence,
+     * with W the number of words per call. The sequence therefore does not
+     * depend on the SIMD width of the target, and successive calls of
+     * fillBits(), fill() and operator() continue it seamlessly.
+     *
+     * Independent streams need neither jumps nor shared state: streams
+     * with different ids of the same generator never overlap, and split()
+     * derives a generator with a new key.
+     *
+     * RandomStream satisfies `std::uniform_random_bit_generator`, so it
+     * also drives the distributions of `<random>`.
+     *
+     * @tparam Generator counter-based generator, see
+     *         CounterBasedGeneratorType.
+     */
+    template <CounterBasedGeneratorType Generator = Philox4x32<>>
+    class RandomStream
+    {
+       public:
+        using result_type = std::uint64_t;
+
+        /// number of indices evaluated together
+        static constexpr size_t group_size = 8;
+
+        /// number of words per group of indices
+        static constexpr size_t group_words =
+            group_size * Generator::words_per_call;
+
+       private:
+        using V                       = SimdVec<std::uint64_t>;
+        static constexpr size_t width = simd_size_v<V>;
+
+        static_assert(group_size % width == 0);
+
+        Generator     _generator;
+        std::uint64_t _stream;
+        std::uint64_t _position = 0;
+
+        /// group containing the position, valid unless it is a multiple of
+        /// group_words
+        alignas(64) std::array<std::uint64_t, group_words> _buffer{};
+
+       public:
+        /**
+         * @brief Creates stream @p stream of @p generator.
+         */
+        explicit RandomStream(
+            const Generator     generator,
+            const std::uint64_t stream = 0
+        )
+            : _generator(generator), _stream(stream)
+        {
+        }
+
+        /**
+         * @brief Creates stream @p stream of a generator keyed by @p seed.
+         */
+        explicit RandomStream(
+            const std::uint64_t seed,
+            const std::uint64_t stream = 0
+        )
+            : RandomStream(Generator(seed), stream)
+        {
+        }
+
+        static constexpr result_type min() { return 0; }
+        static constexpr result_type max()
+        {
+            return std::numeric_limits<result_type>::max();
+        }
+
+        /// @brief Returns the generator.
+        const Generator& generator() const { return _generator; }
+
+        /// @brief Returns the stream id.
+        std::uint64_t stream() const { return _stream; }
+
+        /// @brief Returns the number of words drawn so far.
+        std::uint64_t position() const { return _position; }
+
+        /**
+         * @brief Moves to word @p position of the sequence.
+         *
+         * Counter-based generators seek in constant time.
+         */
+        void seek(const std::uint64_t position)
+        {
+            _position = position;
+
+            if (_position % group_words != 0)
+                _generateGroup(_position / group_words, _buffer.data());
+        }
+
+        /**
+         * @brief Returns an independent stream for @p id.
+         *
+         * The generator of the new stream is keyed by the output of this
+         * generator on a reserved stream id, the maximum of
+         * `std::uint64_t`, so split streams can be split again.
+         */
+        RandomStream split(const std::uint64_t id) const
+        {
+            const auto words = _generator.template bits<std::uint64_t>(
+                id,
+                std::numeric_limits<std::uint64_t>::max()
+            );
+
+            return RandomStream(Generator(words[0] ^ _stream), 0);
+        }
+
+        /// @brief Returns the next random word.
+        result_type operator()()
+        {
+            const size_t offset = _position % group_words;
+
+            if (offset == 0)
+                _generateGroup(_position / group_words, _buffer.data());
+
+            ++_position;
+            return _buffer[offset];
+        }
+
+        /**
+         * @brief Fills @p out with the next random words.
+         *
+         * Whole groups are generated with SIMD directly into @p out.
+         */
+        void fillBits(std::span<std::uint64_t> out)
+        {
+            const auto next = [this] { return (*this)(); };
+
+            // finish the current group first
+            const auto head = std::min<size_t>(
+                out.size(),
+                (group_words - _position % group_words) % group_words
+            );
+            std::ranges::generate(out.first(head), next);
+            out = out.subspan(head);
+
+            for (; out.size() >= group_words; out = out.subspan(group_words))
+            {
+                _generateGroup(_position / group_words, out.data());
+                _position += group_words;
+            }
+
+            std::ranges::generate(out, next);
+        }
+
+        /**
+         * @brief Fills @p out with uniform values in [0, 1), see
+         *        uniformFromBits().
+         */
+        void fill(std::span<double> out)
+        {
+            using VD = SimdVec<double, width>;
+
+            _inChunks(
+                out,
+                [](const std::uint64_t* bits, double* values, size_t n)
+                {
+                    const size_t vectors = n - n % width;
+
+                    for (size_t i = 0; i < vectors; i += width)
+                        simdStore<VD>(
+                            values + i,
+                            uniformFromBits(simdLoad<V>(bits + i))
+                        );
+
+                    for (size_t i = vectors; i < n; ++i)
+                        values[i] = uniformFromBits(bits[i]);
+                }
+            );
+        }
+
+        /**
+         * @brief Fills @p out with normal values of mean @p mean and
+         *        standard deviation @p stddev.
+         */
+        void fillNormal(
+            std::span<double>  out,
+            const double       mean   = 0.0,
+            const double       stddev = 1.0,
+            const NormalMethod method = NormalMethod::Ziggurat
+        )
+        {
+            if (method == NormalMethod::Ziggurat)
+            {
+                _inChunks(
+                    out,
+                    [&](const std::uint64_t* bits, double* values, size_t n)
+                    {
+                        for (size_t i = 0; i < n; ++i)
+                        {
+                            const double z = zigguratNormal(bits[i], *this);
+                            values[i]      = mean + stddev * z;
+                        }
+                    }
+                );
+                return;
+            }
+
+            _inChunks(
+                out,
+                [&](const std::uint64_t* bits, double* values, size_t n)
+                {
+                    for (size_t i = 0; i < n; i += 2)
+                    {
+                        // an odd count draws the partner of the last value
+                        const auto partner =
+                            i + 1 < n ? bits[i + 1] : (*this)();
+
+                        const auto [a, b] = boxMuller(
+                            details::uniformOpenFromBits(bits[i]),
+                            uniformFromBits(partner)
+                        );
+
+                        values[i] = mean + stddev * a;
+
+                        if (i + 1 < n)
+                            values[i + 1] = mean + stddev * b;
+                    }
+                }
+            );
+        }
+
+       private:
+        /// evaluates group @p group into @p out, word-major
+        void _generateGroup(const std::uint64_t group, std::uint64_t* out) const
+        {
+            constexpr size_t words = Generator::words_per_call;
+
+            for (size_t lane = 0; lane < group_size; lane += width)
+            {
+                V index = simdBroadcast<V>(group * group_size + lane);
+
+                for (size_t l = 0; l < width; ++l)
+                    index[l] += l;
+
+                const auto bits =
+                    _generator.template bits<V>(index, _stream);
+
+                for (size_t w = 0; w < words; ++w)
+                    simdStore(out + w * group_size + lane, bits[w]);
+            }
+        }
+
+        /// draws the words for @p out in chunks and transforms them with
+        /// `transform(bits, values, n)`
+        template <typename Transform>
+        void _inChunks(std::span<double> out, Transform&& transform)
+        {
+            constexpr size_t chunk = 256;
+
+            alignas(64) std::array<std::uint64_t, chunk> bits;
+
+            for (size_t begin = 0; begin < out.size(); begin += chunk)
+            {
+                const size_t n = std::min(chunk, out.size() - begin);
+
+                fillBits(std::span(bits.data(), n));
+                transform(bits.data(), out.data() + begin, n);
+            }
+        }
+    };
+
+}   // namespace mstd
+
+#endif   // __MSTD__RANDOM__STREAM_HPP__
@@ -0,0 +1,542 @@
+/*****************************************************************************
+<GPL_HEADER>
+
+    mstd library
+    Copyright (C) 2025-now  Jakob Gamper
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+<GPL_HEADER>
+******************************************************************************/
+
+#ifndef __MSTD__SIMD__MATH_HPP__
+#define __MSTD__SIMD__MATH_HPP__
+
+#include <array>
+#include <bit>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include <utility>
+
+#if defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+#include "vec.hpp"
+
+namespace mstd
+{
+    namespace details
+    {
+        /**
+         * @brief square root by Newton iteration for constant evaluation
+         *
+         * @details Starts above the root, so the iterates decrease
+         * monotonically until rounding stalls them.
+         */
+        template <typename T>
+        constexpr T constexprSqrt(const T x)
+        {
+            if (!(x > 0) || x == std::numeric_limits<T>::infinity())
+                return x == 0 || x == std::numeric_limits<T>::infinity()
+                           ? x
+                           : std::numeric_limits<T>::quiet_NaN();
+
+            T root = x > 1 ? x : T{1};
+            for (;;)
+            {
+                const T next = (root + x / root) / 2;
+                if (!(next < root))
+                    return root;
+                root = next;
+            }
+        }
+
+    }   // namespace details
+
+    /**
+     * @brief lane-wise square root for scalars and vectors
+     *
+     * @details `std::sqrt` has to maintain `errno`, which keeps the compiler
+     * from vectorizing it. For vectors the packed x86 instructions are used
+     * directly; other targets fall back to a lane loop. Constant evaluation
+     * uses a Newton iteration.
+     *
+     * @tparam T scalar or vector type
+     * @param x
+     * @return T
+     */
+    template <typename T>
+    inline constexpr T simdSqrt(const T x)
+    {
+        if consteval
+        {
+            if constexpr (!is_simd_vec_v<T>)
+                return details::constexprSqrt(x);
+            else
+            {
+                T result{};
+                for (size_t i = 0; i < simd_size_v<T>; ++i)
+                    result[i] = details::constexprSqrt(x[i]);
+                return result;
+            }
+        }
+
+        if constexpr (!is_simd_vec_v<T>)
+            return std::sqrt(x);
+        else
+        {
+            using Scalar = simd_scalar_t<T>;
+
+            [[maybe_unused]] constexpr bool isDouble =
+                std::is_same_v<Scalar, double>;
+            [[maybe_unused]] constexpr bool isFloat =
+                std::is_same_v<Scalar, float>;
+
+#if defined(__AVX512F__)
+            // the maskz form avoids a -Wuninitialized false positive in the
+            // unmasked intrinsic of older gcc versions
+            if constexpr (sizeof(T) == 64 && isDouble)
+                return _mm512_maskz_sqrt_pd(0xFF, x);
+            else if constexpr (sizeof(T) == 64 && isFloat)
+                return _mm512_maskz_sqrt_ps(0xFFFF, x);
+#endif
+#if defined(__AVX__)
+            if constexpr (sizeof(T) == 32 && isDouble)
+                return _mm256_sqrt_pd(x);
+            else if constexpr (sizeof(T) == 32 && isFloat)
+                return _mm256_sqrt_ps(x);
+#endif
+#if defined(__SSE2__)
+            if constexpr (sizeof(T) == 16 && isDouble)
+                return _mm_sqrt_pd(x);
+            else if constexpr (sizeof(T) == 16 && isFloat)
+                return _mm_sqrt_ps(x);
+#endif
+            T result{};
+            for (size_t i = 0; i < simd_size_v<T>; ++i)
+                result[i] = std::sqrt(x[i]);
+            return result;
+        }
+    }
+
+    /**
+     * @brief rounding modes of simdRound
+     */
+    enum class RoundingMode
+    {
+        Nearest,   ///< to the nearest integer, ties to even
+        Floor      ///< towards negative infinity
+    };
+
+    /**
+     * @brief lane-wise rounding to an integral value for scalars and vectors
+     *
+     * @details Uses the packed rounding instructions of SSE4.1 and later;
+     * other targets fall back to the branch-free magic number trick, which
+     * stays vectorized on SSE2 and NEON.
+     *
+     * @tparam Mode rounding mode
+     * @tparam T scalar or vector type
+     * @param x
+     * @return T
+     */
+    template <RoundingMode Mode, typename T>
+    inline T simdRound(const T x)
+    {
+        if constexpr (!is_simd_vec_v<T>)
+        {
+            if constexpr (Mode == RoundingMode::Nearest)
+                return std::nearbyint(x);
+            else
+                return std::floor(x);
+        }
+        else
+        {
+            using Scalar = simd_scalar_t<T>;
+
+            [[maybe_unused]] constexpr bool isDouble =
+                std::is_same_v<Scalar, double>;
+            [[maybe_unused]] constexpr bool isFloat =
+                std::is_same_v<Scalar, float>;
+
+#if defined(__SSE4_1__)
+            constexpr int mode =
+                (Mode == RoundingMode::Nearest ? _MM_FROUND_TO_NEAREST_INT
+                                               : _MM_FROUND_TO_NEG_INF) |
+                _MM_FROUND_NO_EXC;
+#endif
+#if defined(__AVX512F__)
+            if constexpr (sizeof(T) == 64 && isDouble)
+                return _mm512_maskz_roundscale_pd(0xFF, x, mode);
+            else if constexpr (sizeof(T) == 64 && isFloat)
+                return _mm512_maskz_roundscale_ps(0xFFFF, x, mode);
+#endif
+#if defined(__AVX__)
+            if constexpr (sizeof(T) == 32 && isDouble)
+                return _mm256_round_pd(x, mode);
+            else if constexpr (sizeof(T) == 32 && isFloat)
+                return _mm256_round_ps(x, mode);
+#endif
+#if defined(__SSE4_1__)
+            if constexpr (sizeof(T) == 16 && isDouble)
+                return _mm_round_pd(x, mode);
+            else if constexpr (sizeof(T) == 16 && isFloat)
+                return _mm_round_ps(x, mode);
+#endif
+            // portable fallback: adding and subtracting 2^52 (2^23 for
+            // float) rounds |x| to the nearest integer in the current
+            // rounding mode; larger magnitudes are integers already
+            constexpr auto magic = isDouble ? Scalar(0x1p52) : Scalar(0x1p23);
+
+            const auto zero    = simdBroadcast<T>(0);
+            const auto one     = simdBroadcast<T>(1);
+            const auto big     = simdBroadcast<T>(magic);
+            const auto abs     = x < zero ? -x : x;
+            auto       rounded = (abs + big) - big;
+            rounded            = x < zero ? -rounded : rounded;
+            rounded            = abs < big ? rounded : x;
+
+            if constexpr (Mode == RoundingMode::Floor)
+                rounded = rounded > x ? rounded - one : rounded;
+
+            return rounded;
+        }
+    }
+
+    /**
+     * @brief lane-wise rounding to the nearest integer (ties to even)
+     *
+     * @details Vector counterpart of `std::nearbyint`, used for minimum image
+     * shifts.
+     */
+    template <typename T>
+    inline T simdNearbyint(const T x)
+    {
+        return simdRound<RoundingMode::Nearest>(x);
+    }
+
+    /**
+     * @brief lane-wise rounding towards negative infinity
+     *
+     * @details Vector counterpart of `std::floor`, used for wrapping
+     * positions into the box.
+     */
+    template <typename T>
+    inline T simdFloor(const T x)
+    {
+        return simdRound<RoundingMode::Floor>(x);
+    }
+
+    /**
+     * @brief lane-wise 64 bit product of the low 32 bits of @p a and @p b
+     *
+     * @details Compilers do not know that the upper halves are zero and
+     * emit a full 64 bit multiplication, which x86 only has with
+     * AVX-512DQ and otherwise emulates. The packed unsigned 32 x 32 bit
+     * multiplication (`pmuludq`) does it in one instruction. Constant
+     * evaluation uses the portable form.
+     *
+     * @tparam T `std::uint64_t` or a vector of it
+     * @param a
+     * @param b
+     * @return T
+     */
+    template <typename T>
+    inline constexpr T simdMulLow32(const T a, const T b)
+    {
+        constexpr std::uint64_t mask = 0xFFFFFFFF;
+
+        if !consteval
+        {
+#if defined(__AVX512F__)
+            // the zero-masked form: the plain one reads an undefined
+            // passthrough, which GCC 12 reports as uninitialized
+            if constexpr (sizeof(T) == 64)
+                return std::bit_cast<T>(_mm512_maskz_mul_epu32(
+                    0xFF,
+                    std::bit_cast<__m512i>(a),
+                    std::bit_cast<__m512i>(b)
+                ));
+#endif
+#if defined(__AVX2__)
+            if constexpr (sizeof(T) == 32)
+                return std::bit_cast<T>(_mm256_mul_epu32(
+                    std::bit_cast<__m256i>(a),
+                    std::bit_cast<__m256i>(b)
+                ));
+#endif
+#if defined(__SSE2__)
+            if constexpr (sizeof(T) == 16)
+                return std::bit_cast<T>(_mm_mul_epu32(
+                    std::bit_cast<__m128i>(a),
+                    std::bit_cast<__m128i>(b)
+                ));
+#endif
+        }
+
+        return (a & mask) * (b & mask);
+    }
+
+    namespace details
+    {
+        /**
+         * @brief lane-wise \f$2^k\f$ for integral valued @p k
+         *
+         * @details Builds the result directly from the exponent bits, so
+         * @p k has to lie within the normal exponent range of the scalar
+         * type. Adding \f$1.5 \cdot 2^{52}\f$ (\f$1.5 \cdot 2^{23}\f$ for
+         * `float`) moves @p k into the low mantissa bits, which avoids the
+         * floating point to integer conversion that AVX2 lacks for 64 bit
+         * lanes.
+         */
+        template <typename T>
+        inline T simdExp2Int(const T k)
+        {
+            using Scalar = simd_scalar_t<T>;
+
+            constexpr bool isDouble = std::is_same_v<Scalar, double>;
+
+            using Int =
+                std::conditional_t<isDouble, std::int64_t, std::int32_t>;
+
+            using IntT = std::conditional_t<
+                is_simd_vec_v<T>,
+                SimdVec<Int, simd_size_v<T>>,
+                Int>;
+
+            constexpr Int  bias     = isDouble ? 1023 : 127;
+            constexpr Int  mantissa = isDouble ? 52 : 23;
+            constexpr auto shifter  = isDouble ? Scalar(0x1.8p52)
+                                               : Scalar(0x1.8p23F);
+
+            constexpr auto offset = std::bit_cast<Int>(shifter) - bias;
+
+            const auto bits =
+                std::bit_cast<IntT>(k + simdBroadcast<T>(shifter));
+            return std::bit_cast<T>((bits - offset) << mantissa);
+        }
+
+        /// @brief Horner evaluation of the polynomial with coefficients @p c
+        ///        in ascending order, unrolled at compile time.
+        template <typename T, typename Scalar, size_t N>
+        inline T simdHorner(const std::array<Scalar, N>& c, const T x)
+        {
+            return [&]<size_t... K>(std::index_sequence<K...>)
+            {
+                auto result = simdBroadcast<T>(c[N - 1]);
+                ((result = result * x + simdBroadcast<T>(c[N - 2 - K])), ...);
+                return result;
+            }(std::make_index_sequence<N - 1>{});
+        }
+
+    }   // namespace details
+
+    /**
+     * @brief lane-wise exponential function for scalars and vectors
+     *
+     * @details Cody-Waite reduction \f$x = k \ln 2 + s\f$ with
+     * \f$|s| \le \ln 2 / 2\f$, a Taylor polynomial for \f$e^s\f$
+     * (degree 13 for `double`, 7 for `float`) and a scaling by \f$2^k\f$
+     * built from the exponent bits. The scaling is split in two factors so
+     * that the full range including subnormal results is covered without
+     * branches. The measured error is at most 1 ulp over the whole range for
+     * both `double` and `float`; results overflow to infinity and underflow
+     * to zero like `std::exp`.
+     *
+     * @tparam T floating point scalar or vector type
+     * @param x
+     * @return T
+     */
+    template <typename T>
+    inline T simdExp(const T x)
+    {
+        using Scalar = simd_scalar_t<T>;
+
+        static_assert(std::is_floating_point_v<Scalar>);
+
+        constexpr bool isDouble = std::is_same_v<Scalar, double>;
+
+        // largest argument with a finite result and smallest argument with a
+        // non-zero result
+        constexpr auto hi = isDouble ? Scalar(709.782712893384)
+                                     : Scalar(88.7228391F);
+        constexpr auto lo = isDouble ? Scalar(-745.1332191019411)
+                                     : Scalar(-103.972076F);
+
+        constexpr auto log2e = Scalar(1.4426950408889634);
+
+        // ln 2 split into a part with trailing zero bits and a remainder
+        constexpr auto ln2Hi = isDouble ? Scalar(6.93147180369123816490e-01)
+                                        : Scalar(0.693359375F);
+        constexpr auto ln2Lo = isDouble ? Scalar(1.90821492927058770002e-10)
+                                        : Scalar(-2.12194440e-4F);
+
+        static constexpr std::array<Scalar, 14> taylorDouble{
+            Scalar(1.0),
+            Scalar(1.0),
+            Scalar(1.0 / 2),
+            Scalar(1.0 / 6),
+            Scalar(1.0 / 24),
+            Scalar(1.0 / 120),
+            Scalar(1.0 / 720),
+            Scalar(1.0 / 5040),
+            Scalar(1.0 / 40320),
+            Scalar(1.0 / 362880),
+            Scalar(1.0 / 3628800),
+            Scalar(1.0 / 39916800),
+            Scalar(1.0 / 479001600),
+            Scalar(1.0 / 6227020800)
+        };
+        static constexpr std::array<Scalar, 8> taylorFloat{
+            Scalar(1.0),
+            Scalar(1.0),
+            Scalar(1.0 / 2),
+            Scalar(1.0 / 6),
+            Scalar(1.0 / 24),
+            Scalar(1.0 / 120),
+            Scalar(1.0 / 720),
+            Scalar(1.0 / 5040)
+        };
+
+        const auto upper = simdBroadcast<T>(hi);
+        const auto lower = simdBroadcast<T>(lo);
+
+        auto clamped = x > upper ? upper : x;
+        clamped      = clamped < lower ? lower : clamped;
+
+        const auto k = simdNearbyint(clamped * simdBroadcast<T>(log2e));
+        const auto s = (clamped - k * simdBroadcast<T>(ln2Hi)) -
+                       k * simdBroadcast<T>(ln2Lo);
+
+        T poly;
+        if constexpr (isDouble)
+            poly = details::simdHorner(taylorDouble, s);
+        else
+            poly = details::simdHorner(taylorFloat, s);
+
+        // 2^k = 2^(k/2) 2^(k - k/2) keeps both factors normal
+        const auto half = simdFloor(k * simdBroadcast<T>(Scalar(0.5)));
+
+        auto result = poly * details::simdExp2Int(half) *
+                      details::simdExp2Int(k - half);
+
+        result = x > upper
+                     ? simdBroadcast<T>(std::numeric_limits<Scalar>::infinity())
+                     : result;
+        result = x < lower ? simdBroadcast<T>(0) : result;
+
+        // propagate NaN
+        return x == x ? result : x;
+    }
+
+    /**
+     * @brief lane-wise complementary error function together with
+     *        \f$e^{-x^2}\f$
+     *
+     * @details Evaluates \f$\mathrm{erfc}(x) = e^{-x^2} P(t)\f$ with
+     * \f$t = 1 / (1 + p|x|)\f$ and a polynomial \f$P\f$ fitted to
+     * Chebyshev nodes on \f$0 \le |x| \le 6\f$ for `double` (degree 16,
+     * absolute error below \f$3 \cdot 10^{-15}\f$) and \f$0 \le |x| \le
+     * 4\f$ for `float` (degree 8, absolute error below \f$5 \cdot
+     * 10^{-7}\f$). Beyond the fit range \f$\mathrm{erfc}\f$ is smaller
+     * than the error bound and \f$P\f$ is frozen at the range end. Negative
+     * arguments use \f$\mathrm{erfc}(-x) = 2 - \mathrm{erfc}(x)\f$.
+     *
+     * Damped electrostatics need \f$e^{-x^2}\f$ for the force anyway, so
+     * it is returned alongside instead of being recomputed.
+     *
+     * @tparam T floating point scalar or vector type
+     * @param x
+     * @return pair of \f$\mathrm{erfc}(x)\f$ and \f$e^{-x^2}\f$
+     */
+    template <typename T>
+    inline std::pair<T, T> simdErfcAndExp(const T x)
+    {
+        using Scalar = simd_scalar_t<T>;
+
+        static_assert(std::is_floating_point_v<Scalar>);
+
+        constexpr bool isDouble = std::is_same_v<Scalar, double>;
+
+        constexpr auto p    = isDouble ? Scalar(0.3) : Scalar(0.5F);
+        constexpr auto xMax = isDouble ? Scalar(6.0) : Scalar(4.0F);
+
+        static constexpr std::array<Scalar, 17> coeffsDouble{
+            Scalar(-2.8578998374907103e-06),
+            Scalar(0.16933857925294596),
+            Scalar(0.1681671594261884),
+            Scalar(0.1706423359632629),
+            Scalar(0.09484684070867726),
+            Scalar(0.3417106215367588),
+            Scalar(-0.5970564060450088),
+            Scalar(1.7965494856549025),
+            Scalar(-3.3121127907131602),
+            Scalar(5.136829267020689),
+            Scalar(-6.0697635383449144),
+            Scalar(5.5318123320755),
+            Scalar(-3.7628491083279423),
+            Scalar(1.8067799201586874),
+            Scalar(-0.574023426909196),
+            Scalar(0.10837286485005436),
+            Scalar(-0.00924127840760587)
+        };
+        static constexpr std::array<Scalar, 9> coeffsFloat{
+            Scalar(-0.0005577559932135046F),
+            Scalar(0.2911182940006256F),
+            Scalar(0.21845586597919464F),
+            Scalar(0.5024858713150024F),
+            Scalar(-0.4622167646884918F),
+            Scalar(1.089716911315918F),
+            Scalar(-0.9494773149490356F),
+            Scalar(0.3653818368911743F),
+            Scalar(-0.05490696057677269F)
+        };
+
+        const auto zero = simdBroadcast<T>(0);
+        const auto one  = simdBroadcast<T>(1);
+
+        const auto absX   = x < zero ? -x : x;
+        const auto bounded =
+            absX < simdBroadcast<T>(xMax) ? absX : simdBroadcast<T>(xMax);
+        const auto t = one / (one + simdBroadcast<T>(p) * bounded);
+
+        T poly;
+        if constexpr (isDouble)
+            poly = details::simdHorner(coeffsDouble, t);
+        else
+            poly = details::simdHorner(coeffsFloat, t);
+
+        const auto expMinusX2 = simdExp(-x * x);
+        const auto erfc       = expMinusX2 * poly;
+
+        return {x < zero ? simdBroadcast<T>(2) - erfc : erfc, expMinusX2};
+    }
+
+    /**
+     * @brief lane-wise complementary error function
+     *
+     * @details See simdErfcAndExp for the approximation and its error.
+     */
+    template <typename T>
+    inline T simdErfc(const T x)
+    {
+        return simdErfcAndExp(x).first;
+    }
+
+}   // namespace mstd
+
+#endif   // __MSTD__SIMD__MATH_HPP__
@@ -0,0 +1,140 @@
+/*****************************************************************************
+<GPL_HEADER>
+
+    mstd library
+    Copyright (C) 2025-now  Jakob Gamper
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+<GPL_HEADER>
+******************************************************************************/
+
+#ifndef __MSTD__SIMD__TRANSFORM_HPP__
+#define __MSTD__SIMD__TRANSFORM_HPP__
+
+#include <cassert>
+#include <span>
+
+#include "vec.hpp"
+
+namespace mstd
+{
+    /**
+     * @brief Applies a lane-generic kernel to @p in producing two outputs.
+     *
+     * The kernel is invoked with `SimdVec<Rep>` for all full vectors and with
+     * plain `Rep` for the remaining scalar tail. It has to return a pair-like
+     * object whose two members are written to @p out1 and @p out2.
+     *
+     * @pre `out1.size() >= in.size()` and `out2.size() >= in.size()`
+     *
+     * @tparam Rep lane type
+     * @tparam Kernel generic callable `(T) -> std::pair<T, T>`
+     * @param in input values
+     * @param out1 first output
+     * @param out2 second output
+     * @param kernel
+     */
+    template <typename Rep, typename Kernel>
+    inline void simdTransform(
+        std::span<const Rep> in,
+        std::span<Rep>       out1,
+        std::span<Rep>       out2,
+        Kernel&&             kernel
+    )
+    {
+        using V                = SimdVec<Rep>;
+        constexpr size_t width = simd_size_v<V>;
+
+        assert(out1.size() >= in.size());
+        assert(out2.size() >= in.size());
+
+        const size_t size    = in.size();
+        const size_t vectors = size - size % width;
+        size_t       i       = 0;
+
+        for (; i < vectors; i += width)
+        {
+            const auto [first, second] = kernel(simdLoad<V>(in.data() + i));
+            simdStore(out1.data() + i, first);
+            simdStore(out2.data() + i, second);
+        }
+
+        for (; i < size; ++i)
+        {
+            const auto [first, second] = kernel(in[i]);
+            out1[i]                    = first;
+            out2[i]                    = second;
+        }
+    }
+
+    /**
+     * @brief Applies a lane-generic kernel in place to three arrays.
+     *
+     * The kernel is invoked with three `SimdVec<Rep>` for all full vectors
+     * and with three plain `Rep` for the remaining scalar tail. It has to
+     * return a tuple-like object of three values written back to @p a, @p b
+     * and @p c.
+     *
+     * @pre `a.size() == b.size()` and `a.size() == c.size()`
+     *
+     * @tparam Rep lane type
+     * @tparam Kernel generic callable `(T, T, T) -> std::array<T, 3>`
+     * @param a
+     * @param b
+     * @param c
+     * @param kernel
+     */
+    template <typename Rep, typename Kernel>
+    inline void simdTransformInPlace(
+        std::span<Rep> a,
+        std::span<Rep> b,
+        std::span<Rep> c,
+        Kernel&&       kernel
+    )
+    {
+        using V                = SimdVec<Rep>;
+        constexpr size_t width = simd_size_v<V>;
+
+        assert(b.size() == a.size());
+        assert(c.size() == a.size());
+
+        const size_t size    = a.size();
+        const size_t vectors = size - size % width;
+        size_t       i       = 0;
+
+        for (; i < vectors; i += width)
+        {
+            const auto [ra, rb, rc] = kernel(
+                simdLoad<V>(a.data() + i),
+                simdLoad<V>(b.data() + i),
+                simdLoad<V>(c.data() + i)
+            );
+            simdStore(a.data() + i, ra);
+            simdStore(b.data() + i, rb);
+            simdStore(c.data() + i, rc);
+        }
+
+        for (; i < size; ++i)
+        {
+            const auto [ra, rb, rc] = kernel(a[i], b[i], c[i]);
+            a[i]                    = ra;
+            b[i]                    = rb;
+            c[i]                    = rc;
+        }
+    }
+
+}   // namespace mstd
+
+#endif   // __MSTD__SIMD__TRANSFORM_HPP__
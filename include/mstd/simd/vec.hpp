@@ -0,0 +1,188 @@
+/*****************************************************************************
+<GPL_HEADER>
+
+    mstd library
+    Copyright (C) 2025-now  Jakob Gamper
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+<GPL_HEADER>
+******************************************************************************/
+
+#ifndef __MSTD__SIMD__VEC_HPP__
+#define __MSTD__SIMD__VEC_HPP__
+
+#include <cstddef>
+#include <cstring>
+#include <utility>
+
+#include "mstd/type_traits/simd_traits.hpp"
+
+namespace mstd
+{
+    /**
+     * @brief width of the widest vector register enabled at compile time
+     *
+     * @details 64 bytes with AVX-512, 32 bytes with AVX/AVX2 and 16 bytes
+     * otherwise (SSE2 on x86-64, NEON on aarch64).
+     */
+#if defined(__AVX512F__)
+    static constexpr size_t simd_register_bytes = 64;
+#elif defined(__AVX__)
+    static constexpr size_t simd_register_bytes = 32;
+#else
+    static constexpr size_t simd_register_bytes = 16;
+#endif
+
+    /**
+     * @brief number of lanes of type T that fit into one native register
+     *
+     * @tparam T
+     */
+    template <typename T>
+    static constexpr size_t simd_width_v = simd_register_bytes / sizeof(T);
+
+    namespace details
+    {
+        template <typename T, size_t W>
+        struct simd_vec
+        {
+            using type [[gnu::vector_size(W * sizeof(T))]] = T;
+        };
+
+    }   // namespace details
+
+    /**
+     * @brief GNU vector extension type with @p W lanes of type @p T
+     *
+     * @details The compiler lowers arithmetic, comparisons and the ternary
+     * operator on these types to the instruction set selected by the target
+     * flags, e.g. AVX2 or AVX-512. Kernels written against a generic `T` can
+     * therefore be instantiated both for scalars and for vectors.
+     *
+     * @tparam T lane type
+     * @tparam W number of lanes (default: native register width)
+     */
+    template <typename T, size_t W = simd_width_v<T>>
+    using SimdVec = typename details::simd_vec<T, W>::type;
+
+    /**
+     * @brief broadcasts a scalar into all lanes of @p V
+     *
+     * @tparam V vector or scalar type
+     * @param value
+     * @return V
+     */
+    template <typename V>
+    inline constexpr V simdBroadcast(const simd_scalar_t<V> value)
+    {
+        if constexpr (is_simd_vec_v<V>)
+        {
+            V result{};
+            for (size_t i = 0; i < simd_size_v<V>; ++i)
+                result[i] = value;
+            return result;
+        }
+        else
+            return value;
+    }
+
+    /**
+     * @brief loads @p V from possibly unaligned memory
+     *
+     * @tparam V vector or scalar type
+     * @param ptr
+     * @return V
+     */
+    template <typename V>
+    inline V simdLoad(const simd_scalar_t<V>* ptr)
+    {
+        V result;
+        std::memcpy(&result, ptr, sizeof(V));
+        return result;
+    }
+
+    /**
+     * @brief stores @p value to possibly unaligned memory
+     *
+     * @tparam V vector or scalar type
+     * @param ptr
+     * @param value
+     */
+    template <typename V>
+    inline void simdStore(simd_scalar_t<V>* ptr, const V value)
+    {
+        std::memcpy(ptr, &value, sizeof(V));
+    }
+
+    namespace details
+    {
+        template <typename V, typename Index, size_t... Lanes>
+        inline V simdGatherImpl(
+            const simd_scalar_t<V>* base,
+            const Index*            indices,
+            std::index_sequence<Lanes...>
+        )
+        {
+            return V{base[indices[Lanes]]...};
+        }
+
+    }   // namespace details
+
+    /**
+     * @brief gathers `base[indices[l]]` into lane `l` of @p V
+     *
+     * @details The lanes are assembled in registers, which avoids the store
+     * forwarding stall of writing single lanes to memory and reloading the
+     * whole vector.
+     *
+     * @tparam V vector type
+     * @param base
+     * @param indices at least `simd_size_v<V>` indices
+     * @return V
+     */
+    template <typename V, typename Index>
+    inline V simdGather(const simd_scalar_t<V>* base, const Index* indices)
+    {
+        return details::simdGatherImpl<V>(
+            base,
+            indices,
+            std::make_index_sequence<simd_size_v<V>>{}
+        );
+    }
+
+    /**
+     * @brief sums all lanes of @p value
+     *
+     * @tparam V vector or scalar type
+     * @param value
+     * @return simd_scalar_t<V>
+     */
+    template <typename V>
+    inline constexpr simd_scalar_t<V> simdReduceAdd(const V value)
+    {
+        if constexpr (is_simd_vec_v<V>)
+        {
+            simd_scalar_t<V> sum{};
+            for (size_t i = 0; i < simd_size_v<V>; ++i)
+                sum += value[i];
+            return sum;
+        }
+        else
+            return value;
+    }
+
+}   // namespace mstd
+
+#endif   // __MSTD__SIMD__VEC_HPP__
@@ -26,8 +26,11 @@
 #include "type_traits/enum_traits.hpp"       // IWYU pragma: export
 #include "type_traits/math_traits.hpp"       // IWYU pragma: export
 #include "type_traits/pack_traits.hpp"       // IWYU pragma: export
+#include "type_traits/physics_traits.hpp"    // IWYU pragma: export
 #include "type_traits/quantity_traits.hpp"   // IWYU pragma: export
+#include "type_traits/random_traits.hpp"     // IWYU pragma: export
 #include "type_traits/ranges_traits.hpp"     // IWYU pragma: export
 #include "type_traits/ratio_traits.hpp"      // IWYU pragma: export
+#include "type_traits/simd_traits.hpp"       // IWYU pragma: export
 
 #endif   // __MSTD__TYPE_TRAITS_HPP__
\ No newline at end of file
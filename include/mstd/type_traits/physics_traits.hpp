@@ -0,0 +1,337 @@
+/*****************************************************************************
+<GPL_HEADER>
+
+    mstd library
+    Copyright (C) 2025-now  Jakob Gamper
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+<GPL_HEADER>
+******************************************************************************/
+
+#ifndef __MSTD__TYPE_TRAITS__PHYSICS_TRAITS_HPP__
+#define __MSTD__TYPE_TRAITS__PHYSICS_TRAITS_HPP__
+
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <utility>
+#include <vector>
+
+namespace mstd
+{
+    /**
+     * @brief concept for pair potentials
+     *
+     * @details Both the virtual LiePotential hierarchy and the static
+     * potentials built on PotentialBase satisfy this concept.
+     *
+     * @tparam P
+     */
+    template <typename P>
+    concept PairPotentialType = requires(
+        const P                          p,
+        typename P::rep                  r,
+        std::span<const typename P::rep> in,
+        std::span<typename P::rep>       out
+    ) {
+        { p.evalEnergy(r) } -> std::convertible_to<typename P::rep>;
+        { p.evalForce(r) } -> std::convertible_to<typename P::rep>;
+        {
+            p.eval(r)
+        } -> std::convertible_to<std::pair<typename P::rep, typename P::rep>>;
+        {
+            p.evalFromR2(r)
+        } -> std::convertible_to<std::pair<typename P::rep, typename P::rep>>;
+        p.evalBatch(in, out, out);
+        p.evalBatchFromR2(in, out, out);
+    };
+
+    /**
+     * @brief checks if P is a pair potential
+     *
+     * @tparam P
+     */
+    template <typename P>
+    static constexpr bool is_pair_potential_v = PairPotentialType<P>;
+
+    /**
+     * @brief concept for pair potentials indexed by particles
+     *
+     * @details Such potentials depend on the particles of a pair beyond
+     * their distance, e.g. on their species (SpeciesPairPotential). Pair
+     * kernels pass the particle indices along with the squared distance.
+     *
+     * @tparam P
+     */
+    template <typename P>
+    concept IndexedPairPotentialType = requires(
+        const P                          p,
+        size_t                           i,
+        typename P::rep                  r2,
+        std::span<const size_t>          indices,
+        std::span<const typename P::rep> in,
+        std::span<typename P::rep>       out
+    ) {
+        {
+            p.evalFromR2(i, i, r2)
+        } -> std::convertible_to<std::pair<typename P::rep, typename P::rep>>;
+        p.evalBatchFromR2(indices, indices, in, out, out);
+    };
+
+    /**
+     * @brief checks if P is a pair potential indexed by particles
+     *
+     * @tparam P
+     */
+    template <typename P>
+    static constexpr bool is_indexed_pair_potential_v =
+        IndexedPairPotentialType<P>;
+
+    /**
+     * @brief concept for potentials accepted by the pair kernels
+     *
+     * @tparam P
+     */
+    template <typename P>
+    concept PairKernelPotentialType =
+        PairPotentialType<P> || IndexedPairPotentialType<P>;
+
+    /**
+     * @brief concept for pair potentials with an energy-only path
+     *
+     * @details `energyFromR2(r2)` returns only the energy, skipping the
+     * force term where the potential can, e.g. for Monte Carlo moves. The
+     * LiePotential hierarchy and all potentials built on PotentialBase
+     * satisfy this concept.
+     *
+     * @tparam P
+     */
+    template <typename P>
+    concept EnergyPairPotentialType =
+        PairPotentialType<P> && requires(const P p, typename P::rep r2) {
+            { p.energyFromR2(r2) } -> std::convertible_to<typename P::rep>;
+        };
+
+    /**
+     * @brief checks if P is a pair potential with an energy-only path
+     *
+     * @tparam P
+     */
+    template <typename P>
+    static constexpr bool is_energy_pair_potential_v =
+        EnergyPairPotentialType<P>;
+
+    /**
+     * @brief concept for periodic boxes
+     *
+     * @details A box provides the minimum image of a displacement, wraps
+     * positions into the primary cell and maps them to fractional
+     * coordinates, e.g. OrthorhombicBox and TriclinicBox.
+     *
+     * @tparam B
+     */
+    template <typename B>
+    concept BoxType = requires(const B b, typename B::rep r) {
+        {
+            b.minimumImage(r, r, r)
+        } -> std::convertible_to<std::array<typename B::rep, 3>>;
+        {
+            b.wrap(r, r, r)
+        } -> std::convertible_to<std::array<typename B::rep, 3>>;
+        {
+            b.fractional(r, r, r)
+        } -> std::convertible_to<std::array<typename B::rep, 3>>;
+        {
+            b.perpendicularWidths()
+        } -> std::convertible_to<std::array<typename B::rep, 3>>;
+        { b.volume() } -> std::convertible_to<typename B::rep>;
+    };
+
+    /**
+     * @brief checks if B is a periodic box
+     *
+     * @tparam B
+     */
+    template <typename B>
+    static constexpr bool is_box_v = BoxType<B>;
+
+    /**
+     * @brief concept for the evaluation and accumulation precision of pair
+     *        kernels
+     *
+     * @details Pair kernels evaluate the potential in @p Eval and accumulate
+     * energies and forces in @p Acc. Either both agree, or a narrower
+     * floating point evaluation is accumulated in a wider type (mixed
+     * precision, e.g. `float` evaluation with `double` accumulation).
+     *
+     * @tparam Eval
+     * @tparam Acc
+     */
+    template <typename Eval, typename Acc>
+    concept AccumulatesIn =
+        std::same_as<Eval, Acc> ||
+        (std::floating_point<Eval> && std::floating_point<Acc> &&
+         sizeof(Eval) < sizeof(Acc));
+
+    /**
+     * @brief checks if evaluating in Eval and accumulating in Acc is a mixed
+     *        precision combination
+     *
+     * @tparam Eval
+     * @tparam Acc
+     */
+    template <typename Eval, typename Acc>
+    static constexpr bool is_mixed_precision_v =
+        AccumulatesIn<Eval, Acc> && !std::same_as<Eval, Acc>;
+
+    namespace details
+    {
+        /**
+         * @brief callback archetype of the pair sources
+         *
+         * @tparam Rep
+         */
+        template <typename Rep>
+        struct PairCallbackArchetype
+        {
+            void operator()(size_t, size_t, Rep, Rep, Rep, Rep) const {}
+        };
+
+    }   // namespace details
+
+    /**
+     * @brief concept for pair sources
+     *
+     * @details A pair source enumerates all particle pairs within its cutoff
+     * as `(i, j, dx, dy, dz, r2)`, e.g. AllPairs, CellList and VerletList.
+     *
+     * @tparam S
+     */
+    template <typename S>
+    concept PairSourceType =
+        requires(const S s, std::span<const typename S::rep> x) {
+            s.forEachPair(
+                x,
+                x,
+                x,
+                details::PairCallbackArchetype<typename S::rep>{}
+            );
+        };
+
+    /**
+     * @brief checks if S is a pair source
+     *
+     * @tparam S
+     */
+    template <typename S>
+    static constexpr bool is_pair_source_v = PairSourceType<S>;
+
+    /**
+     * @brief concept for pair sources that can be split into chunks
+     *
+     * @details `forEachPairInChunk(chunk, nChunks, x, y, z, callback)`
+     * visits a subset of the pairs such that the chunks `0..nChunks-1` are
+     * disjoint and together cover all pairs. Used by parallel kernels.
+     *
+     * @tparam S
+     */
+    template <typename S>
+    concept ChunkedPairSourceType = PairSourceType<S> &&
+        requires(const S s, size_t n, std::span<const typename S::rep> x) {
+            s.forEachPairInChunk(
+                n,
+                n,
+                x,
+                x,
+                x,
+                details::PairCallbackArchetype<typename S::rep>{}
+            );
+        };
+
+    /**
+     * @brief checks if S is a chunked pair source
+     *
+     * @tparam S
+     */
+    template <typename S>
+    static constexpr bool is_chunked_pair_source_v = ChunkedPairSourceType<S>;
+
+    /**
+     * @brief concept for force providers of the integrators
+     *
+     * @details A force provider is called as `f(x, y, z, fx, fy, fz)` with
+     * the current positions, overwrites the forces and returns the
+     * potential energy, e.g. PairForceProvider.
+     *
+     * @tparam F
+     * @tparam Rep
+     */
+    template <typename F, typename Rep>
+    concept ForceProviderType =
+        requires(F f, std::span<const Rep> x, std::span<Rep> out) {
+            { f(x, x, x, out, out, out) } -> std::convertible_to<Rep>;
+        };
+
+    /**
+     * @brief checks if F is a force provider for Rep
+     *
+     * @tparam F
+     * @tparam Rep
+     */
+    template <typename F, typename Rep>
+    static constexpr bool is_force_provider_v = ForceProviderType<F, Rep>;
+
+    /**
+     * @brief concept for frame codecs of the trajectory files
+     *
+     * @details A codec appends the encoded coordinates of one frame to a
+     * byte buffer with `encode(x, y, z, out)` and restores them with
+     * `decode(in, x, y, z)`. Frames are encoded and decoded in file order,
+     * so a codec may keep state between frames. `C::id` is stored in the
+     * file header, `C::maxPayloadBytes(n)` bounds the payload of a frame
+     * with n particles so readers can reject corrupt sizes.
+     *
+     * @tparam C
+     * @tparam Rep
+     */
+    template <typename C, typename Rep>
+    concept TrajectoryCodecType = requires(
+        C                          c,
+        std::span<const Rep>       in,
+        std::span<Rep>             out,
+        std::vector<std::byte>&    bytes,
+        std::span<const std::byte> payload,
+        size_t                     nParticles
+    ) {
+        { C::id } -> std::convertible_to<std::uint32_t>;
+        { C::maxPayloadBytes(nParticles) } -> std::convertible_to<size_t>;
+        c.encode(in, in, in, bytes);
+        c.decode(payload, out, out, out);
+    };
+
+    /**
+     * @brief checks if C is a trajectory codec for Rep
+     *
+     * @tparam C
+     * @tparam Rep
+     */
+    template <typename C, typename Rep>
+    static constexpr bool is_trajectory_codec_v = TrajectoryCodecType<C, Rep>;
+
+}   // namespace mstd
+
+#endif   // __MSTD__TYPE_TRAITS__PHYSICS_TRAITS_HPP__
@@ -0,0 +1,66 @@
+/*****************************************************************************
+<GPL_HEADER>
+
+    mstd library
+    Copyright (C) 2025-now  Jakob Gamper
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+<GPL_HEADER>
+******************************************************************************/
+
+#ifndef __MSTD__TYPE_TRAITS__RANDOM_TRAITS_HPP__
+#define __MSTD__TYPE_TRAITS__RANDOM_TRAITS_HPP__
+
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+
+namespace mstd
+{
+    /**
+     * @brief concept for counter-based random number generators
+     *
+     * @details A counter-based generator is a keyed, stateless function of
+     * a counter. `bits<T>(index, stream)` returns `words_per_call` random
+     * 64 bit words for the given index and stream, lane-generically for
+     * `std::uint64_t` and vectors of it, e.g. Philox4x32, Philox4x64 and
+     * Threefry4x64.
+     *
+     * @tparam G
+     */
+    template <typename G>
+    concept CounterBasedGeneratorType =
+        std::constructible_from<G, std::uint64_t> &&
+        requires(const G g, std::uint64_t n, typename G::counter_type c) {
+            { G::words_per_call } -> std::convertible_to<size_t>;
+            { g(c) } -> std::same_as<typename G::counter_type>;
+            {
+                g.template bits<std::uint64_t>(n, n)
+            } -> std::same_as<std::array<std::uint64_t, G::words_per_call>>;
+        };
+
+    /**
+     * @brief checks if G is a counter-based random number generator
+     *
+     * @tparam G
+     */
+    template <typename G>
+    static constexpr bool is_counter_based_generator_v =
+        CounterBasedGeneratorType<G>;
+
+}   // namespace mstd
+
+#endif   // __MSTD__TYPE_TRAITS__RANDOM_TRAITS_HPP__
@@ -0,0 +1,90 @@
+/*****************************************************************************
+<GPL_HEADER>
+
+    mstd library
+    Copyright (C) 2025-now  Jakob Gamper
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+<GPL_HEADER>
+******************************************************************************/
+
+#ifndef __MSTD__TYPE_TRAITS__SIMD_TRAITS_HPP__
+#define __MSTD__TYPE_TRAITS__SIMD_TRAITS_HPP__
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+namespace mstd
+{
+    /**
+     * @brief concept for GNU vector extension types
+     *
+     * @details Vector types are neither arithmetic nor class types but can be
+     * subscripted lane by lane, which is what this concept checks for.
+     *
+     * @tparam T
+     */
+    template <typename T>
+    concept SimdVecType =
+        !std::is_arithmetic_v<T> && !std::is_class_v<T> &&
+        !std::is_pointer_v<T> && !std::is_array_v<T> &&
+        requires(T v) {
+            { v[0] };
+        };
+
+    /**
+     * @brief checks if T is a GNU vector extension type
+     *
+     * @tparam T
+     */
+    template <typename T>
+    static constexpr bool is_simd_vec_v = SimdVecType<T>;
+
+    namespace details
+    {
+        template <typename T>
+        struct simd_scalar
+        {
+            using type = T;
+        };
+
+        template <SimdVecType T>
+        struct simd_scalar<T>
+        {
+            using type = std::remove_cvref_t<decltype(std::declval<T>()[0])>;
+        };
+
+    }   // namespace details
+
+    /**
+     * @brief lane type of a vector type, or T itself for scalars
+     *
+     * @tparam T
+     */
+    template <typename T>
+    using simd_scalar_t = typename details::simd_scalar<T>::type;
+
+    /**
+     * @brief number of lanes of a vector type, 1 for scalars
+     *
+     * @tparam T
+     */
+    template <typename T>
+    static constexpr size_t simd_size_v = sizeof(T) / sizeof(simd_scalar_t<T>);
+
+}   // namespace mstd
+
+#endif   // __MSTD__TYPE_TRAITS__SIMD_TRAITS_HPP__
@@ -0,0 +1,184 @@
+/*****************************************************************************
+<GPL_HEADER>
+
+    mstd library
+    Copyright (C) 2025-now  Jakob Gamper
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+<GPL_HEADER>
+******************************************************************************/
+
+#include <array>
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <cmath>
+#include <complex>
+#include <cstddef>
+#include <numbers>
+#include <random>
+#include <vector>
+
+#include "mstd/math/fft.hpp"
+
+namespace
+{
+    using Complex = std::complex<double>;
+
+    constexpr double twoPi = 2 * std::numbers::pi;
+
+    /// naive DFT coefficient k of x
+    Complex naiveDft(const std::vector<Complex>& x, const size_t k)
+    {
+        const auto n = x.size();
+
+        Complex sum{};
+        for (size_t j = 0; j < n; ++j)
+        {
+            const double angle = -twoPi * static_cast<double>(j * k % n) /
+                                 static_cast<double>(n);
+            sum += x[j] * std::polar(1.0, angle);
+        }
+
+        return sum;
+    }
+
+}   // namespace
+
+TEST_CASE("Fft matches the naive DFT for mixed radix sizes", "[math][fft]")
+{
+    std::mt19937_64                  engine(5);
+    std::normal_distribution<double> normal;
+
+    const std::vector<size_t> sizes{
+        1, 2, 3, 4, 5, 8, 12, 17, 30, 49, 64, 97, 100
+    };
+
+    for (const size_t n : sizes)
+    {
+        std::vector<Complex> x(n);
+        for (auto& value : x)
+            value = {normal(engine), normal(engine)};
+
+        const mstd::Fft<> fft(n);
+        REQUIRE(fft.size() == n);
+
+        auto data = x;
+        fft.forward(data);
+
+        for (size_t k = 0; k < n; ++k)
+            REQUIRE(std::abs(data[k] - naiveDft(x, k)) < 1e-12);
+
+        fft.backward(data);
+
+        for (size_t k = 0; k < n; ++k)
+            REQUIRE(
+                std::abs(data[k] / static_cast<double>(n) - x[k]) < 1e-14
+            );
+    }
+}
+
+TEST_CASE("RealFft3d transforms real grids", "[math][fft]")
+{
+    std::mt19937_64                  engine(7);
+    std::normal_distribution<double> normal;
+
+    using Shape = std::array<size_t, 3>;
+
+    for (const auto& [nx, ny, nz] :
+         {Shape{4, 6, 8}, Shape{3, 5, 7}, Shape{5, 4, 6}})
+    {
+        const mstd::RealFft3d<> fft(nx, ny, nz);
+
+        REQUIRE(fft.realSize() == nx * ny * nz);
+        REQUIRE(fft.complexSize() == nx * ny * (nz / 2 + 1));
+
+        std::vector<double> grid(fft.realSize());
+        for (auto& value : grid)
+            value = normal(engine);
+
+        std::vector<Complex> spectrum(fft.complexSize());
+        fft.forward(grid, spectrum, 2);
+
+        for (size_t a = 0; a < nx; ++a)
+            for (size_t b = 0; b < ny; ++b)
+                for (size_t c = 0; c < fft.nzComplex(); ++c)
+                {
+                    Complex sum{};
+                    for (size_t i = 0; i < nx; ++i)
+                        for (size_t j = 0; j < ny; ++j)
+                            for (size_t k = 0; k < nz; ++k)
+                            {
+                                const double phase =
+                                    static_cast<double>(a * i % nx) /
+                                        static_cast<double>(nx) +
+                                    static_cast<double>(b * j % ny) /
+                                        static_cast<double>(ny) +
+                                    static_cast<double>(c * k % nz) /
+                                        static_cast<double>(nz);
+
+                                sum += grid[(i * ny + j) * nz + k] *
+                                       std::polar(1.0, -twoPi * phase);
+                            }
+
+                    const auto index = (a * ny + b) * fft.nzComplex() + c;
+                    REQUIRE(std::abs(spectrum[index] - sum) < 1e-12);
+                }
+
+        std::vector<double> back(fft.realSize());
+        fft.backward(spectrum, back, 3);
+
+        const auto scale = static_cast<double>(fft.realSize());
+        for (size_t i = 0; i < grid.size(); ++i)
+            REQUIRE(back[i] / scale == Catch::Approx(grid[i]).margin(1e-14));
+    }
+}
+
+TEST_CASE("zero threads run on the calling thread", "[math][fft]")
+{
+    std::vector<size_t> visits(10);
+
+    mstd::parallelFor(
+        0,
+        visits.size(),
+        [&](const size_t begin, const size_t end, const size_t thread)
+        {
+            REQUIRE(thread == 0);
+            for (size_t i = begin; i < end; ++i)
+                ++visits[i];
+        }
+    );
+
+    REQUIRE(visits == std::vector<size_t>(10, 1));
+
+    const mstd::RealFft3d<> fft(4, 3, 6);
+
+    std::vector<double> grid(fft.realSize());
+    for (size_t i = 0; i < grid.size(); ++i)
+        grid[i] = std::sin(static_cast<double>(i));
+
+    std::vector<Complex> serial(fft.complexSize());
+    std::vector<Complex> zero(fft.complexSize());
+    fft.forward(grid, serial, 1);
+    fft.forward(grid, zero, 0);
+
+    REQUIRE(zero == serial);
+
+    std::vector<double> back(fft.realSize());
+    fft.backward(zero, back, 0);
+
+    const auto scale = static_cast<double>(fft.realSize());
+    for (size_t i = 0; i < grid.size(); ++i)
+        REQUIRE(back[i] / scale == Catch::Approx(grid[i]).margin(1e-14));
+}
@@ -0,0 +1,45 @@
+/*****************************************************************************
+<GPL_HEADER>
+
+    mstd library
+    Copyright (C) 2025-now  Jakob Gamper
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+<GPL_HEADER>
+******************************************************************************/
+
+#include <catch2/catch_test_macros.hpp>
+#include <cstdint>
+
+#include "mstd/memory.hpp"
+
+TEST_CASE("AlignedVector storage is cache-line aligned", "[memory]")
+{
+    mstd::AlignedVector<double>    values(3, 1.5);
+    mstd::AlignedVector<float, 32> floats(17);
+
+    const auto address = reinterpret_cast<std::uintptr_t>(values.data());
+    REQUIRE(address % mstd::cache_line_bytes == 0);
+    REQUIRE(reinterpret_cast<std::uintptr_t>(floats.data()) % 32 == 0);
+
+    values.resize(1000, 2.0);
+    REQUIRE(reinterpret_cast<std::uintptr_t>(values.data()) % 64 == 0);
+    REQUIRE(values[2] == 1.5);
+    REQUIRE(values[999] == 2.0);
+
+    STATIC_REQUIRE(
+        mstd::AlignedAllocator<double>{} == mstd::AlignedAllocator<int>{}
+    );
+}
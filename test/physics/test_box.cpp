@@ -0,0 +1,261 @@
+/*****************************************************************************
+<GPL_HEADER>
+
+    mstd library
+    Copyright (C) 2025-now  Jakob Gamper
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+<GPL_HEADER>
+******************************************************************************/
+
+#include <algorithm>
+#include <array>
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <cmath>
+#include <limits>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+#include "mstd/physics/box.hpp"
+#include "mstd/simd.hpp"
+
+namespace
+{
+    using Catch::Approx;
+
+    /// shortest image of (dx, dy, dz) by scanning the 27 nearest shifts
+    std::array<double, 3> bruteForceImage(
+        const mstd::TriclinicBox<double>& box,
+        const double                      dx,
+        const double                      dy,
+        const double                      dz
+    )
+    {
+        const auto [lx, ly, lz]   = box.lengths();
+        const auto [xy, xz, yz]   = box.tilts();
+        std::array<double, 3> best{};
+        double                bestR2 = std::numeric_limits<double>::max();
+
+        for (int a = -2; a <= 2; ++a)
+            for (int b = -2; b <= 2; ++b)
+                for (int c = -2; c <= 2; ++c)
+                {
+                    const auto na = static_cast<double>(a);
+                    const auto nb = static_cast<double>(b);
+                    const auto nc = static_cast<double>(c);
+
+                    const std::array<double, 3> image{
+                        dx + na * lx + nb * xy + nc * xz,
+                        dy + nb * ly + nc * yz,
+                        dz + nc * lz
+                    };
+                    const auto r2 = image[0] * image[0] +
+                                    image[1] * image[1] +
+                                    image[2] * image[2];
+
+                    if (r2 < bestR2)
+                    {
+                        bestR2 = r2;
+                        best   = image;
+                    }
+                }
+
+        return best;
+    }
+
+}   // namespace
+
+TEST_CASE("OrthorhombicBox minimum image and wrapping", "[box]")
+{
+    const mstd::OrthorhombicBox<> box(10.0, 12.0, 8.0);
+
+    REQUIRE(box.volume() == Approx(960.0));
+    REQUIRE(box.perpendicularWidths() == box.lengths());
+
+    const auto [dx, dy, dz] = box.minimumImage(6.0, -7.0, 3.0);
+    REQUIRE(dx == Approx(-4.0));
+    REQUIRE(dy == Approx(5.0));
+    REQUIRE(dz == Approx(3.0));
+
+    const auto [x, y, z] = box.wrap(-1.0, 25.0, 8.0);
+    REQUIRE(x == Approx(9.0));
+    REQUIRE(y == Approx(1.0));
+    REQUIRE(z == Approx(0.0).margin(1e-12));
+
+    const auto [sx, sy, sz] = box.fractional(-2.5, 6.0, 17.0);
+    REQUIRE(sx == Approx(0.75));
+    REQUIRE(sy == Approx(0.5));
+    REQUIRE(sz == Approx(0.125));
+
+    REQUIRE_THROWS_AS(
+        mstd::OrthorhombicBox<>(10.0, 0.0, 10.0),
+        std::invalid_argument
+    );
+}
+
+TEST_CASE("TriclinicBox minimum image matches the shortest image", "[box]")
+{
+    const mstd::TriclinicBox<> box(10.0, 9.0, 11.0, 3.5, -4.0, 2.0);
+
+    const auto widths   = box.perpendicularWidths();
+    const auto maxRange = std::ranges::min(widths) / 2;
+
+    REQUIRE(box.volume() == Approx(990.0));
+    REQUIRE(widths[2] == Approx(11.0));
+    REQUIRE(widths[0] < 10.0);
+    REQUIRE(widths[1] < 9.0);
+
+    std::mt19937_64                        engine(3);
+    std::uniform_real_distribution<double> coord(-15.0, 15.0);
+
+    size_t checked = 0;
+
+    for (size_t n = 0; n < 20000; ++n)
+    {
+        const auto dx = coord(engine);
+        const auto dy = coord(engine);
+        const auto dz = coord(engine);
+
+        const auto expected     = bruteForceImage(box, dx, dy, dz);
+        const auto [mx, my, mz] = box.minimumImage(dx, dy, dz);
+
+        // the result is always a lattice translate of the input
+        const auto [sx, sy, sz] = box.fractional(mx - dx, my - dy, mz - dz);
+        REQUIRE(std::min(sx, 1 - sx) == Approx(0.0).margin(1e-9));
+        REQUIRE(std::min(sy, 1 - sy) == Approx(0.0).margin(1e-9));
+        REQUIRE(std::min(sz, 1 - sz) == Approx(0.0).margin(1e-9));
+
+        const auto r2 = expected[0] * expected[0] +
+                        expected[1] * expected[1] + expected[2] * expected[2];
+
+        // shortest within the range cutoff based searches rely on
+        if (r2 < maxRange * maxRange)
+        {
+            ++checked;
+            REQUIRE(mx == Approx(expected[0]).margin(1e-9));
+            REQUIRE(my == Approx(expected[1]).margin(1e-9));
+            REQUIRE(mz == Approx(expected[2]).margin(1e-9));
+        }
+    }
+
+    REQUIRE(checked > 1000);
+}
+
+TEST_CASE("TriclinicBox wraps positions into the primary cell", "[box]")
+{
+    const mstd::TriclinicBox<> box(10.0, 9.0, 11.0, 3.5, -4.0, 2.0);
+
+    std::mt19937_64                        engine(5);
+    std::uniform_real_distribution<double> coord(-30.0, 30.0);
+
+    for (size_t n = 0; n < 1000; ++n)
+    {
+        const auto x = coord(engine);
+        const auto y = coord(engine);
+        const auto z = coord(engine);
+
+        const auto [wx, wy, wz] = box.wrap(x, y, z);
+        const auto [sx, sy, sz] = box.fractional(x, y, z);
+
+        // inside the cell: the fractional coordinates are unchanged
+        const auto [tx, ty, tz] = box.fractional(wx, wy, wz);
+        REQUIRE(tx == Approx(sx).margin(1e-9));
+        REQUIRE(ty == Approx(sy).margin(1e-9));
+        REQUIRE(tz == Approx(sz).margin(1e-9));
+
+        REQUIRE(wz >= 0.0);
+        REQUIRE(wz < 11.0);
+    }
+
+    REQUIRE_THROWS_AS(
+        mstd::TriclinicBox<>(10.0, 9.0, 11.0, 5.5, 0.0, 0.0),
+        std::invalid_argument
+    );
+    REQUIRE_THROWS_AS(
+        mstd::TriclinicBox<>(10.0, 9.0, 11.0, 0.0, 0.0, -4.6),
+        std::invalid_argument
+    );
+    REQUIRE_THROWS_AS(
+        mstd::TriclinicBox<>(10.0, -9.0, 11.0, 0.0, 0.0, 0.0),
+        std::invalid_argument
+    );
+}
+
+TEST_CASE("Box batch and SIMD paths match the scalar path", "[box]")
+{
+    using V = mstd::SimdVec<double>;
+
+    const mstd::OrthorhombicBox<> ortho(10.0, 12.0, 8.0);
+    const mstd::TriclinicBox<>    tri(10.0, 9.0, 11.0, 3.5, -4.0, 2.0);
+
+    std::mt19937_64                        engine(11);
+    std::uniform_real_distribution<double> coord(-20.0, 20.0);
+
+    // not a multiple of any vector width to cover the scalar tail
+    constexpr size_t    n = 37;
+    std::vector<double> x(n);
+    std::vector<double> y(n);
+    std::vector<double> z(n);
+    for (size_t i = 0; i < n; ++i)
+    {
+        x[i] = coord(engine);
+        y[i] = coord(engine);
+        z[i] = coord(engine);
+    }
+
+    const auto check = [&](const auto& box)
+    {
+        auto mx = x;
+        auto my = y;
+        auto mz = z;
+        box.minimumImageBatch(mx, my, mz);
+
+        auto wx = x;
+        auto wy = y;
+        auto wz = z;
+        box.wrapBatch(wx, wy, wz);
+
+        for (size_t i = 0; i < n; ++i)
+        {
+            const auto image = box.minimumImage(x[i], y[i], z[i]);
+            REQUIRE(mx[i] == Approx(image[0]));
+            REQUIRE(my[i] == Approx(image[1]));
+            REQUIRE(mz[i] == Approx(image[2]));
+
+            const auto wrapped = box.wrap(x[i], y[i], z[i]);
+            REQUIRE(wx[i] == Approx(wrapped[0]));
+            REQUIRE(wy[i] == Approx(wrapped[1]));
+            REQUIRE(wz[i] == Approx(wrapped[2]));
+        }
+
+        const auto lanes = box.template minimumImage<V>(
+            mstd::simdLoad<V>(x.data()),
+            mstd::simdLoad<V>(y.data()),
+            mstd::simdLoad<V>(z.data())
+        );
+
+        for (size_t l = 0; l < mstd::simd_size_v<V>; ++l)
+            REQUIRE(lanes[0][l] == Approx(mx[l]));
+    };
+
+    check(ortho);
+    check(tri);
+
+    STATIC_REQUIRE(mstd::is_box_v<mstd::OrthorhombicBox<double>>);
+    STATIC_REQUIRE(mstd::is_box_v<mstd::TriclinicBox<float>>);
+    STATIC_REQUIRE_FALSE(mstd::is_box_v<std::array<double, 3>>);
+}
@@ -0,0 +1,210 @@
+/*****************************************************************************
+<GPL_HEADER>
+
+    mstd library
+    Copyright (C) 2025-now  Jakob Gamper
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+<GPL_HEADER>
+******************************************************************************/
+
+#include <array>
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <cmath>
+#include <random>
+#include <set>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "mstd/physics/box.hpp"
+#include "mstd/physics/cell_list.hpp"
+#include "test_utils.hpp"
+
+namespace
+{
+    using test::bruteForcePairs;
+    using test::Particles;
+    using test::randomParticles;
+
+    void requireSamePairs(
+        const std::array<double, 3>& box,
+        const double                 cutoff,
+        const size_t                 nParticles
+    )
+    {
+        const auto particles = randomParticles(nParticles, box, 7);
+
+        mstd::CellList<> cellList(box, cutoff);
+        cellList.build(particles.x, particles.y, particles.z);
+
+        std::set<std::pair<size_t, size_t>> found;
+        size_t                              visits = 0;
+
+        cellList.forEachPair(
+            particles.x,
+            particles.y,
+            particles.z,
+            [&](size_t i,
+                size_t j,
+                double dx,
+                double dy,
+                double dz,
+                double r2)
+            {
+                ++visits;
+                found.emplace(std::min(i, j), std::max(i, j));
+
+                REQUIRE(r2 == Catch::Approx(dx * dx + dy * dy + dz * dz));
+                REQUIRE(std::abs(dx) <= box[0] / 2);
+                REQUIRE(std::abs(dy) <= box[1] / 2);
+                REQUIRE(std::abs(dz) <= box[2] / 2);
+            }
+        );
+
+        // every pair exactly once
+        REQUIRE(visits == found.size());
+        REQUIRE(found == bruteForcePairs(particles, box, cutoff));
+    }
+
+}   // namespace
+
+TEST_CASE("CellList finds exactly the pairs within the cutoff", "[cell_list]")
+{
+    requireSamePairs({10.0, 12.0, 9.0}, 2.5, 800);
+}
+
+TEST_CASE(
+    "CellList handles boxes with only two cells per direction",
+    "[cell_list]"
+)
+{
+    requireSamePairs({5.0, 7.4, 11.0}, 2.5, 300);
+
+    const mstd::CellList<> cellList({5.0, 5.0, 5.0}, 2.5);
+    REQUIRE(cellList.nCells() == 8);
+    // with two cells per direction all other cells are neighbours
+    REQUIRE(cellList.neighbourCells(0).size() == 7);
+    REQUIRE(cellList.neighbourCells(7).empty());
+}
+
+TEST_CASE("CellList bins particles with a counting sort", "[cell_list]")
+{
+    mstd::CellList<> cellList({6.0, 6.0, 6.0}, 2.0);
+    REQUIRE(cellList.cellsPerDim() == std::array<size_t, 3>{3, 3, 3});
+
+    // the last two particles lie outside the box and are wrapped
+    const std::vector<double> x{0.5, 5.5, 0.7, -0.5, 6.5};
+    const std::vector<double> y{0.5, 5.5, 0.2, 0.5, 0.5};
+    const std::vector<double> z{0.5, 5.5, 0.1, 0.5, 0.5};
+
+    cellList.build(x, y, z);
+
+    REQUIRE(cellList.cellOf(0) == 0);
+    REQUIRE(cellList.cellOf(1) == 26);
+    REQUIRE(cellList.cellOf(3) == 18);
+    REQUIRE(cellList.cellOf(4) == 0);
+
+    const auto first = cellList.particlesInCell(0);
+    REQUIRE(
+        std::vector<size_t>(first.begin(), first.end()) ==
+        std::vector<size_t>{0, 2, 4}
+    );
+    REQUIRE(cellList.particlesInCell(13).empty());
+
+    REQUIRE_THROWS_AS(
+        mstd::CellList<>({4.0, 6.0, 6.0}, 2.5),
+        std::invalid_argument
+    );
+    REQUIRE_THROWS_AS(
+        mstd::CellList<>({6.0, 6.0, 6.0}, 0.0),
+        std::invalid_argument
+    );
+}
+
+TEST_CASE("CellList supports triclinic boxes", "[cell_list]")
+{
+    const mstd::TriclinicBox<> box(12.0, 10.0, 11.0, 3.0, -2.5, 4.0);
+    const double               cutoff = 2.5;
+
+    // positions inside the tilted cell
+    std::mt19937_64                        engine(13);
+    std::uniform_real_distribution<double> unit(0.0, 1.0);
+
+    Particles particles;
+    for (size_t i = 0; i < 700; ++i)
+    {
+        const auto [x, y, z] = box.wrap(
+            20.0 * unit(engine) - 10.0,
+            20.0 * unit(engine) - 10.0,
+            20.0 * unit(engine) - 10.0
+        );
+        particles.x.push_back(x);
+        particles.y.push_back(y);
+        particles.z.push_back(z);
+    }
+
+    mstd::CellList<double, mstd::TriclinicBox<>> cellList(box, cutoff);
+    cellList.build(particles.x, particles.y, particles.z);
+
+    std::set<std::pair<size_t, size_t>> found;
+    size_t                              visits = 0;
+
+    cellList.forEachPair(
+        particles.x,
+        particles.y,
+        particles.z,
+        [&](size_t i, size_t j, double, double, double, double r2)
+        {
+            ++visits;
+            found.emplace(std::min(i, j), std::max(i, j));
+            REQUIRE(r2 < cutoff * cutoff);
+        }
+    );
+
+    // brute force over the 27 nearest images
+    const auto [lx, ly, lz] = box.lengths();
+    const auto [xy, xz, yz] = box.tilts();
+
+    std::set<std::pair<size_t, size_t>> expected;
+    for (size_t i = 0; i < particles.x.size(); ++i)
+        for (size_t j = i + 1; j < particles.x.size(); ++j)
+            for (int a = -1; a <= 1; ++a)
+                for (int b = -1; b <= 1; ++b)
+                    for (int c = -1; c <= 1; ++c)
+                    {
+                        const auto dx = particles.x[i] - particles.x[j] +
+                                        a * lx + b * xy + c * xz;
+                        const auto dy =
+                            particles.y[i] - particles.y[j] + b * ly + c * yz;
+                        const auto dz =
+                            particles.z[i] - particles.z[j] + c * lz;
+
+                        if (dx * dx + dy * dy + dz * dz < cutoff * cutoff)
+                            expected.emplace(i, j);
+                    }
+
+    REQUIRE(visits == found.size());
+    REQUIRE(found == expected);
+
+    REQUIRE_THROWS_AS(
+        (mstd::CellList<double, mstd::TriclinicBox<>>(
+            mstd::TriclinicBox<>(6.0, 6.0, 6.0, 3.0, 0.0, 0.0),
+            2.9
+        )),
+        std::invalid_argument
+    );
+}
@@ -0,0 +1,281 @@
+/*****************************************************************************
+<GPL_HEADER>
+
+    mstd library
+    Copyright (C) 2025-now  Jakob Gamper
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+<GPL_HEADER>
+******************************************************************************/
+
+#include <algorithm>
+#include <catch2/catch_test_macros.hpp>
+#include <cmath>
+#include <cstddef>
+#include <filesystem>
+#include <limits>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+#include "mstd/physics/io.hpp"
+
+namespace
+{
+    struct Frame
+    {
+        std::vector<double> x, y, z;
+    };
+
+    /**
+     * Liquid-like trajectory in nm: random positions in a 10 nm box sorted
+     * along x, each frame displacing every particle by ~0.02 nm.
+     */
+    std::vector<Frame> diffusingFrames(const size_t nFrames, const size_t n)
+    {
+        std::mt19937_64                        engine(11);
+        std::uniform_real_distribution<double> box(0.0, 10.0);
+        std::normal_distribution<double>       step(0.0, 0.02);
+
+        std::vector<Frame> frames(nFrames);
+
+        auto& first = frames.front();
+        for (auto* coordinate : {&first.x, &first.y, &first.z})
+        {
+            coordinate->resize(n);
+            for (auto& value : *coordinate)
+                value = box(engine);
+        }
+        std::ranges::sort(first.x);
+
+        for (size_t k = 1; k < nFrames; ++k)
+        {
+            frames[k] = frames[k - 1];
+            for (auto* coordinate : {&frames[k].x, &frames[k].y, &frames[k].z})
+                for (auto& value : *coordinate)
+                    value += step(engine);
+        }
+
+        return frames;
+    }
+
+    double maxError(
+        const std::vector<double>& a,
+        const std::vector<double>& b
+    )
+    {
+        double error = 0.0;
+        for (size_t i = 0; i < a.size(); ++i)
+            error = std::max(error, std::abs(a[i] - b[i]));
+
+        return error;
+    }
+
+}   // namespace
+
+TEST_CASE(
+    "CompressedTrajectoryCodec round trips within the precision",
+    "[trajectory]"
+)
+{
+    using Codec = mstd::CompressedTrajectoryCodec<double>;
+
+    // not a multiple of the block size
+    constexpr size_t nParticles = 1000;
+    constexpr size_t nFrames    = 20;
+    constexpr double precision  = 1e-3;
+
+    const auto path = std::filesystem::temp_directory_path() /
+                      "mstd_test_trajectory_compressed.trj";
+    const auto frames = diffusingFrames(nFrames, nParticles);
+
+    {
+        mstd::TrajectoryWriter<double, Codec> writer(
+            path,
+            nParticles,
+            Codec(precision)
+        );
+
+        for (size_t k = 0; k < nFrames; ++k)
+            writer.write(k, frames[k].x, frames[k].y, frames[k].z);
+    }
+
+    const auto raw = mstd::trajectory_format::headerBytes +
+                     nFrames * (mstd::trajectory_format::frameHeaderBytes +
+                                3 * nParticles * sizeof(double));
+
+    // ~7 bits per coordinate for 0.02 nm steps at 1 pm precision
+    REQUIRE(std::filesystem::file_size(path) * 5 < raw);
+
+    // the reader takes the precision from the file
+    mstd::TrajectoryReader<double, Codec> reader(path);
+
+    std::vector<double> x(nParticles), y(nParticles), z(nParticles);
+
+    for (size_t k = 0; k < nFrames; ++k)
+    {
+        REQUIRE(reader.read(x, y, z) == k);
+
+        REQUIRE(maxError(x, frames[k].x) <= 0.5 * precision * (1 + 1e-9));
+        REQUIRE(maxError(y, frames[k].y) <= 0.5 * precision * (1 + 1e-9));
+        REQUIRE(maxError(z, frames[k].z) <= 0.5 * precision * (1 + 1e-9));
+    }
+
+    REQUIRE_FALSE(reader.read(x, y, z).has_value());
+
+    std::filesystem::remove(path);
+}
+
+TEST_CASE("CompressedTrajectoryCodec coded values", "[trajectory]")
+{
+    using Codec = mstd::CompressedTrajectoryCodec<double>;
+
+    SECTION("zigzag mapping")
+    {
+        for (const std::int64_t value : {0L, 1L, -1L, 63L, -64L, 1L << 60})
+            REQUIRE(
+                mstd::details::zigzagDecode(
+                    mstd::details::zigzagEncode(value)
+                ) == value
+            );
+
+        REQUIRE(mstd::details::zigzagEncode(-1) == 1U);
+        REQUIRE(mstd::details::zigzagEncode(1) == 2U);
+    }
+
+    SECTION("extreme deltas and exact multiples")
+    {
+        // jumps across 2e15 quanta need 53 bit wide blocks
+        const std::vector<double> x{-1e15, 1e15, 0.0, -2.5, 2.5};
+        const std::vector<double> y{0.0, 0.0, 0.0, 0.0, 0.0};
+
+        Codec                  encoder(0.5);
+        std::vector<std::byte> payload;
+        encoder.encode(x, y, y, payload);
+
+        Codec               decoder;
+        std::vector<double> rx(5), ry(5), rz(5);
+        decoder.decode(payload, rx, ry, rz);
+
+        REQUIRE(decoder.precision() == 0.5);
+        REQUIRE(rx == x);
+        REQUIRE(ry == y);
+        REQUIRE(rz == y);
+    }
+
+    SECTION("float coordinates")
+    {
+        const std::vector<float> x{0.1F, -7.25F, 3.3333F};
+
+        mstd::CompressedTrajectoryCodec<float> codec(1e-4F);
+        std::vector<std::byte>                 payload;
+        codec.encode(x, x, x, payload);
+
+        mstd::CompressedTrajectoryCodec<float> decoder;
+        std::vector<float>                     rx(3), ry(3), rz(3);
+        decoder.decode(payload, rx, ry, rz);
+
+        for (size_t i = 0; i < x.size(); ++i)
+            REQUIRE(std::abs(rx[i] - x[i]) <= 0.6e-4F);
+    }
+
+    SECTION("static frames cost one header byte per block")
+    {
+        const std::vector<double> x(256, 1.0);
+
+        Codec                  codec;
+        std::vector<std::byte> first, second;
+        codec.encode(x, x, x, first);
+        codec.encode(x, x, x, second);
+
+        REQUIRE(second.size() == sizeof(double) + 3 * 2);
+    }
+
+    SECTION("non-finite and out of range coordinates")
+    {
+        const std::vector<double> good{1.0, 2.0, 3.0};
+        const std::vector<double> nan{
+            1.0,
+            std::numeric_limits<double>::quiet_NaN(),
+            3.0
+        };
+        const std::vector<double> huge{1.0, 1e300, 3.0};
+
+        Codec                  encoder;
+        Codec                  decoder;
+        std::vector<double>    rx(3), ry(3), rz(3);
+        std::vector<std::byte> payload;
+
+        encoder.encode(good, good, good, payload);
+        decoder.decode(payload, rx, ry, rz);
+
+        payload.clear();
+        REQUIRE_THROWS_AS(
+            encoder.encode(good, nan, good, payload),
+            std::invalid_argument
+        );
+        REQUIRE_THROWS_AS(
+            encoder.encode(good, good, huge, payload),
+            std::invalid_argument
+        );
+        REQUIRE(payload.empty());
+
+        // the failed frames are never written, the next one still decodes
+        const std::vector<double> next{1.5, 2.5, 3.5};
+        encoder.encode(next, next, next, payload);
+        decoder.decode(payload, rx, ry, rz);
+        REQUIRE(rx == next);
+
+        const auto path = std::filesystem::temp_directory_path() /
+                          "mstd_test_trajectory_nan.trj";
+        {
+            mstd::TrajectoryWriter<double, Codec> writer(path, 3);
+            writer.write(0, nan, nan, nan);
+            REQUIRE_THROWS_AS(writer.flush(), std::invalid_argument);
+        }
+        std::filesystem::remove(path);
+    }
+
+    SECTION("invalid precision and corrupt payloads")
+    {
+        REQUIRE_THROWS_AS(Codec(0.0), std::invalid_argument);
+        REQUIRE_THROWS_AS(Codec(-1e-3), std::invalid_argument);
+
+        const std::vector<double> x(100, 3.0);
+
+        Codec                  encoder;
+        std::vector<std::byte> payload;
+        encoder.encode(x, x, x, payload);
+        payload.resize(payload.size() - 8);
+
+        Codec               decoder;
+        std::vector<double> rx(100), ry(100), rz(100);
+        REQUIRE_THROWS_AS(
+            decoder.decode(payload, rx, ry, rz),
+            std::runtime_error
+        );
+
+        // a block wider than the encoder can produce, with enough words
+        std::vector<std::byte> wide;
+        Codec{}.encode(x, x, x, wide);
+        wide[sizeof(double)] = std::byte{54};
+        wide.resize(wide.size() + 1024);
+
+        REQUIRE_THROWS_AS(
+            Codec{}.decode(wide, rx, ry, rz),
+            std::runtime_error
+        );
+    }
+}
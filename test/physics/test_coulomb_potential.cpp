@@ -0,0 +1,310 @@
+/*****************************************************************************
+<GPL_HEADER>
+
+    mstd library
+    Copyright (C) 2025-now  Jakob Gamper
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+<GPL_HEADER>
+******************************************************************************/
+
+#include <algorithm>
+#include <array>
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <cmath>
+#include <limits>
+#include <numbers>
+#include <random>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "mstd/physics/all_pairs.hpp"
+#include "mstd/physics/pair_forces.hpp"
+#include "mstd/physics/parallel_pair_forces.hpp"
+#include "mstd/physics/potentials/charged_pair_potential.hpp"
+#include "mstd/physics/potentials/coulomb_potential.hpp"
+#include "mstd/physics/potentials/lie_potential.hpp"
+#include "mstd/physics/potentials/species_pair_table.hpp"
+#include "mstd/physics/potentials/static_lie_potential.hpp"
+#include "mstd/physics/verlet_list.hpp"
+#include "test_utils.hpp"
+
+namespace
+{
+    using Catch::Approx;
+
+    constexpr double coeff  = 2.0;
+    constexpr double alpha  = 0.3;
+    constexpr double cutoff = 2.5;
+
+    template <typename P>
+    void requireConsistent(const P& potential)
+    {
+        test::requireConsistentPotential(potential, 0.7, 0.4);
+    }
+
+}   // namespace
+
+TEST_CASE(
+    "Coulomb potentials follow the pair potential conventions",
+    "[coulomb]"
+)
+{
+    const mstd::CoulombPotential<> bare(coeff);
+
+    REQUIRE(bare.evalEnergy(0.5) == Approx(coeff / 0.5));
+    REQUIRE(bare.evalForce(0.5) == Approx(-coeff / 0.25));
+
+    requireConsistent(bare);
+    requireConsistent(mstd::CoulombShiftedPotential<>(coeff, cutoff));
+    requireConsistent(
+        mstd::CoulombReactionFieldPotential<>(coeff, cutoff, 78.0)
+    );
+    requireConsistent(mstd::CoulombDSFPotential<>(coeff, alpha, cutoff));
+    requireConsistent(mstd::CoulombWolfPotential<>(coeff, alpha, cutoff));
+}
+
+TEST_CASE("cutoff based Coulomb potentials vanish at the cutoff", "[coulomb]")
+{
+    constexpr auto conducting = std::numeric_limits<double>::infinity();
+
+    const mstd::CoulombShiftedPotential<>       shifted(coeff, cutoff);
+    const mstd::CoulombReactionFieldPotential<> reactionField(
+        coeff,
+        cutoff,
+        conducting
+    );
+    const mstd::CoulombDSFPotential<>  dsf(coeff, alpha, cutoff);
+    const mstd::CoulombWolfPotential<> wolf(coeff, alpha, cutoff);
+
+    REQUIRE(shifted.evalEnergy(cutoff) == Approx(0.0).margin(1e-14));
+    REQUIRE(shifted.evalForce(cutoff) == Approx(0.0).margin(1e-14));
+    REQUIRE(reactionField.evalEnergy(cutoff) == Approx(0.0).margin(1e-14));
+    REQUIRE(reactionField.evalForce(cutoff) == Approx(0.0).margin(1e-14));
+    REQUIRE(dsf.evalEnergy(cutoff) == Approx(0.0).margin(1e-14));
+    REQUIRE(dsf.evalForce(cutoff) == Approx(0.0).margin(1e-14));
+    REQUIRE(wolf.evalEnergy(cutoff) == Approx(0.0).margin(1e-14));
+
+    REQUIRE(reactionField.reactionFieldConstant() ==
+            Approx(0.5 / (cutoff * cutoff * cutoff)));
+
+    // DSF against the closed form with std::erfc
+    const double erfcCutoff = std::erfc(alpha * cutoff);
+    const double gaussCutoff =
+        2 * alpha * std::numbers::inv_sqrtpi *
+        std::exp(-alpha * alpha * cutoff * cutoff) / cutoff;
+    const double forceShift = erfcCutoff / (cutoff * cutoff) + gaussCutoff;
+
+    for (const double r : {0.3, 0.9, 1.7, 2.4})
+    {
+        const double energy = coeff * (std::erfc(alpha * r) / r -
+                                       erfcCutoff / cutoff +
+                                       forceShift * (r - cutoff));
+        const double force =
+            coeff * (-std::erfc(alpha * r) / (r * r) -
+                     2 * alpha * std::numbers::inv_sqrtpi *
+                         std::exp(-alpha * alpha * r * r) / r +
+                     forceShift);
+
+        REQUIRE(dsf.evalEnergy(r) == Approx(energy).margin(1e-12));
+        REQUIRE(dsf.evalForce(r) == Approx(force).margin(1e-12));
+
+        // the undamped limit is the shifted-force potential
+        const mstd::CoulombDSFPotential<> undamped(coeff, 0.0, cutoff);
+        REQUIRE(undamped.evalEnergy(r) == Approx(shifted.evalEnergy(r)));
+        REQUIRE(undamped.evalForce(r) == Approx(shifted.evalForce(r)));
+    }
+
+    const std::vector<double> charges{1.0, -1.0, 0.5};
+
+    REQUIRE(dsf.selfEnergy(charges) ==
+            Approx(-coeff *
+                   (erfcCutoff / (2 * cutoff) +
+                    alpha * std::numbers::inv_sqrtpi) *
+                   2.25));
+    REQUIRE(shifted.selfEnergy(charges) ==
+            Approx(-coeff * 2.25 / (2 * cutoff)));
+    REQUIRE(reactionField.selfEnergy(charges) ==
+            Approx(-coeff * reactionField.energyShift() * 2.25 / 2));
+
+    REQUIRE_THROWS_AS(
+        mstd::CoulombShiftedPotential<>(coeff, 0.0),
+        std::invalid_argument
+    );
+    REQUIRE_THROWS_AS(
+        mstd::CoulombReactionFieldPotential<>(coeff, cutoff, 0.5),
+        std::invalid_argument
+    );
+    REQUIRE_THROWS_AS(
+        mstd::CoulombDSFPotential<>(coeff, -alpha, cutoff),
+        std::invalid_argument
+    );
+}
+
+TEST_CASE("ChargedPairPotential fuses Coulomb with short-range", "[coulomb]")
+{
+    using mstd::PairKernelPath;
+
+    constexpr size_t perSide = 7;
+    constexpr double spacing = 1.1;
+    constexpr double length  = perSide * spacing;
+
+    const std::array<double, 3> box{length, length, length};
+
+    std::mt19937_64                        engine(11);
+    std::uniform_real_distribution<double> jitter(-0.1, 0.1);
+
+    std::vector<double> x, y, z, charges;
+    std::vector<size_t> species;
+    for (size_t ix = 0; ix < perSide; ++ix)
+        for (size_t iy = 0; iy < perSide; ++iy)
+            for (size_t iz = 0; iz < perSide; ++iz)
+            {
+                x.push_back(spacing * static_cast<double>(ix) + jitter(engine));
+                y.push_back(spacing * static_cast<double>(iy) + jitter(engine));
+                z.push_back(spacing * static_cast<double>(iz) + jitter(engine));
+                charges.push_back((ix + iy + iz) % 2 == 0 ? 0.8 : -0.8);
+                species.push_back(0);
+            }
+
+    const auto n = x.size();
+
+    const mstd::CoulombDSFPotential<>    coulomb(coeff, alpha, cutoff);
+    const mstd::StaticLJShiftedPotential<> lj(1.0, 1.0, cutoff);
+
+    const mstd::ChargedPairPotential fused(coulomb, charges, lj);
+
+    STATIC_REQUIRE(mstd::is_indexed_pair_potential_v<decltype(fused)>);
+
+    std::vector<double> refX(n), refY(n), refZ(n);
+    double              refEnergy = 0.0;
+
+    // brute force reference with the short-range part given as the
+    // energy/force pair of the distance
+    const auto computeReference = [&](const auto& shortRange)
+    {
+        std::ranges::fill(refX, 0.0);
+        std::ranges::fill(refY, 0.0);
+        std::ranges::fill(refZ, 0.0);
+        refEnergy = 0.0;
+
+        for (size_t i = 0; i < n; ++i)
+            for (size_t j = i + 1; j < n; ++j)
+            {
+                auto dx = x[i] - x[j];
+                auto dy = y[i] - y[j];
+                auto dz = z[i] - z[j];
+                dx     -= length * std::nearbyint(dx / length);
+                dy     -= length * std::nearbyint(dy / length);
+                dz     -= length * std::nearbyint(dz / length);
+
+                const auto r = std::sqrt(dx * dx + dy * dy + dz * dz);
+                if (r >= cutoff)
+                    continue;
+
+                const auto qq              = charges[i] * charges[j];
+                const auto [eShort, fShort] = shortRange(r);
+                const auto f = qq * coulomb.evalForce(r) + fShort;
+
+                refEnergy += qq * coulomb.evalEnergy(r) + eShort;
+                refX[i]   -= f * dx / r;
+                refY[i]   -= f * dy / r;
+                refZ[i]   -= f * dz / r;
+                refX[j]   += f * dx / r;
+                refY[j]   += f * dy / r;
+                refZ[j]   += f * dz / r;
+            }
+    };
+
+    computeReference([&lj](const double r) { return lj.eval(r); });
+
+    std::vector<double> fx(n), fy(n), fz(n);
+
+    const auto requireReference = [&](const double energy)
+    {
+        REQUIRE(energy == Approx(refEnergy).epsilon(1e-10));
+        for (size_t i = 0; i < n; ++i)
+        {
+            REQUIRE(fx[i] == Approx(refX[i]).margin(1e-9));
+            REQUIRE(fy[i] == Approx(refY[i]).margin(1e-9));
+            REQUIRE(fz[i] == Approx(refZ[i]).margin(1e-9));
+        }
+    };
+
+    const mstd::AllPairs<> allPairs(box, cutoff);
+    mstd::VerletList<>     verletList(box, cutoff, 0.3);
+    verletList.update(x, y, z);
+
+    requireReference(mstd::computePairForces<PairKernelPath::Scalar>(
+        allPairs,
+        fused,
+        x,
+        y,
+        z,
+        fx,
+        fy,
+        fz
+    ));
+    requireReference(
+        mstd::computePairForces(verletList, fused, x, y, z, fx, fy, fz)
+    );
+
+    mstd::ParallelPairForces<> parallel(3);
+    requireReference(parallel.compute(verletList, fused, x, y, z, fx, fy, fz));
+
+    // short-range parts without lane-generic evaluation take a second batch
+    const mstd::LJSpeciesPairTable<> table(
+        std::vector<double>{1.0},
+        std::vector<double>{0.25},
+        cutoff
+    );
+    const mstd::ChargedPairPotential indexed(
+        coulomb,
+        charges,
+        mstd::SpeciesPairPotential(table, species)
+    );
+    const mstd::StaticLJPotential<> truncated(
+        table.coeff1(0, 0),
+        table.coeff2(0, 0)
+    );
+
+    computeReference(
+        [&truncated](const double r)
+        {
+            const auto [e, f] = truncated.eval(r);
+            return std::pair{e - truncated.evalEnergy(cutoff), f};
+        }
+    );
+    requireReference(
+        mstd::computePairForces(verletList, indexed, x, y, z, fx, fy, fz)
+    );
+
+    const mstd::LJShiftedPotential<double> virtualLJ(1.0, 1.0, cutoff);
+    const mstd::ChargedPairPotential       batched(coulomb, charges, virtualLJ);
+
+    computeReference([&lj](const double r) { return lj.eval(r); });
+    requireReference(
+        mstd::computePairForces(verletList, batched, x, y, z, fx, fy, fz)
+    );
+
+    // without short-range part only the charges interact
+    const mstd::ChargedPairPotential pure(coulomb, charges);
+    const auto [e, fOverR] = pure.evalFromR2(0, 1, 1.21);
+    REQUIRE(e == Approx(charges[0] * charges[1] * coulomb.evalEnergy(1.1)));
+    REQUIRE(fOverR ==
+            Approx(charges[0] * charges[1] * coulomb.evalForce(1.1) / 1.1));
+}
@@ -0,0 +1,115 @@
+/*****************************************************************************
+<GPL_HEADER>
+
+    mstd library
+    Copyright (C) 2025-now  Jakob Gamper
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+<GPL_HEADER>
+******************************************************************************/
+
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <cmath>
+#include <stdexcept>
+
+#include "mstd/physics/potentials/exponential_potential.hpp"
+#include "test_utils.hpp"
+
+namespace
+{
+    using Catch::Approx;
+
+    constexpr double cutoff = 3.0;
+
+    /// also checks the batch path
+    template <typename P>
+    void requireConsistent(const P& potential)
+    {
+        test::requireConsistentPotential(potential, 0.8, 0.17, true);
+    }
+
+}   // namespace
+
+TEST_CASE(
+    "exponential potentials follow the pair potential conventions",
+    "[exponential]"
+)
+{
+    requireConsistent(mstd::MorsePotential<>(1.5, 2.0, 1.2));
+    requireConsistent(mstd::BornMayerPotential<>(1000.0, 0.3));
+    requireConsistent(mstd::BuckinghamPotential<>(1000.0, 0.3, 2.0));
+    requireConsistent(mstd::MorseShiftedPotential<>(1.5, 2.0, 1.2, cutoff));
+    requireConsistent(mstd::BornMayerShiftedPotential<>(1000.0, 0.3, cutoff));
+    requireConsistent(
+        mstd::BuckinghamShiftedPotential<>(1000.0, 0.3, 2.0, cutoff)
+    );
+}
+
+TEST_CASE("exponential potentials match their closed forms", "[exponential]")
+{
+    const mstd::MorsePotential<>      morse(1.5, 2.0, 1.2);
+    const mstd::BuckinghamPotential<> buckingham(1000.0, 0.3, 2.0);
+
+    REQUIRE(morse.evalEnergy(1.2) == Approx(-1.5));
+    REQUIRE(morse.evalForce(1.2) == Approx(0.0).margin(1e-15));
+
+    for (const double r : {0.9, 1.4, 2.3, 3.5})
+    {
+        const double decay = std::exp(-2.0 * (r - 1.2));
+
+        REQUIRE(
+            morse.evalEnergy(r) ==
+            Approx(1.5 * ((1 - decay) * (1 - decay) - 1)).epsilon(1e-14)
+        );
+
+        const double repulsion = 1000.0 * std::exp(-r / 0.3);
+
+        REQUIRE(
+            buckingham.evalEnergy(r) ==
+            Approx(repulsion - 2.0 / std::pow(r, 6)).epsilon(1e-14)
+        );
+        REQUIRE(
+            buckingham.evalForce(r) ==
+            Approx(-repulsion / 0.3 + 12.0 / std::pow(r, 7)).epsilon(1e-14)
+        );
+    }
+
+    const mstd::MorseShiftedPotential<> shiftedMorse(1.5, 2.0, 1.2, cutoff);
+    const mstd::BuckinghamShiftedPotential<> shiftedBuckingham(
+        1000.0,
+        0.3,
+        2.0,
+        cutoff
+    );
+
+    REQUIRE(shiftedMorse.evalEnergy(cutoff) == Approx(0.0).margin(1e-15));
+    REQUIRE(shiftedMorse.evalForce(cutoff) == Approx(0.0).margin(1e-15));
+    REQUIRE(shiftedBuckingham.evalEnergy(cutoff) == Approx(0.0).margin(1e-15));
+    REQUIRE(shiftedBuckingham.evalForce(cutoff) == Approx(0.0).margin(1e-15));
+
+    REQUIRE_THROWS_AS(
+        mstd::MorsePotential<>(1.0, 0.0, 1.0),
+        std::invalid_argument
+    );
+    REQUIRE_THROWS_AS(
+        mstd::BuckinghamPotential<>(1.0, -0.3, 1.0),
+        std::invalid_argument
+    );
+    REQUIRE_THROWS_AS(
+        mstd::BornMayerShiftedPotential<>(1.0, 0.3, 0.0),
+        std::invalid_argument
+    );
+}
@@ -0,0 +1,250 @@
+/*****************************************************************************
+<GPL_HEADER>
+
+    mstd library
+    Copyright (C) 2025-now  Jakob Gamper
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+<GPL_HEADER>
+******************************************************************************/
+
+#include <algorithm>
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <cmath>
+#include <cstddef>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+#include "mstd/physics/box.hpp"
+#include "mstd/physics/integrator.hpp"
+#include "mstd/physics/particles.hpp"
+#include "mstd/physics/potentials.hpp"
+#include "mstd/physics/verlet_list.hpp"
+#include "mstd/type_traits/physics_traits.hpp"
+#include "test_utils.hpp"
+
+namespace
+{
+    using Catch::Approx;
+
+    using test::HarmonicTrap;
+
+    /// simple cubic Lennard-Jones crystal with small random velocities
+    mstd::ParticleArrays<double> ljCrystal(
+        const size_t cells,
+        const double spacing
+    )
+    {
+        mstd::ParticleArrays<double> particles(cells * cells * cells);
+
+        std::mt19937_64                  engine(5);
+        std::normal_distribution<double> normal(0.0, 0.5);
+
+        size_t i = 0;
+        for (size_t a = 0; a < cells; ++a)
+            for (size_t b = 0; b < cells; ++b)
+                for (size_t c = 0; c < cells; ++c, ++i)
+                {
+                    particles.x[i]  = spacing * static_cast<double>(a);
+                    particles.y[i]  = spacing * static_cast<double>(b);
+                    particles.z[i]  = spacing * static_cast<double>(c);
+                    particles.vx[i] = normal(engine);
+                    particles.vy[i] = normal(engine);
+                    particles.vz[i] = normal(engine);
+                }
+
+        return particles;
+    }
+
+}   // namespace
+
+TEST_CASE("ParticleArrays validate masses", "[integrator]")
+{
+    REQUIRE_THROWS_AS(
+        mstd::ParticleArrays<double>(4, 0.0),
+        std::invalid_argument
+    );
+
+    mstd::ParticleArrays<double> particles(3, 2.0);
+    REQUIRE(particles.size() == 3);
+    REQUIRE(particles.inverseMasses()[1] == Approx(0.5));
+
+    const std::vector<double> masses{1.0, 2.0, 4.0};
+    particles.setMasses(masses);
+    REQUIRE(particles.inverseMasses()[2] == Approx(0.25));
+
+    const std::vector<double> wrongSize{1.0, 2.0};
+    const std::vector<double> negative{1.0, -2.0, 4.0};
+    REQUIRE_THROWS_AS(particles.setMasses(wrongSize), std::invalid_argument);
+    REQUIRE_THROWS_AS(particles.setMasses(negative), std::invalid_argument);
+
+    particles.vx = {1.0, 0.0, 0.0};
+    particles.vz = {0.0, 0.0, 2.0};
+    REQUIRE(particles.kineticEnergy() == Approx(0.5 + 8.0));
+}
+
+TEST_CASE("integrators require a positive time step", "[integrator]")
+{
+    STATIC_REQUIRE(mstd::is_force_provider_v<HarmonicTrap, double>);
+    STATIC_REQUIRE_FALSE(mstd::is_force_provider_v<int, double>);
+
+    REQUIRE_THROWS_AS(mstd::VelocityVerlet<>(0.0), std::invalid_argument);
+    REQUIRE_THROWS_AS(mstd::Leapfrog<>(-1.0), std::invalid_argument);
+    REQUIRE(mstd::VelocityVerlet<>(0.01).timeStep() == Approx(0.01));
+}
+
+TEST_CASE("VelocityVerlet follows a harmonic oscillator", "[integrator]")
+{
+    // omega = sqrt(k / m) = 2; 11 particles exercise the scalar tail
+    constexpr double k     = 8.0;
+    constexpr double mass  = 2.0;
+    constexpr double omega = 2.0;
+    constexpr double dt    = 1e-3;
+    constexpr size_t steps = 1000;
+
+    const size_t                 n = 11;
+    mstd::ParticleArrays<double> particles(n, mass);
+
+    for (size_t i = 0; i < n; ++i)
+    {
+        particles.x[i] = 0.1 * static_cast<double>(i + 1);
+        particles.y[i] = -0.05 * static_cast<double>(i);
+    }
+
+    const mstd::VelocityVerlet<double> integrator(dt);
+    const HarmonicTrap                 trap{k};
+
+    const double energy0 =
+        integrator.setup(particles, trap) + particles.kineticEnergy();
+
+    double energy = 0.0;
+    for (size_t s = 0; s < steps; ++s)
+        energy = integrator.step(particles, trap);
+
+    energy += particles.kineticEnergy();
+
+    const double t = dt * static_cast<double>(steps);
+
+    for (size_t i = 0; i < n; ++i)
+    {
+        const double x0 = 0.1 * static_cast<double>(i + 1);
+
+        REQUIRE(
+            particles.x[i] == Approx(x0 * std::cos(omega * t)).margin(1e-6)
+        );
+        REQUIRE(
+            particles.vx[i] ==
+            Approx(-x0 * omega * std::sin(omega * t)).margin(1e-6)
+        );
+        REQUIRE(particles.z[i] == 0.0);
+    }
+
+    REQUIRE(energy == Approx(energy0).epsilon(1e-6));
+}
+
+TEST_CASE("Leapfrog and VelocityVerlet produce the same trajectory",
+          "[integrator]")
+{
+    constexpr double dt      = 2e-3;
+    constexpr double cutoff  = 2.5;
+    constexpr double skin    = 0.3;
+    constexpr double spacing = 1.1;
+    constexpr size_t cells   = 6;
+
+    const mstd::OrthorhombicBox<double> box(
+        spacing * cells,
+        spacing * cells,
+        spacing * cells
+    );
+    const mstd::LJShiftedPotential<> potential(4.0, 4.0, cutoff);
+
+    auto verletParticles   = ljCrystal(cells, spacing);
+    auto leapfrogParticles = ljCrystal(cells, spacing);
+
+    mstd::VerletList<> verletList(box, cutoff, skin);
+    mstd::VerletList<> leapfrogList(box, cutoff, skin);
+
+    mstd::PairForceProvider verletForces(verletList, potential);
+    mstd::PairForceProvider leapfrogForces(leapfrogList, potential);
+
+    const mstd::VelocityVerlet<double> verlet(dt);
+    const mstd::Leapfrog<double>       leapfrog(dt);
+
+    verlet.setup(verletParticles, verletForces);
+    leapfrog.setup(leapfrogParticles, leapfrogForces);
+
+    for (size_t s = 0; s < 50; ++s)
+    {
+        verlet.step(verletParticles, verletForces);
+        leapfrog.step(leapfrogParticles, leapfrogForces);
+    }
+
+    for (size_t i = 0; i < verletParticles.size(); ++i)
+    {
+        REQUIRE(
+            leapfrogParticles.x[i] ==
+            Approx(verletParticles.x[i]).margin(1e-9)
+        );
+        REQUIRE(
+            leapfrogParticles.y[i] ==
+            Approx(verletParticles.y[i]).margin(1e-9)
+        );
+        REQUIRE(
+            leapfrogParticles.z[i] ==
+            Approx(verletParticles.z[i]).margin(1e-9)
+        );
+    }
+}
+
+TEST_CASE("VelocityVerlet conserves the energy of a Lennard-Jones crystal",
+          "[integrator]")
+{
+    constexpr double dt      = 2e-3;
+    constexpr double cutoff  = 2.5;
+    constexpr double skin    = 0.3;
+    constexpr double spacing = 1.1;
+    constexpr size_t cells   = 6;
+
+    const mstd::OrthorhombicBox<double> box(
+        spacing * cells,
+        spacing * cells,
+        spacing * cells
+    );
+    const mstd::StaticLJShiftedPotential<> potential(4.0, 4.0, cutoff);
+
+    auto               particles = ljCrystal(cells, spacing);
+    mstd::VerletList<> list(box, cutoff, skin);
+
+    mstd::PairForceProvider forces(list, potential);
+
+    const mstd::VelocityVerlet<double> integrator(dt);
+
+    const double energy0 =
+        integrator.setup(particles, forces) + particles.kineticEnergy();
+
+    double maxDrift = 0.0;
+    for (size_t s = 0; s < 500; ++s)
+    {
+        const double energy =
+            integrator.step(particles, forces) + particles.kineticEnergy();
+
+        maxDrift = std::max(maxDrift, std::abs(energy - energy0));
+    }
+
+    REQUIRE(list.rebuildCount() > 1);
+    REQUIRE(maxDrift < 1e-3 * std::abs(energy0));
+}
@@ -24,6 +24,8 @@
 #include <catch2/catch_approx.hpp>
 #include <catch2/catch_test_macros.hpp>
 #include <cmath>
+#include <stdexcept>
+#include <vector>
 
 #include "mstd/physics/potentials/lie_potential.hpp"
 
@@ -142,4 +144,280 @@ TEST_CASE(
             REQUIRE(force == Catch::Approx(0.0));
         }
     }
-}
\ No newline at end of file
+}
+
+TEST_CASE(
+    "LiePotential batch evaluation matches scalar evaluation",
+    "[lie_potential]"
+)
+{
+    using mstd::LieShiftedPotential;
+    using mstd::LiePotential;
+    using mstd::LJShiftedPotential;
+
+    // odd size so that both the vector body and the scalar tail are used
+    std::vector<double> radii(37);
+    for (size_t i = 0; i < radii.size(); ++i)
+        radii[i] = 0.8 + 0.05 * static_cast<double>(i);
+
+    std::vector<double> energies(radii.size());
+    std::vector<double> forces(radii.size());
+
+    const auto check = [&](const auto& potential)
+    {
+        potential.evalBatch(radii, energies, forces);
+
+        for (size_t i = 0; i < radii.size(); ++i)
+        {
+            // the shifted energies cross zero, hence the absolute margin
+            const auto [energy, force] = potential.eval(radii[i]);
+            REQUIRE(energies[i] == Catch::Approx(energy).margin(1e-12));
+            REQUIRE(forces[i] == Catch::Approx(force).margin(1e-12));
+        }
+    };
+
+    check(LiePotential<4, 8, double>(2.0, 0.75));
+    check(LiePotential<5, 9, double>(1.5, 0.25));
+    check(LieShiftedPotential<4, 8, double>(1.0, 0.5, 2.0));
+    check(LJShiftedPotential<double>(1.0, 0.5, 2.5));
+
+    // through the base class the shifted override has to be selected
+    const LJShiftedPotential<double> shifted(1.0, 0.5, 2.5);
+    const mstd::LJPotential<double>& base = shifted;
+    check(base);
+}
+
+TEST_CASE(
+    "liePotentialBatch handles float and empty inputs",
+    "[lie_potential]"
+)
+{
+    std::vector<float> radii(13);
+    for (size_t i = 0; i < radii.size(); ++i)
+        radii[i] = 0.9F + 0.1F * static_cast<float>(i);
+
+    std::vector<float> energies(radii.size());
+    std::vector<float> forces(radii.size());
+
+    mstd::liePotentialBatch<6, 12, float>(
+        1.0F,
+        0.5F,
+        radii,
+        energies,
+        forces
+    );
+
+    for (size_t i = 0; i < radii.size(); ++i)
+    {
+        const auto [energy, force] =
+            mstd::ljPotential<float>(1.0F, 0.5F, radii[i]);
+        REQUIRE(energies[i] == Catch::Approx(energy));
+        REQUIRE(forces[i] == Catch::Approx(force));
+    }
+
+    mstd::liePotentialBatch<6, 12, float>(1.0F, 0.5F, {}, {}, {});
+}
+
+TEST_CASE(
+    "LiePotential r2 path returns energy and force over distance",
+    "[lie_potential]"
+)
+{
+    using mstd::LieShiftedPotential;
+    using mstd::LiePotential;
+    using mstd::LJShiftedPotential;
+
+    std::vector<double> radii(23);
+    std::vector<double> r2(radii.size());
+    for (size_t i = 0; i < radii.size(); ++i)
+    {
+        radii[i] = 0.85 + 0.07 * static_cast<double>(i);
+        r2[i]    = radii[i] * radii[i];
+    }
+
+    std::vector<double> energies(radii.size());
+    std::vector<double> forcesOverR(radii.size());
+
+    const auto check = [&](const auto& potential)
+    {
+        potential.evalBatchFromR2(r2, energies, forcesOverR);
+
+        for (size_t i = 0; i < radii.size(); ++i)
+        {
+            const auto [energy, force] = potential.eval(radii[i]);
+            const auto [e, fOverR]     = potential.evalFromR2(r2[i]);
+
+            REQUIRE(e == Catch::Approx(energy).margin(1e-12));
+            REQUIRE(fOverR == Catch::Approx(force / radii[i]).margin(1e-12));
+            REQUIRE(energies[i] == Catch::Approx(energy).margin(1e-12));
+            REQUIRE(
+                forcesOverR[i] ==
+                Catch::Approx(force / radii[i]).margin(1e-12)
+            );
+        }
+    };
+
+    check(LiePotential<4, 8, double>(2.0, 0.75));
+    check(LiePotential<6, 12, double>(1.0, 0.5));
+    check(LiePotential<5, 9, double>(1.5, 0.25));
+    check(LieShiftedPotential<5, 9, double>(1.5, 0.25, 2.0));
+    check(LJShiftedPotential<double>(1.0, 0.5, 2.5));
+    check(mstd::LieSwitchedPotential<5, 9, double>(1.5, 0.25, 1.6, 2.0));
+    check(mstd::LJSwitchedPotential<double>(1.0, 0.5, 2.0, 2.5));
+    check(mstd::LieForceSwitchedPotential<5, 9, double>(1.5, 0.25, 1.6, 2.0));
+    check(mstd::LJForceSwitchedPotential<double>(1.0, 0.5, 2.0, 2.5));
+}
+
+TEST_CASE(
+    "LieShiftedPotential force is the derivative of its energy",
+    "[lie_potential]"
+)
+{
+    const mstd::LieShiftedPotential<4, 8, double> potential(1.0, 0.5, 2.0);
+
+    constexpr double h = 1e-6;
+
+    for (const double r : {0.9, 1.2, 1.6, 1.95})
+    {
+        const double derivative =
+            (potential.evalEnergy(r + h) - potential.evalEnergy(r - h)) /
+            (2 * h);
+
+        REQUIRE(potential.evalForce(r) == Catch::Approx(derivative));
+    }
+}
+
+TEST_CASE(
+    "LieSwitchedPotential switches energy and force smoothly to zero",
+    "[lie_potential]"
+)
+{
+    using mstd::LieSwitchedPotential;
+
+    constexpr double rs = 1.6;
+    constexpr double rc = 2.0;
+
+    const mstd::LiePotential<4, 8, double> bare(1.0, 0.5);
+    const LieSwitchedPotential<4, 8, double> potential(1.0, 0.5, rs, rc);
+
+    REQUIRE(potential.switchRadius() == rs);
+    REQUIRE(potential.radialCutoff() == rc);
+
+    // unchanged below the switching radius, zero beyond the cutoff
+    for (const double r : {0.9, 1.3, rs})
+    {
+        REQUIRE(potential.evalEnergy(r) == Catch::Approx(bare.evalEnergy(r)));
+        REQUIRE(potential.evalForce(r) == Catch::Approx(bare.evalForce(r)));
+    }
+
+    REQUIRE(potential.evalEnergy(rc) == Catch::Approx(0.0).margin(1e-30));
+    REQUIRE(potential.evalForce(rc) == Catch::Approx(0.0).margin(1e-30));
+
+    for (const double r : {2.1, 5.0})
+    {
+        REQUIRE(potential.evalEnergy(r) == 0.0);
+        REQUIRE(potential.evalForce(r) == 0.0);
+    }
+
+    // the force is the derivative of the energy across the switching range
+    constexpr double h = 1e-6;
+
+    for (const double r : {1.5, 1.65, 1.8, 1.95, 1.999})
+    {
+        const double derivative =
+            (potential.evalEnergy(r + h) - potential.evalEnergy(r - h)) /
+            (2 * h);
+
+        REQUIRE(
+            potential.evalForce(r) == Catch::Approx(derivative).margin(1e-8)
+        );
+    }
+
+    // continuous force derivative at both ends of the switching range
+    const auto forceSlope = [&](const double r)
+    {
+        return (potential.evalForce(r + h) - potential.evalForce(r - h)) /
+               (2 * h);
+    };
+    const auto bareSlope = (bare.evalForce(rs + h) - bare.evalForce(rs - h)) /
+                           (2 * h);
+
+    REQUIRE(forceSlope(rs) == Catch::Approx(bareSlope).epsilon(1e-4));
+    REQUIRE(forceSlope(rc) == Catch::Approx(0.0).margin(1e-4));
+
+    REQUIRE_THROWS_AS(
+        (LieSwitchedPotential<4, 8, double>(1.0, 0.5, rc, rs)),
+        std::invalid_argument
+    );
+}
+
+TEST_CASE(
+    "LieForceSwitchedPotential switches the force smoothly to zero",
+    "[lie_potential]"
+)
+{
+    using mstd::LieForceSwitchedPotential;
+
+    constexpr double rs = 1.6;
+    constexpr double rc = 2.0;
+
+    const mstd::LiePotential<4, 8, double> bare(1.0, 0.5);
+    const LieForceSwitchedPotential<4, 8, double> potential(1.0, 0.5, rs, rc);
+
+    REQUIRE(potential.switchRadius() == rs);
+    REQUIRE(potential.radialCutoff() == rc);
+
+    // bare force and energy shifted by a constant below the switching radius
+    const double offset = bare.evalEnergy(rs) - potential.evalEnergy(rs);
+
+    REQUIRE(offset != 0.0);
+
+    for (const double r : {0.9, 1.3, rs})
+    {
+        REQUIRE(
+            potential.evalEnergy(r) ==
+            Catch::Approx(bare.evalEnergy(r) - offset)
+        );
+        REQUIRE(potential.evalForce(r) == Catch::Approx(bare.evalForce(r)));
+    }
+
+    REQUIRE(potential.evalEnergy(rc) == Catch::Approx(0.0).margin(1e-14));
+    REQUIRE(potential.evalForce(rc) == Catch::Approx(0.0).margin(1e-14));
+
+    for (const double r : {2.1, 5.0})
+    {
+        REQUIRE(potential.evalEnergy(r) == 0.0);
+        REQUIRE(potential.evalForce(r) == 0.0);
+    }
+
+    // the force is the derivative of the energy across the switching range
+    constexpr double h = 1e-6;
+
+    for (const double r : {1.5, 1.65, 1.8, 1.95, 1.999})
+    {
+        const double derivative =
+            (potential.evalEnergy(r + h) - potential.evalEnergy(r - h)) /
+            (2 * h);
+
+        REQUIRE(
+            potential.evalForce(r) == Catch::Approx(derivative).margin(1e-8)
+        );
+    }
+
+    // continuous force derivative at both ends of the switching range
+    const auto forceSlope = [&](const double r)
+    {
+        return (potential.evalForce(r + h) - potential.evalForce(r - h)) /
+               (2 * h);
+    };
+    const auto bareSlope = (bare.evalForce(rs + h) - bare.evalForce(rs - h)) /
+                           (2 * h);
+
+    REQUIRE(forceSlope(rs) == Catch::Approx(bareSlope).epsilon(1e-4));
+    REQUIRE(forceSlope(rc) == Catch::Approx(0.0).margin(1e-4));
+
+    REQUIRE_THROWS_AS(
+        (LieForceSwitchedPotential<4, 8, double>(1.0, 0.5, rc, rs)),
+        std::invalid_argument
+    );
+}
@@ -0,0 +1,308 @@
+/*****************************************************************************
+<GPL_HEADER>
+
+    mstd library
+    Copyright (C) 2025-now  Jakob Gamper
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+<GPL_HEADER>
+******************************************************************************/
+
+#include <algorithm>
+#include <array>
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <cmath>
+#include <random>
+#include <vector>
+
+#include "mstd/physics/all_pairs.hpp"
+#include "mstd/physics/pair_forces.hpp"
+#include "mstd/physics/potentials/lie_potential.hpp"
+#include "mstd/physics/potentials/mixed_precision.hpp"
+#include "mstd/physics/potentials/static_lie_potential.hpp"
+#include "mstd/physics/verlet_list.hpp"
+
+namespace
+{
+    constexpr double cutoff  = 2.5;
+    constexpr size_t perSide = 6;
+    constexpr double spacing = 1.1;
+    constexpr double length  = perSide * spacing;
+
+    const std::array<double, 3> box{length, length, length};
+
+    struct State
+    {
+        std::vector<double> x, y, z;
+        std::vector<double> vx, vy, vz;
+        std::vector<double> fx, fy, fz;
+    };
+
+    /// jittered simple cubic lattice with random velocities
+    State initialState(const unsigned seed)
+    {
+        std::mt19937_64                        engine(seed);
+        std::uniform_real_distribution<double> jitter(-0.1, 0.1);
+        std::normal_distribution<double>       velocity(0.0, 0.7);
+
+        State state;
+        for (size_t ix = 0; ix < perSide; ++ix)
+            for (size_t iy = 0; iy < perSide; ++iy)
+                for (size_t iz = 0; iz < perSide; ++iz)
+                {
+                    state.x.push_back(
+                        spacing * static_cast<double>(ix) + jitter(engine)
+                    );
+                    state.y.push_back(
+                        spacing * static_cast<double>(iy) + jitter(engine)
+                    );
+                    state.z.push_back(
+                        spacing * static_cast<double>(iz) + jitter(engine)
+                    );
+                    state.vx.push_back(velocity(engine));
+                    state.vy.push_back(velocity(engine));
+                    state.vz.push_back(velocity(engine));
+                }
+
+        const auto n = state.x.size();
+        state.fx.assign(n, 0.0);
+        state.fy.assign(n, 0.0);
+        state.fz.assign(n, 0.0);
+        return state;
+    }
+
+    double kineticEnergy(const State& s)
+    {
+        double kinetic = 0.0;
+        for (size_t i = 0; i < s.x.size(); ++i)
+            kinetic += s.vx[i] * s.vx[i] + s.vy[i] * s.vy[i] +
+                       s.vz[i] * s.vz[i];
+        return kinetic / 2;
+    }
+
+    /**
+     * @brief runs velocity Verlet with unit masses and returns the largest
+     *        deviation of the total energy per particle from its start
+     */
+    template <typename Potential>
+    double maxEnergyDeviation(
+        const Potential& potential,
+        const size_t     nSteps,
+        const double     dt
+    )
+    {
+        auto state = initialState(3);
+
+        mstd::VerletList<> verletList(box, cutoff, 0.3);
+
+        const auto forces = [&]
+        {
+            verletList.update(state.x, state.y, state.z);
+            return mstd::computePairForces(
+                verletList,
+                potential,
+                state.x,
+                state.y,
+                state.z,
+                state.fx,
+                state.fy,
+                state.fz
+            );
+        };
+
+        const auto n     = static_cast<double>(state.x.size());
+        const auto start = forces() + kineticEnergy(state);
+
+        double deviation = 0.0;
+
+        for (size_t step = 0; step < nSteps; ++step)
+        {
+            for (size_t i = 0; i < state.x.size(); ++i)
+            {
+                state.vx[i] += dt / 2 * state.fx[i];
+                state.vy[i] += dt / 2 * state.fy[i];
+                state.vz[i] += dt / 2 * state.fz[i];
+                state.x[i]  += dt * state.vx[i];
+                state.y[i]  += dt * state.vy[i];
+                state.z[i]  += dt * state.vz[i];
+            }
+
+            const auto potentialEnergy = forces();
+
+            for (size_t i = 0; i < state.x.size(); ++i)
+            {
+                state.vx[i] += dt / 2 * state.fx[i];
+                state.vy[i] += dt / 2 * state.fy[i];
+                state.vz[i] += dt / 2 * state.fz[i];
+            }
+
+            const auto total = potentialEnergy + kineticEnergy(state);
+            deviation        = std::max(deviation, std::abs(total - start));
+        }
+
+        return deviation / n;
+    }
+
+}   // namespace
+
+TEST_CASE("mixed precision batches match the double batches", "[mixed]")
+{
+    STATIC_REQUIRE(mstd::is_mixed_precision_v<float, double>);
+    STATIC_REQUIRE(!mstd::is_mixed_precision_v<double, double>);
+    STATIC_REQUIRE(!mstd::is_mixed_precision_v<double, float>);
+
+    const mstd::StaticLJShiftedPotential<double> potential(4.0, 4.0, cutoff);
+    const mstd::StaticLJShiftedPotential<float>  floatPotential(
+        4.0F,
+        4.0F,
+        static_cast<float>(cutoff)
+    );
+    const mstd::LJShiftedPotential<float> virtualPotential(
+        4.0F,
+        4.0F,
+        static_cast<float>(cutoff)
+    );
+
+    // more than one conversion block and not a multiple of any width
+    constexpr size_t    n = 613;
+    std::vector<double> r(n);
+    std::vector<double> r2(n);
+    for (size_t i = 0; i < n; ++i)
+    {
+        r[i]  = 0.9 + 1.6 * static_cast<double>(i) / static_cast<double>(n);
+        r2[i] = r[i] * r[i];
+    }
+
+    std::vector<double> energy(n), force(n);
+    std::vector<double> mixedEnergy(n), mixedForce(n);
+
+    potential.evalBatch(r, energy, force);
+    mstd::evalBatchMixed(floatPotential, r, mixedEnergy, mixedForce);
+
+    for (size_t i = 0; i < n; ++i)
+    {
+        REQUIRE(mixedEnergy[i] == Catch::Approx(energy[i]).margin(1e-5));
+        REQUIRE(mixedForce[i] == Catch::Approx(force[i]).margin(1e-4));
+    }
+
+    potential.evalBatchFromR2(r2, energy, force);
+    mstd::evalBatchFromR2Mixed(
+        virtualPotential,
+        r2,
+        mixedEnergy,
+        mixedForce
+    );
+
+    for (size_t i = 0; i < n; ++i)
+    {
+        REQUIRE(mixedEnergy[i] == Catch::Approx(energy[i]).margin(1e-5));
+        REQUIRE(mixedForce[i] == Catch::Approx(force[i]).margin(1e-4));
+    }
+}
+
+TEST_CASE("mixed precision pair forces match the double kernel", "[mixed]")
+{
+    const mstd::StaticLJShiftedPotential<double> potential(4.0, 4.0, cutoff);
+    const mstd::StaticLJShiftedPotential<float>  floatPotential(
+        4.0F,
+        4.0F,
+        static_cast<float>(cutoff)
+    );
+
+    auto state = initialState(9);
+    auto mixed = state;
+
+    const mstd::AllPairs<> allPairs(box, cutoff);
+    mstd::VerletList<>     verletList(box, cutoff, 0.3);
+    verletList.update(state.x, state.y, state.z);
+
+    const auto energy = mstd::computePairForces(
+        allPairs,
+        potential,
+        state.x,
+        state.y,
+        state.z,
+        state.fx,
+        state.fy,
+        state.fz
+    );
+
+    const auto requireClose = [&](const double mixedEnergy)
+    {
+        const auto n = static_cast<double>(state.x.size());
+        REQUIRE(mixedEnergy / n == Catch::Approx(energy / n).margin(1e-5));
+
+        for (size_t i = 0; i < state.x.size(); ++i)
+        {
+            REQUIRE(mixed.fx[i] == Catch::Approx(state.fx[i]).margin(1e-3));
+            REQUIRE(mixed.fy[i] == Catch::Approx(state.fy[i]).margin(1e-3));
+            REQUIRE(mixed.fz[i] == Catch::Approx(state.fz[i]).margin(1e-3));
+        }
+    };
+
+    // scalar, batched and candidate row paths
+    requireClose(mstd::computePairForces<mstd::PairKernelPath::Scalar>(
+        allPairs,
+        floatPotential,
+        mixed.x,
+        mixed.y,
+        mixed.z,
+        mixed.fx,
+        mixed.fy,
+        mixed.fz
+    ));
+    requireClose(mstd::computePairForces(
+        allPairs,
+        floatPotential,
+        mixed.x,
+        mixed.y,
+        mixed.z,
+        mixed.fx,
+        mixed.fy,
+        mixed.fz
+    ));
+    requireClose(mstd::computePairForces(
+        verletList,
+        floatPotential,
+        mixed.x,
+        mixed.y,
+        mixed.z,
+        mixed.fx,
+        mixed.fy,
+        mixed.fz
+    ));
+}
+
+TEST_CASE("mixed precision energy drift stays close to double", "[mixed]")
+{
+    const mstd::StaticLJShiftedPotential<double> potential(4.0, 4.0, cutoff);
+    const mstd::StaticLJShiftedPotential<float>  floatPotential(
+        4.0F,
+        4.0F,
+        static_cast<float>(cutoff)
+    );
+
+    constexpr size_t nSteps = 1000;
+    constexpr double dt     = 0.002;
+
+    const auto doubleDeviation = maxEnergyDeviation(potential, nSteps, dt);
+    const auto mixedDeviation = maxEnergyDeviation(floatPotential, nSteps, dt);
+
+    // float evaluation adds round-off noise, but accumulating in double
+    // keeps the energy conserved on the level of the integrator error
+    REQUIRE(doubleDeviation < 1e-3);
+    REQUIRE(mixedDeviation < 2 * doubleDeviation + 1e-5);
+}
@@ -0,0 +1,291 @@
+/*****************************************************************************
+<GPL_HEADER>
+
+    mstd library
+    Copyright (C) 2025-now  Jakob Gamper
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+<GPL_HEADER>
+******************************************************************************/
+
+#include <array>
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <cmath>
+#include <cstddef>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+#include "mstd/physics/all_pairs.hpp"
+#include "mstd/physics/box.hpp"
+#include "mstd/physics/monte_carlo.hpp"
+#include "mstd/physics/pair_forces.hpp"
+#include "mstd/physics/potentials.hpp"
+#include "test_utils.hpp"
+
+namespace
+{
+    using Catch::Approx;
+
+    constexpr double cutoff  = 2.5;
+    constexpr size_t perSide = 8;
+    constexpr double spacing = 1.1;
+    constexpr double length  = perSide * spacing;
+
+    const std::array<double, 3> box{length, length, length};
+
+    using Positions = test::Particles;
+
+    Positions lattice(const unsigned seed)
+    {
+        return test::jitteredLattice(perSide, spacing, seed);
+    }
+
+    /// energy of particle @p i at @p r with all others, by a full loop
+    template <typename Potential>
+    double directEnergy(
+        const Positions&             p,
+        const Potential&             potential,
+        const size_t                 i,
+        const std::array<double, 3>& r
+    )
+    {
+        double energy = 0.0;
+
+        for (size_t j = 0; j < p.x.size(); ++j)
+        {
+            if (j == i)
+                continue;
+
+            std::array<double, 3> d{
+                r[0] - p.x[j],
+                r[1] - p.y[j],
+                r[2] - p.z[j]
+            };
+            for (auto& component : d)
+                component -= length * std::nearbyint(component / length);
+
+            const auto r2 = d[0] * d[0] + d[1] * d[1] + d[2] * d[2];
+            if (r2 < cutoff * cutoff)
+                energy += potential.evalFromR2(r2).first;
+        }
+
+        return energy;
+    }
+
+}   // namespace
+
+TEST_CASE("MonteCarloCellList validates its arguments", "[monte_carlo]")
+{
+    using mstd::MonteCarloCellList;
+
+    REQUIRE_THROWS_AS(MonteCarloCellList<>(box, 0.0), std::invalid_argument);
+    REQUIRE_THROWS_AS(
+        MonteCarloCellList<>(std::array{10.0, 4.0, 10.0}, cutoff),
+        std::invalid_argument
+    );
+
+    REQUIRE(mstd::metropolisAccept(-1.0, 1.0, 0.999));
+    REQUIRE(mstd::metropolisAccept(1.0, 1.0, 0.3));
+    REQUIRE(!mstd::metropolisAccept(1.0, 1.0, 0.4));
+}
+
+TEST_CASE("MonteCarloCellList particle energies", "[monte_carlo]")
+{
+    const mstd::StaticLJShiftedPotential<> potential(4.0, 4.0, cutoff);
+    const auto                             p = lattice(3);
+
+    mstd::MonteCarloCellList<> cells(box, cutoff);
+    cells.build(p.x, p.y, p.z);
+
+    REQUIRE(cells.size() == p.x.size());
+    REQUIRE(cells.nCells() == 27);
+
+    for (size_t i = 0; i < p.x.size(); i += 7)
+    {
+        const std::array<double, 3> r{p.x[i], p.y[i], p.z[i]};
+        REQUIRE(
+            cells.particleEnergy(potential, i) ==
+            Approx(directEnergy(p, potential, i, r)).epsilon(1e-12)
+        );
+
+        // a position outside the box is wrapped back
+        const std::array<double, 3> trial{r[0] + 0.3, r[1] - 9.0, r[2]};
+
+        const auto trialEnergy =
+            cells.particleEnergyAt(potential, i, trial[0], trial[1], trial[2]);
+        REQUIRE(
+            trialEnergy ==
+            Approx(directEnergy(p, potential, i, trial)).epsilon(1e-12)
+        );
+    }
+
+    // the virtual hierarchy takes the same energy-only path
+    const mstd::LJShiftedPotential<> virtualPotential(4.0, 4.0, cutoff);
+
+    const mstd::AllPairs<> allPairs(box, cutoff);
+    auto                   fx = p.x;
+    auto                   fy = p.y;
+    auto                   fz = p.z;
+    const auto             total =
+        mstd::computePairForces(allPairs, potential, p.x, p.y, p.z, fx, fy, fz);
+
+    REQUIRE(cells.totalEnergy(potential) == Approx(total).epsilon(1e-12));
+    REQUIRE(
+        cells.totalEnergy(virtualPotential) == Approx(total).epsilon(1e-12)
+    );
+}
+
+TEST_CASE("MonteCarloCellList in single precision", "[monte_carlo]")
+{
+    const mstd::StaticLJShiftedPotential<>      potential(4.0, 4.0, cutoff);
+    const mstd::StaticLJShiftedPotential<float> floatPotential(
+        4.0F,
+        4.0F,
+        static_cast<float>(cutoff)
+    );
+    const auto p = lattice(5);
+
+    const auto toFloat = [](const std::vector<double>& values)
+    { return std::vector<float>(values.begin(), values.end()); };
+
+    const auto x = toFloat(p.x);
+    const auto y = toFloat(p.y);
+    const auto z = toFloat(p.z);
+
+    const auto floatLength = static_cast<float>(length);
+
+    mstd::MonteCarloCellList<float> cells(
+        std::array{floatLength, floatLength, floatLength},
+        static_cast<float>(cutoff)
+    );
+    cells.build(x, y, z);
+
+    // the self slot is masked through integer lanes of the float vectors
+    for (size_t i = 0; i < p.x.size(); i += 5)
+    {
+        const std::array<double, 3> r{x[i], y[i], z[i]};
+        REQUIRE(
+            cells.particleEnergy(floatPotential, i) ==
+            Approx(directEnergy(p, potential, i, r)).margin(1e-3)
+        );
+    }
+}
+
+TEST_CASE("MonteCarloCellList accept and reject", "[monte_carlo]")
+{
+    const mstd::StaticLJShiftedPotential<> potential(4.0, 4.0, cutoff);
+    auto                                   p = lattice(11);
+
+    mstd::MonteCarloCellList<> cells(box, cutoff);
+    cells.build(p.x, p.y, p.z);
+
+    std::mt19937_64                        engine(5);
+    std::uniform_real_distribution<double> unit(0.0, 1.0);
+    std::uniform_int_distribution<size_t>  pick(0, p.x.size() - 1);
+
+    auto   energy   = cells.totalEnergy(potential);
+    size_t accepted = 0;
+
+    for (size_t move = 0; move < 3000; ++move)
+    {
+        const auto i = pick(engine);
+        const auto r = cells.position(i);
+
+        const std::array<double, 3> trial{
+            r[0] + 0.6 * (unit(engine) - 0.5),
+            r[1] + 0.6 * (unit(engine) - 0.5),
+            r[2] + 0.6 * (unit(engine) - 0.5)
+        };
+
+        const auto delta =
+            cells.trialMove(potential, i, trial[0], trial[1], trial[2]);
+        REQUIRE(cells.hasTrial());
+
+        if (mstd::metropolisAccept(delta, 1.0, unit(engine)))
+        {
+            cells.accept();
+            energy += delta;
+            ++accepted;
+        }
+        else
+            cells.reject();
+
+        REQUIRE(!cells.hasTrial());
+    }
+
+    REQUIRE(accepted > 300);
+    REQUIRE(accepted < 3000);
+    REQUIRE(cells.totalEnergy(potential) == Approx(energy).epsilon(1e-9));
+
+    // the cells agree with a rebuild from the final positions
+    cells.copyPositions(p.x, p.y, p.z);
+
+    mstd::MonteCarloCellList<> rebuilt(box, cutoff);
+    rebuilt.build(p.x, p.y, p.z);
+
+    for (size_t i = 0; i < p.x.size(); ++i)
+    {
+        REQUIRE(cells.cellOf(i) == rebuilt.cellOf(i));
+        REQUIRE(
+            cells.particleEnergy(potential, i) ==
+            Approx(rebuilt.particleEnergy(potential, i)).margin(1e-12)
+        );
+    }
+}
+
+TEST_CASE("MonteCarloCellList grows full cells", "[monte_carlo]")
+{
+    const mstd::StaticLJShiftedPotential<> potential(4.0, 4.0, cutoff);
+    auto                                   p = lattice(19);
+
+    mstd::MonteCarloCellList<> cells(box, cutoff);
+    cells.build(p.x, p.y, p.z);
+
+    const auto slots = cells.slotsPerCell();
+
+    // crowd particles of other cells around the centre of the first cell
+    const auto centre = length / 6;
+
+    cells.trialMove(potential, 0, centre, centre, centre);
+    cells.accept();
+
+    const auto target = cells.cellOf(0);
+
+    size_t moved = 0;
+    for (size_t i = 1; moved < 2 * slots; ++i)
+    {
+        if (cells.cellOf(i) == target)
+            continue;
+
+        const auto offset = 0.01 * static_cast<double>(moved + 1);
+        cells.trialMove(potential, i, centre + offset, centre + 0.1, centre);
+        cells.accept();
+        ++moved;
+
+        REQUIRE(cells.cellOf(i) == target);
+    }
+
+    REQUIRE(cells.slotsPerCell() > slots);
+
+    cells.copyPositions(p.x, p.y, p.z);
+    for (size_t i = 0; i < p.x.size(); i += 5)
+        REQUIRE(
+            cells.particleEnergy(potential, i) ==
+            Approx(directEnergy(p, potential, i, cells.position(i)))
+                .epsilon(1e-12)
+        );
+}
@@ -0,0 +1,447 @@
+/*****************************************************************************
+<GPL_HEADER>
+
+    mstd library
+    Copyright (C) 2025-now  Jakob Gamper
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+<GPL_HEADER>
+******************************************************************************/
+
+#include <array>
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <cmath>
+#include <utility>
+#include <vector>
+
+#include "mstd/physics/all_pairs.hpp"
+#include "mstd/physics/box.hpp"
+#include "mstd/physics/cell_list.hpp"
+#include "mstd/physics/pair_forces.hpp"
+#include "mstd/physics/potentials.hpp"
+#include "mstd/physics/verlet_list.hpp"
+#include "test_utils.hpp"
+
+namespace
+{
+    constexpr double cutoff  = 2.5;
+    constexpr size_t perSide = 8;
+    constexpr double spacing = 1.1;
+    constexpr double length  = perSide * spacing;
+
+    const std::array<double, 3> box{length, length, length};
+
+    struct System
+    {
+        std::vector<double> x;
+        std::vector<double> y;
+        std::vector<double> z;
+        std::vector<double> fx;
+        std::vector<double> fy;
+        std::vector<double> fz;
+    };
+
+    /// jittered simple cubic lattice with unit forces to be overwritten
+    System latticeSystem(const unsigned seed)
+    {
+        auto [x, y, z] = test::jitteredLattice(perSide, spacing, seed);
+
+        const auto n = x.size();
+        return {
+            std::move(x),
+            std::move(y),
+            std::move(z),
+            std::vector<double>(n, 1.0),
+            std::vector<double>(n, 1.0),
+            std::vector<double>(n, 1.0)
+        };
+    }
+
+    /// straightforward double loop evaluating the potential at r
+    template <typename Potential>
+    double referenceForces(
+        const System&        s,
+        const Potential&     potential,
+        std::vector<double>& fx,
+        std::vector<double>& fy,
+        std::vector<double>& fz
+    )
+    {
+        const auto n = s.x.size();
+        fx.assign(n, 0.0);
+        fy.assign(n, 0.0);
+        fz.assign(n, 0.0);
+
+        double energy = 0.0;
+
+        for (size_t i = 0; i < n; ++i)
+            for (size_t j = i + 1; j < n; ++j)
+            {
+                auto dx = s.x[i] - s.x[j];
+                auto dy = s.y[i] - s.y[j];
+                auto dz = s.z[i] - s.z[j];
+                dx     -= length * std::nearbyint(dx / length);
+                dy     -= length * std::nearbyint(dy / length);
+                dz     -= length * std::nearbyint(dz / length);
+
+                const auto r = std::sqrt(dx * dx + dy * dy + dz * dz);
+                if (r >= cutoff)
+                    continue;
+
+                const auto [e, f] = potential.eval(r);
+                energy           += e;
+
+                fx[i] -= f * dx / r;
+                fy[i] -= f * dy / r;
+                fz[i] -= f * dz / r;
+                fx[j] += f * dx / r;
+                fy[j] += f * dy / r;
+                fz[j] += f * dz / r;
+            }
+
+        return energy;
+    }
+
+    /// pair virial of the direct double loop, row by row
+    template <typename Potential>
+    std::array<double, 9> referenceVirial(
+        const System&    s,
+        const Potential& potential
+    )
+    {
+        std::array<double, 9> virial{};
+
+        for (size_t i = 0; i < s.x.size(); ++i)
+            for (size_t j = i + 1; j < s.x.size(); ++j)
+            {
+                std::array<double, 3> d{
+                    s.x[i] - s.x[j],
+                    s.y[i] - s.y[j],
+                    s.z[i] - s.z[j]
+                };
+                for (auto& component : d)
+                    component -= length * std::nearbyint(component / length);
+
+                const auto r =
+                    std::sqrt(d[0] * d[0] + d[1] * d[1] + d[2] * d[2]);
+                if (r >= cutoff)
+                    continue;
+
+                const auto f = potential.eval(r).second;
+
+                // force on i is -f d / r
+                for (size_t a = 0; a < 3; ++a)
+                    for (size_t b = 0; b < 3; ++b)
+                        virial[3 * a + b] -= d[a] * f * d[b] / r;
+            }
+
+        return virial;
+    }
+
+    template <mstd::PairKernelPath Path, typename Source, typename Potential>
+    void requireReference(
+        const Source&    source,
+        const Potential& potential,
+        System&          s
+    )
+    {
+        std::vector<double> fx;
+        std::vector<double> fy;
+        std::vector<double> fz;
+        const auto refEnergy = referenceForces(s, potential, fx, fy, fz);
+
+        const auto energy = mstd::computePairForces<Path>(
+            source,
+            potential,
+            s.x,
+            s.y,
+            s.z,
+            s.fx,
+            s.fy,
+            s.fz
+        );
+
+        REQUIRE(energy == Catch::Approx(refEnergy).epsilon(1e-10));
+
+        std::array<double, 3> total{};
+        for (size_t i = 0; i < s.x.size(); ++i)
+        {
+            REQUIRE(s.fx[i] == Catch::Approx(fx[i]).margin(1e-9));
+            REQUIRE(s.fy[i] == Catch::Approx(fy[i]).margin(1e-9));
+            REQUIRE(s.fz[i] == Catch::Approx(fz[i]).margin(1e-9));
+
+            total[0] += s.fx[i];
+            total[1] += s.fy[i];
+            total[2] += s.fz[i];
+        }
+
+        // Newton's third law: no net force
+        for (const auto component : total)
+            REQUIRE(component == Catch::Approx(0.0).margin(1e-9));
+
+        // the overload with a virial leaves energy and forces unchanged
+        auto                 withVirial = s;
+        mstd::VirialTensor<> virial;
+
+        const auto virialEnergy = mstd::computePairForces<Path>(
+            source,
+            potential,
+            withVirial.x,
+            withVirial.y,
+            withVirial.z,
+            withVirial.fx,
+            withVirial.fy,
+            withVirial.fz,
+            virial
+        );
+
+        REQUIRE(virialEnergy == Catch::Approx(energy).epsilon(1e-14));
+        for (size_t i = 0; i < s.x.size(); ++i)
+        {
+            REQUIRE(withVirial.fx[i] == Catch::Approx(s.fx[i]).margin(1e-12));
+            REQUIRE(withVirial.fy[i] == Catch::Approx(s.fy[i]).margin(1e-12));
+            REQUIRE(withVirial.fz[i] == Catch::Approx(s.fz[i]).margin(1e-12));
+        }
+
+        const auto refVirial = referenceVirial(s, potential);
+        for (size_t a = 0; a < 3; ++a)
+            for (size_t b = 0; b < 3; ++b)
+                REQUIRE(
+                    virial(a, b) ==
+                    Catch::Approx(refVirial[3 * a + b]).margin(1e-9)
+                );
+    }
+
+    template <mstd::PairKernelPath Path>
+    void requireAllSources()
+    {
+        const mstd::StaticLJShiftedPotential<> potential(4.0, 4.0, cutoff);
+        auto                                   system = latticeSystem(17);
+
+        const mstd::AllPairs<> allPairs(box, cutoff);
+        requireReference<Path>(allPairs, potential, system);
+
+        mstd::CellList<> cellList(box, cutoff);
+        cellList.build(system.x, system.y, system.z);
+        requireReference<Path>(cellList, potential, system);
+
+        mstd::VerletList<> verletList(box, cutoff, 0.4);
+        verletList.update(system.x, system.y, system.z);
+        requireReference<Path>(verletList, potential, system);
+    }
+
+}   // namespace
+
+TEST_CASE("pair sources satisfy PairSourceType", "[pair_forces]")
+{
+    STATIC_REQUIRE(mstd::is_pair_source_v<mstd::AllPairs<>>);
+    STATIC_REQUIRE(mstd::is_pair_source_v<mstd::CellList<>>);
+    STATIC_REQUIRE(mstd::is_pair_source_v<mstd::VerletList<float>>);
+    STATIC_REQUIRE(!mstd::is_pair_source_v<std::vector<double>>);
+}
+
+TEST_CASE("computePairForces matches a direct double loop", "[pair_forces]")
+{
+    SECTION("scalar path")
+    {
+        requireAllSources<mstd::PairKernelPath::Scalar>();
+    }
+
+    SECTION("SIMD path")
+    {
+        requireAllSources<mstd::PairKernelPath::Simd>();
+    }
+}
+
+TEST_CASE(
+    "computePairForces accepts virtual and type erased potentials",
+    "[pair_forces]"
+)
+{
+    const mstd::LJShiftedPotential<> virtualPotential(4.0, 4.0, cutoff);
+    const mstd::AnyPotential<double> anyPotential(
+        mstd::StaticLJShiftedPotential<>(4.0, 4.0, cutoff)
+    );
+
+    auto             system = latticeSystem(5);
+    mstd::CellList<> cellList(box, cutoff);
+    cellList.build(system.x, system.y, system.z);
+
+    requireReference<mstd::PairKernelPath::Simd>(
+        cellList,
+        virtualPotential,
+        system
+    );
+    requireReference<mstd::PairKernelPath::Scalar>(
+        cellList,
+        anyPotential,
+        system
+    );
+}
+
+TEST_CASE("pair forces are the negative energy gradient", "[pair_forces]")
+{
+    const mstd::StaticLJShiftedPotential<> potential(4.0, 4.0, cutoff);
+    const mstd::AllPairs<>                 source(box, cutoff);
+
+    auto system = latticeSystem(23);
+    mstd::computePairForces(
+        source,
+        potential,
+        system.x,
+        system.y,
+        system.z,
+        system.fx,
+        system.fy,
+        system.fz
+    );
+
+    const auto energyAt = [&](const double shift)
+    {
+        auto moved  = system;
+        moved.y[7] += shift;
+        return mstd::computePairForces(
+            source,
+            potential,
+            moved.x,
+            moved.y,
+            moved.z,
+            moved.fx,
+            moved.fy,
+            moved.fz
+        );
+    };
+
+    const double h        = 1e-6;
+    const auto   gradient = (energyAt(h) - energyAt(-h)) / (2 * h);
+
+    REQUIRE(system.fy[7] == Catch::Approx(-gradient).epsilon(1e-5));
+}
+
+TEST_CASE(
+    "pair virial is the negative strain derivative of the energy",
+    "[pair_forces]"
+)
+{
+    const mstd::StaticLJShiftedPotential<> potential(4.0, 4.0, cutoff);
+    const auto                             system = latticeSystem(31);
+
+    mstd::VirialTensor<> virial;
+    auto                 forces = system;
+    mstd::computePairForces(
+        mstd::AllPairs<>(box, cutoff),
+        potential,
+        forces.x,
+        forces.y,
+        forces.z,
+        forces.fx,
+        forces.fy,
+        forces.fz,
+        virial
+    );
+
+    // stretches box and positions by 1 + strain along x only
+    const auto energyAt = [&](const double strain)
+    {
+        auto strained = system;
+        for (auto& x : strained.x)
+            x *= 1 + strain;
+
+        const std::array<double, 3> strainedBox{
+            length * (1 + strain),
+            length,
+            length
+        };
+
+        return mstd::computePairForces(
+            mstd::AllPairs<>(strainedBox, cutoff),
+            potential,
+            strained.x,
+            strained.y,
+            strained.z,
+            strained.fx,
+            strained.fy,
+            strained.fz
+        );
+    };
+
+    const double h          = 1e-6;
+    const auto   derivative = (energyAt(h) - energyAt(-h)) / (2 * h);
+
+    REQUIRE(virial(0, 0) == Catch::Approx(-derivative).epsilon(1e-5));
+    REQUIRE(virial(0, 1) == virial(1, 0));
+    REQUIRE(virial(1, 2) == virial(2, 1));
+}
+
+TEST_CASE("computePairForces supports triclinic boxes", "[pair_forces]")
+{
+    using Box = mstd::TriclinicBox<>;
+
+    const Box box(length, length, length, 1.5, -1.0, 2.0);
+    const mstd::StaticLJShiftedPotential<> potential(4.0, 4.0, cutoff);
+
+    // sheared lattice, commensurate with the tilted cell
+    auto system = latticeSystem(29);
+    for (size_t i = 0; i < system.x.size(); ++i)
+    {
+        const auto sa = system.x[i] / length;
+        const auto sb = system.y[i] / length;
+        const auto sc = system.z[i] / length;
+
+        system.x[i] = sa * length + sb * 1.5 - sc * 1.0;
+        system.y[i] = sb * length + sc * 2.0;
+        system.z[i] = sc * length;
+    }
+
+    constexpr auto scalar = mstd::PairKernelPath::Scalar;
+
+    const mstd::AllPairs<double, Box> allPairs(box, cutoff);
+    auto                              reference = system;
+    const auto refEnergy = mstd::computePairForces<scalar>(
+        allPairs,
+        potential,
+        reference.x,
+        reference.y,
+        reference.z,
+        reference.fx,
+        reference.fy,
+        reference.fz
+    );
+
+    mstd::VerletList<double, Box> verletList(box, cutoff, 0.4);
+    verletList.update(system.x, system.y, system.z);
+
+    const auto energy = mstd::computePairForces(
+        verletList,
+        potential,
+        system.x,
+        system.y,
+        system.z,
+        system.fx,
+        system.fy,
+        system.fz
+    );
+
+    REQUIRE(refEnergy < 0.0);
+    REQUIRE(energy == Catch::Approx(refEnergy).epsilon(1e-10));
+
+    for (size_t i = 0; i < system.x.size(); ++i)
+    {
+        REQUIRE(system.fx[i] == Catch::Approx(reference.fx[i]).margin(1e-9));
+        REQUIRE(system.fy[i] == Catch::Approx(reference.fy[i]).margin(1e-9));
+        REQUIRE(system.fz[i] == Catch::Approx(reference.fz[i]).margin(1e-9));
+    }
+}
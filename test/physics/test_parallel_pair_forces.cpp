@@ -0,0 +1,343 @@
+/*****************************************************************************
+<GPL_HEADER>
+
+    mstd library
+    Copyright (C) 2025-now  Jakob Gamper
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+<GPL_HEADER>
+******************************************************************************/
+
+#include <algorithm>
+#include <array>
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <random>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "mstd/physics/all_pairs.hpp"
+#include "mstd/physics/cell_list.hpp"
+#include "mstd/physics/pair_forces.hpp"
+#include "mstd/physics/parallel_pair_forces.hpp"
+#include "mstd/physics/potentials.hpp"
+#include "mstd/physics/verlet_list.hpp"
+
+namespace
+{
+    constexpr double cutoff = 2.5;
+
+    const std::array<double, 3> box{11.0, 12.0, 10.5};
+
+    struct Positions
+    {
+        std::vector<double> x;
+        std::vector<double> y;
+        std::vector<double> z;
+    };
+
+    /// random particles with a minimum distance of 0.8
+    Positions spacedPositions(const size_t n, const unsigned seed)
+    {
+        std::mt19937_64                        engine(seed);
+        std::uniform_real_distribution<double> unit(0.0, 1.0);
+
+        Positions p;
+        while (p.x.size() < n)
+        {
+            const auto x = box[0] * unit(engine);
+            const auto y = box[1] * unit(engine);
+            const auto z = box[2] * unit(engine);
+
+            bool overlap = false;
+            for (size_t j = 0; j < p.x.size() && !overlap; ++j)
+            {
+                auto dx  = x - p.x[j];
+                auto dy  = y - p.y[j];
+                auto dz  = z - p.z[j];
+                dx      -= box[0] * std::nearbyint(dx / box[0]);
+                dy      -= box[1] * std::nearbyint(dy / box[1]);
+                dz      -= box[2] * std::nearbyint(dz / box[2]);
+                overlap  = dx * dx + dy * dy + dz * dz < 0.64;
+            }
+
+            if (!overlap)
+            {
+                p.x.push_back(x);
+                p.y.push_back(y);
+                p.z.push_back(z);
+            }
+        }
+
+        return p;
+    }
+
+    template <mstd::PairKernelPath Path, typename Source>
+    void requireSerialResult(const Source& source, const Positions& p)
+    {
+        const mstd::StaticLJShiftedPotential<> potential(4.0, 4.0, cutoff);
+
+        const auto          n = p.x.size();
+        std::vector<double> fx(n);
+        std::vector<double> fy(n);
+        std::vector<double> fz(n);
+
+        mstd::VirialTensor<> virial;
+
+        const auto energy = mstd::computePairForces<Path>(
+            source,
+            potential,
+            p.x,
+            p.y,
+            p.z,
+            fx,
+            fy,
+            fz,
+            virial
+        );
+
+        for (const size_t nThreads : {1UL, 2UL, 3UL, 4UL, 7UL})
+        {
+            mstd::ParallelPairForces<> kernel(nThreads);
+            REQUIRE(kernel.nThreads() == nThreads);
+
+            // non-zero start values have to be overwritten
+            std::vector<double> px(n, 1.0);
+            std::vector<double> py(n, 1.0);
+            std::vector<double> pz(n, 1.0);
+
+            // the second call reuses the thread buffers
+            for (int call = 0; call < 2; ++call)
+            {
+                const auto parallelEnergy = kernel.template compute<Path>(
+                    source,
+                    potential,
+                    p.x,
+                    p.y,
+                    p.z,
+                    px,
+                    py,
+                    pz
+                );
+
+                REQUIRE(parallelEnergy == Catch::Approx(energy));
+
+                for (size_t i = 0; i < n; ++i)
+                {
+                    REQUIRE(px[i] == Catch::Approx(fx[i]).margin(1e-9));
+                    REQUIRE(py[i] == Catch::Approx(fy[i]).margin(1e-9));
+                    REQUIRE(pz[i] == Catch::Approx(fz[i]).margin(1e-9));
+                }
+            }
+
+            mstd::VirialTensor<> parallelVirial;
+            kernel.template compute<Path>(
+                source,
+                potential,
+                p.x,
+                p.y,
+                p.z,
+                px,
+                py,
+                pz,
+                parallelVirial
+            );
+
+            for (size_t a = 0; a < 3; ++a)
+                for (size_t b = 0; b < 3; ++b)
+                    REQUIRE(
+                        parallelVirial(a, b) ==
+                        Catch::Approx(virial(a, b)).margin(1e-9)
+                    );
+        }
+    }
+
+    template <mstd::PairKernelPath Path>
+    void requireAllSources()
+    {
+        const auto p = spacedPositions(700, 13);
+
+        requireSerialResult<Path>(mstd::AllPairs<>(box, cutoff), p);
+
+        mstd::CellList<> cellList(box, cutoff);
+        cellList.build(p.x, p.y, p.z);
+        requireSerialResult<Path>(cellList, p);
+
+        mstd::VerletList<> verletList(box, cutoff, 0.3);
+        verletList.update(p.x, p.y, p.z);
+        requireSerialResult<Path>(verletList, p);
+    }
+
+    /// collects all pairs of @p source chunk by chunk and checks that they
+    /// lie in the particle range of their chunk
+    template <typename Source>
+    size_t countChunkedPairs(
+        const Source&    source,
+        const Positions& p,
+        const size_t     nChunks
+    )
+    {
+        size_t count   = 0;
+        bool   inRange = true;
+
+        for (size_t chunk = 0; chunk < nChunks; ++chunk)
+        {
+            auto range = std::pair<size_t, size_t>{0, p.x.size()};
+
+            if constexpr (requires { source.chunkParticleRange(0, 1, 0); })
+                range = source.chunkParticleRange(chunk, nChunks, p.x.size());
+
+            source.forEachPairInChunk(
+                chunk,
+                nChunks,
+                p.x,
+                p.y,
+                p.z,
+                [&](size_t i, size_t j, double, double, double, double)
+                {
+                    ++count;
+                    inRange = inRange && std::min(i, j) >= range.first &&
+                              std::max(i, j) < range.second;
+                }
+            );
+        }
+
+        REQUIRE(inRange);
+
+        return count;
+    }
+
+    /// LJ potential that fails for close pairs
+    struct ThrowingPotential : mstd::LJPotential<double>
+    {
+        using mstd::LJPotential<double>::LJPotential;
+
+        std::pair<double, double> evalFromR2(const double r2) const override
+        {
+            if (r2 < 1.0)
+                throw std::runtime_error("close pair");
+
+            return mstd::LJPotential<double>::evalFromR2(r2);
+        }
+    };
+
+}   // namespace
+
+TEST_CASE(
+    "ParallelPairForces matches the serial kernel",
+    "[parallel_pair_forces]"
+)
+{
+    SECTION("scalar path")
+    {
+        requireAllSources<mstd::PairKernelPath::Scalar>();
+    }
+
+    SECTION("SIMD path")
+    {
+        requireAllSources<mstd::PairKernelPath::Simd>();
+    }
+}
+
+TEST_CASE("pair source chunks cover all pairs", "[parallel_pair_forces]")
+{
+    STATIC_REQUIRE(mstd::is_chunked_pair_source_v<mstd::AllPairs<>>);
+    STATIC_REQUIRE(mstd::is_chunked_pair_source_v<mstd::CellList<>>);
+    STATIC_REQUIRE(mstd::is_chunked_pair_source_v<mstd::VerletList<>>);
+
+    const auto p = spacedPositions(400, 3);
+
+    const mstd::AllPairs<> allPairs(box, cutoff);
+
+    mstd::CellList<> cellList(box, cutoff);
+    cellList.build(p.x, p.y, p.z);
+
+    mstd::VerletList<> verletList(box, cutoff, 0.3);
+    verletList.update(p.x, p.y, p.z);
+
+    const auto total = countChunkedPairs(allPairs, p, 1);
+
+    // more chunks than cells or particles per chunk must still work
+    for (const size_t nChunks : {2UL, 5UL, 64UL, 1000UL})
+    {
+        REQUIRE(countChunkedPairs(allPairs, p, nChunks) == total);
+        REQUIRE(countChunkedPairs(cellList, p, nChunks) == total);
+        REQUIRE(countChunkedPairs(verletList, p, nChunks) == total);
+    }
+}
+
+TEST_CASE("ParallelPairForces rejects zero threads", "[parallel_pair_forces]")
+{
+    REQUIRE_THROWS_AS(mstd::ParallelPairForces<>(0), std::invalid_argument);
+    REQUIRE(mstd::ParallelPairForces<>().nThreads() >= 1);
+}
+
+TEST_CASE(
+    "ParallelPairForces rethrows exceptions of the potential",
+    "[parallel_pair_forces]"
+)
+{
+    const auto p = spacedPositions(700, 13);
+    const auto n = p.x.size();
+
+    mstd::VerletList<> verletList(box, cutoff, 0.3);
+    verletList.update(p.x, p.y, p.z);
+
+    const ThrowingPotential                throwing(4.0, 4.0);
+    const mstd::StaticLJShiftedPotential<> potential(4.0, 4.0, cutoff);
+
+    std::vector<double> fx(n);
+    std::vector<double> fy(n);
+    std::vector<double> fz(n);
+
+    const auto energy = mstd::computePairForces(
+        verletList,
+        potential,
+        p.x,
+        p.y,
+        p.z,
+        fx,
+        fy,
+        fz
+    );
+
+    for (const size_t nThreads : {1UL, 2UL, 4UL, 7UL})
+    {
+        mstd::ParallelPairForces<> kernel(nThreads);
+
+        // every thread has to finish instead of waiting for the failed one
+        for (int call = 0; call < 2; ++call)
+            REQUIRE_THROWS_AS(
+                kernel.compute<mstd::PairKernelPath::Scalar>(
+                    verletList,
+                    throwing,
+                    p.x,
+                    p.y,
+                    p.z,
+                    fx,
+                    fy,
+                    fz
+                ),
+                std::runtime_error
+            );
+
+        // the threads stay usable
+        REQUIRE(
+            kernel.compute(verletList, potential, p.x, p.y, p.z, fx, fy, fz) ==
+            Catch::Approx(energy)
+        );
+    }
+}
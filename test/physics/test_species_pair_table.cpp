@@ -0,0 +1,382 @@
+/*****************************************************************************
+<GPL_HEADER>
+
+    mstd library
+    Copyright (C) 2025-now  Jakob Gamper
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+<GPL_HEADER>
+******************************************************************************/
+
+#include <array>
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <cmath>
+#include <numbers>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+#include "mstd/physics/all_pairs.hpp"
+#include "mstd/physics/pair_forces.hpp"
+#include "mstd/physics/parallel_pair_forces.hpp"
+#include "mstd/physics/potentials/species_pair_table.hpp"
+#include "mstd/physics/potentials/static_lie_potential.hpp"
+#include "mstd/physics/verlet_list.hpp"
+
+namespace
+{
+    using Catch::Approx;
+
+    constexpr double cutoff = 2.5;
+
+    const std::vector<double> sigma{1.0, 1.2, 0.8};
+    const std::vector<double> epsilon{1.0, 0.5, 2.0};
+
+    /// Simpson rule for the integral of f(r) from rc to infinity, r = rc/t
+    template <typename F>
+    double tailIntegral(const F& f, const double rc)
+    {
+        constexpr size_t intervals = 2000;
+
+        const auto h         = 1.0 / intervals;
+        const auto integrand = [&](const double t)
+        { return t == 0.0 ? 0.0 : f(rc / t) * rc / (t * t); };
+
+        double sum = integrand(0.0) + integrand(1.0);
+        for (size_t k = 1; k < intervals; ++k)
+            sum += (k % 2 == 1 ? 4.0 : 2.0) *
+                   integrand(static_cast<double>(k) * h);
+
+        return sum * h / 3;
+    }
+
+}   // namespace
+
+TEST_CASE("SpeciesPairTable mixes sigma and epsilon", "[species]")
+{
+    const mstd::LJSpeciesPairTable<> lorentzBerthelot(sigma, epsilon, cutoff);
+    const mstd::LJSpeciesPairTable<> geometric(
+        sigma,
+        epsilon,
+        cutoff,
+        mstd::MixingRule::Geometric
+    );
+
+    REQUIRE(lorentzBerthelot.nSpecies() == 3);
+
+    // Lennard-Jones: c1 = 4 eps sigma^6, c2 = 4 eps sigma^12
+    REQUIRE(lorentzBerthelot.coeff1(0, 0) == Approx(4.0));
+    REQUIRE(lorentzBerthelot.coeff2(2, 2) == Approx(8.0 * std::pow(0.8, 12)));
+
+    const auto lbSigma = 1.1;
+    const auto geSigma = std::sqrt(1.2);
+    const auto mixedEp = std::sqrt(0.5);
+
+    REQUIRE(
+        lorentzBerthelot.coeff1(0, 1) ==
+        Approx(4 * mixedEp * std::pow(lbSigma, 6))
+    );
+    REQUIRE(
+        geometric.coeff2(1, 0) == Approx(4 * mixedEp * std::pow(geSigma, 12))
+    );
+    REQUIRE(lorentzBerthelot.coeff1(1, 2) == lorentzBerthelot.coeff1(2, 1));
+
+    REQUIRE_THROWS_AS(
+        mstd::LJSpeciesPairTable<>(sigma, std::vector<double>{1.0}, cutoff),
+        std::invalid_argument
+    );
+    REQUIRE_THROWS_AS(
+        mstd::LJSpeciesPairTable<>(
+            std::vector<double>{1.0, -1.0},
+            std::vector<double>{1.0, 1.0},
+            cutoff
+        ),
+        std::invalid_argument
+    );
+}
+
+TEST_CASE("SpeciesPairTable matches the truncated Lie potential", "[species]")
+{
+    mstd::LJSpeciesPairTable<> table(sigma, epsilon, cutoff);
+    table.setPair(0, 2, 0.9, 1.5, 2.0);
+
+    REQUIRE(table.cutoff(2, 0) == Approx(2.0));
+    REQUIRE(table.maxCutoff() == Approx(cutoff));
+
+    for (size_t a = 0; a < 3; ++a)
+        for (size_t b = 0; b < 3; ++b)
+        {
+            const mstd::StaticLJPotential<> reference(
+                table.coeff1(a, b),
+                table.coeff2(a, b)
+            );
+            const auto rc    = table.cutoff(a, b);
+            const auto shift = reference.evalEnergy(rc);
+
+            for (const double r : {0.85, 1.1, 1.7, 1.99, 2.3})
+            {
+                const auto [energy, forceOverR] =
+                    table.evalFromR2(table.pairIndex(a, b), r * r);
+
+                if (r >= rc)
+                {
+                    REQUIRE(energy == 0.0);
+                    REQUIRE(forceOverR == 0.0);
+                    continue;
+                }
+
+                const auto [e, f] = reference.eval(r);
+                REQUIRE(energy == Approx(e - shift));
+                REQUIRE(forceOverR == Approx(f / r));
+            }
+        }
+
+    // the energy is continuous at every cutoff
+    const auto below = table.evalFromR2(table.pairIndex(2, 0), 3.9999);
+    REQUIRE(below.first == Approx(0.0).margin(1e-4));
+}
+
+TEST_CASE("SpeciesPairTable batch gathers the parameters", "[species]")
+{
+    const mstd::LJSpeciesPairTable<> table(sigma, epsilon, cutoff);
+
+    std::mt19937_64                        engine(3);
+    std::uniform_int_distribution<size_t>  species(0, 2);
+    std::uniform_real_distribution<double> distance(0.8, 2.7);
+
+    constexpr size_t    n = 301;
+    std::vector<size_t> pairs(n);
+    std::vector<double> r2(n);
+    for (size_t k = 0; k < n; ++k)
+    {
+        pairs[k]     = table.pairIndex(species(engine), species(engine));
+        const auto r = distance(engine);
+        r2[k]        = r * r;
+    }
+
+    std::vector<double> energy(n);
+    std::vector<double> forceOverR(n);
+    table.evalBatchFromR2(pairs, r2, energy, forceOverR);
+
+    for (size_t k = 0; k < n; ++k)
+    {
+        const auto [e, f] = table.evalFromR2(pairs[k], r2[k]);
+        REQUIRE(energy[k] == Approx(e).margin(1e-12));
+        REQUIRE(forceOverR[k] == Approx(f).margin(1e-12));
+    }
+}
+
+TEST_CASE("pair kernels evaluate mixtures through the table", "[species]")
+{
+    using mstd::PairKernelPath;
+
+    constexpr size_t perSide = 8;
+    constexpr double spacing = 1.1;
+    constexpr double length  = perSide * spacing;
+
+    const std::array<double, 3> box{length, length, length};
+
+    std::mt19937_64                        engine(7);
+    std::uniform_real_distribution<double> jitter(-0.1, 0.1);
+    std::uniform_int_distribution<size_t>  speciesDist(0, 2);
+
+    std::vector<double> x, y, z;
+    std::vector<size_t> species;
+    for (size_t ix = 0; ix < perSide; ++ix)
+        for (size_t iy = 0; iy < perSide; ++iy)
+            for (size_t iz = 0; iz < perSide; ++iz)
+            {
+                x.push_back(spacing * static_cast<double>(ix) + jitter(engine));
+                y.push_back(spacing * static_cast<double>(iy) + jitter(engine));
+                z.push_back(spacing * static_cast<double>(iz) + jitter(engine));
+                species.push_back(speciesDist(engine));
+            }
+
+    const auto n = x.size();
+
+    const mstd::LJSpeciesPairTable<>   table(sigma, epsilon, cutoff);
+    const mstd::SpeciesPairPotential potential(table, species);
+
+    STATIC_REQUIRE(mstd::is_indexed_pair_potential_v<decltype(potential)>);
+    STATIC_REQUIRE(!mstd::is_pair_potential_v<decltype(potential)>);
+
+    // reference: one shifted potential object per species pair
+    std::vector<double> refX(n, 0.0), refY(n, 0.0), refZ(n, 0.0);
+    double              refEnergy = 0.0;
+
+    for (size_t i = 0; i < n; ++i)
+        for (size_t j = i + 1; j < n; ++j)
+        {
+            auto dx = x[i] - x[j];
+            auto dy = y[i] - y[j];
+            auto dz = z[i] - z[j];
+            dx     -= length * std::nearbyint(dx / length);
+            dy     -= length * std::nearbyint(dy / length);
+            dz     -= length * std::nearbyint(dz / length);
+
+            const auto r = std::sqrt(dx * dx + dy * dy + dz * dz);
+            if (r >= cutoff)
+                continue;
+
+            const mstd::StaticLJPotential<> pair(
+                table.coeff1(species[i], species[j]),
+                table.coeff2(species[i], species[j])
+            );
+            const auto [e, f] = pair.eval(r);
+
+            refEnergy += e - pair.evalEnergy(cutoff);
+            refX[i]   -= f * dx / r;
+            refY[i]   -= f * dy / r;
+            refZ[i]   -= f * dz / r;
+            refX[j]   += f * dx / r;
+            refY[j]   += f * dy / r;
+            refZ[j]   += f * dz / r;
+        }
+
+    std::vector<double> fx(n), fy(n), fz(n);
+
+    const auto requireReference = [&](const double energy)
+    {
+        REQUIRE(energy == Approx(refEnergy).epsilon(1e-10));
+        for (size_t i = 0; i < n; ++i)
+        {
+            REQUIRE(fx[i] == Approx(refX[i]).margin(1e-9));
+            REQUIRE(fy[i] == Approx(refY[i]).margin(1e-9));
+            REQUIRE(fz[i] == Approx(refZ[i]).margin(1e-9));
+        }
+    };
+
+    const mstd::AllPairs<> allPairs(box, cutoff);
+    mstd::VerletList<>     verletList(box, cutoff, 0.3);
+    verletList.update(x, y, z);
+
+    requireReference(mstd::computePairForces<PairKernelPath::Scalar>(
+        allPairs,
+        potential,
+        x,
+        y,
+        z,
+        fx,
+        fy,
+        fz
+    ));
+    requireReference(
+        mstd::computePairForces(verletList, potential, x, y, z, fx, fy, fz)
+    );
+
+    mstd::ParallelPairForces<> parallel(3);
+    requireReference(
+        parallel.compute(verletList, potential, x, y, z, fx, fy, fz)
+    );
+
+    std::vector<size_t> badSpecies{0, 3};
+    REQUIRE_THROWS_AS(
+        mstd::SpeciesPairPotential(table, badSpecies),
+        std::invalid_argument
+    );
+}
+
+TEST_CASE("SpeciesPairTable tail corrections", "[species]")
+{
+    SECTION("integrals match a numerical quadrature")
+    {
+        const mstd::SpeciesPairTable<5, 9> table(sigma, epsilon, cutoff);
+
+        for (size_t a = 0; a < 3; ++a)
+            for (size_t b = 0; b < 3; ++b)
+            {
+                const auto c1 = table.coeff1(a, b);
+                const auto c2 = table.coeff2(a, b);
+
+                const auto energy = [&](const double r)
+                {
+                    return r * r *
+                           (-c1 / std::pow(r, 5) + c2 / std::pow(r, 9));
+                };
+                const auto virial = [&](const double r)
+                {
+                    return r * r * r *
+                           (5 * c1 / std::pow(r, 6) - 9 * c2 / std::pow(r, 10));
+                };
+
+                REQUIRE(
+                    table.tailEnergyIntegral(a, b) ==
+                    Approx(tailIntegral(energy, cutoff)).epsilon(1e-10)
+                );
+                REQUIRE(
+                    table.tailVirialIntegral(a, b) ==
+                    Approx(tailIntegral(virial, cutoff)).epsilon(1e-10)
+                );
+            }
+    }
+
+    SECTION("a single species reproduces the Lennard-Jones corrections")
+    {
+        const std::vector<double> one{1.0};
+        const mstd::LJSpeciesPairTable<> table(one, one, cutoff);
+
+        const std::array<size_t, 1> counts{1000};
+        const double                volume  = 1250.0;
+        const double                density = 1000.0 / volume;
+        const double                sr3     = std::pow(1.0 / cutoff, 3);
+
+        const auto energy = 8.0 / 3.0 * std::numbers::pi * density *
+                            (std::pow(sr3, 3) / 3 - sr3) * 1000.0;
+        const auto pressure = 16.0 / 3.0 * std::numbers::pi * density *
+                              density * (2.0 / 3.0 * std::pow(sr3, 3) - sr3);
+
+        REQUIRE(table.tailEnergy(counts, volume) == Approx(energy));
+        REQUIRE(table.tailPressure(counts, volume) == Approx(pressure));
+    }
+
+    SECTION("mixtures sum over all species pairs")
+    {
+        mstd::LJSpeciesPairTable<> table(sigma, epsilon, cutoff);
+        table.setPair(0, 2, 0.9, 1.5, 2.0);
+
+        const std::array<size_t, 3> counts{300, 500, 200};
+        const double                volume = 900.0;
+
+        double energy   = 0.0;
+        double pressure = 0.0;
+        for (size_t a = 0; a < 3; ++a)
+            for (size_t b = 0; b < 3; ++b)
+            {
+                const auto pairs = double(counts[a]) * double(counts[b]);
+                const auto rc    = table.cutoff(a, b);
+
+                energy += pairs * mstd::lieTailEnergyIntegral<6, 12>(
+                                      table.coeff1(a, b),
+                                      table.coeff2(a, b),
+                                      rc
+                                  );
+                pressure += pairs * mstd::lieTailVirialIntegral<6, 12>(
+                                        table.coeff1(a, b),
+                                        table.coeff2(a, b),
+                                        rc
+                                    );
+            }
+
+        energy *= 2 * std::numbers::pi / volume;
+        pressure *= -2 * std::numbers::pi / (3 * volume * volume);
+
+        REQUIRE(table.tailEnergy(counts, volume) == Approx(energy));
+        REQUIRE(table.tailPressure(counts, volume) == Approx(pressure));
+        REQUIRE(
+            table.tailEnergyIntegral(2, 0) != table.tailEnergyIntegral(1, 0)
+        );
+    }
+}
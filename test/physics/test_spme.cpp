@@ -0,0 +1,239 @@
+/*****************************************************************************
+<GPL_HEADER>
+
+    mstd library
+    Copyright (C) 2025-now  Jakob Gamper
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+<GPL_HEADER>
+******************************************************************************/
+
+#include <array>
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <cmath>
+#include <cstddef>
+#include <random>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+#include "mstd/physics/all_pairs.hpp"
+#include "mstd/physics/box.hpp"
+#include "mstd/physics/ewald.hpp"
+#include "mstd/physics/pair_forces.hpp"
+#include "mstd/physics/potentials/charged_pair_potential.hpp"
+#include "mstd/physics/spme.hpp"
+
+namespace
+{
+    using Catch::Approx;
+
+    /// random neutral configuration of n particles in a cube of edge length
+    struct Configuration
+    {
+        std::vector<double> x, y, z, charges;
+
+        Configuration(const size_t n, const double length)
+        {
+            std::mt19937_64                        engine(17);
+            std::uniform_real_distribution<double> uniform(0.0, length);
+
+            for (size_t i = 0; i < n; ++i)
+            {
+                x.push_back(uniform(engine));
+                y.push_back(uniform(engine));
+                z.push_back(uniform(engine));
+                charges.push_back(i % 2 == 0 ? 1.0 : -1.0);
+            }
+        }
+    };
+
+    /// SPME against the direct reciprocal sum for one box and thread count
+    template <typename Box>
+    void requireDirectEwald(const Box& box, const size_t nThreads)
+    {
+        constexpr double coeff = 1.5;
+        constexpr double alpha = 0.35;
+
+        const Configuration config(60, 12.0);
+        const auto          n = config.x.size();
+
+        mstd::SmoothParticleMeshEwald<double, Box>
+            spme(box, coeff, alpha, {32, 32, 32}, 6, nThreads);
+
+        std::vector<double> fx(n), fy(n), fz(n);
+        std::vector<double> refX(n), refY(n), refZ(n);
+
+        const double energy = spme.compute(
+            config.x,
+            config.y,
+            config.z,
+            config.charges,
+            fx,
+            fy,
+            fz
+        );
+
+        const double reference = mstd::computeEwaldReciprocal(
+            box,
+            coeff,
+            alpha,
+            14,
+            std::span<const double>(config.x),
+            std::span<const double>(config.y),
+            std::span<const double>(config.z),
+            std::span<const double>(config.charges),
+            std::span<double>(refX),
+            std::span<double>(refY),
+            std::span<double>(refZ)
+        );
+
+        REQUIRE(energy == Approx(reference).epsilon(1e-6));
+        for (size_t i = 0; i < n; ++i)
+        {
+            REQUIRE(fx[i] == Approx(refX[i]).margin(1e-6));
+            REQUIRE(fy[i] == Approx(refY[i]).margin(1e-6));
+            REQUIRE(fz[i] == Approx(refZ[i]).margin(1e-6));
+        }
+    }
+
+}   // namespace
+
+TEST_CASE("B-spline weights form a partition of unity", "[spme]")
+{
+    for (const size_t order : std::vector<size_t>{3, 4, 6})
+        for (const double w : {0.0, 0.25, 0.5, 0.9})
+        {
+            constexpr double h = 1e-6;
+
+            std::vector<double> theta(order), dtheta(order);
+            std::vector<double> plus(order), minus(order), unused(order);
+
+            mstd::details::bsplineWeights(
+                w,
+                order,
+                theta.data(),
+                dtheta.data()
+            );
+            mstd::details::bsplineWeights(
+                w + h,
+                order,
+                plus.data(),
+                unused.data()
+            );
+            mstd::details::bsplineWeights(
+                w - h,
+                order,
+                minus.data(),
+                unused.data()
+            );
+
+            double sum = 0.0, dsum = 0.0;
+            for (size_t i = 0; i < order; ++i)
+            {
+                sum  += theta[i];
+                dsum += dtheta[i];
+
+                REQUIRE(theta[i] >= 0.0);
+                REQUIRE(
+                    dtheta[i] ==
+                    Approx((plus[i] - minus[i]) / (2 * h)).margin(1e-8)
+                );
+            }
+
+            REQUIRE(sum == Approx(1.0));
+            REQUIRE(dsum == Approx(0.0).margin(1e-14));
+        }
+}
+
+TEST_CASE("SPME matches the direct Ewald reciprocal sum", "[spme]")
+{
+    const mstd::OrthorhombicBox<> cube(12.0, 12.0, 12.0);
+    const mstd::TriclinicBox<>    sheared(12.0, 12.0, 12.0, 2.0, 1.0, -1.5);
+
+    requireDirectEwald(cube, 1);
+    requireDirectEwald(cube, 3);
+    requireDirectEwald(sheared, 1);
+    requireDirectEwald(sheared, 4);
+
+    REQUIRE_THROWS_AS(
+        mstd::SmoothParticleMeshEwald<>(cube, 1.0, 0.0, {16, 16, 16}),
+        std::invalid_argument
+    );
+    REQUIRE_THROWS_AS(
+        mstd::SmoothParticleMeshEwald<>(cube, 1.0, 0.3, {16, 16, 16}, 2),
+        std::invalid_argument
+    );
+    REQUIRE_THROWS_AS(
+        mstd::SmoothParticleMeshEwald<>(cube, 1.0, 0.3, {16, 16, 4}, 6),
+        std::invalid_argument
+    );
+}
+
+TEST_CASE("Ewald summation reproduces the NaCl Madelung constant", "[spme]")
+{
+    // rock salt with nearest neighbour distance 1
+    constexpr size_t perSide = 8;
+    constexpr double length  = perSide;
+    constexpr double cutoff  = 3.5;
+
+    std::vector<double> x, y, z, charges;
+    for (size_t ix = 0; ix < perSide; ++ix)
+        for (size_t iy = 0; iy < perSide; ++iy)
+            for (size_t iz = 0; iz < perSide; ++iz)
+            {
+                x.push_back(static_cast<double>(ix));
+                y.push_back(static_cast<double>(iy));
+                z.push_back(static_cast<double>(iz));
+                charges.push_back((ix + iy + iz) % 2 == 0 ? 1.0 : -1.0);
+            }
+
+    const auto n = x.size();
+
+    const mstd::OrthorhombicBox<> box(length, length, length);
+
+    const double alpha = mstd::ewaldSplittingParameter(cutoff, 1e-8);
+    REQUIRE(std::erfc(alpha * cutoff) == Approx(1e-8).epsilon(1e-6));
+
+    mstd::SmoothParticleMeshEwald<> spme(box, 1.0, alpha, {32, 32, 32}, 6, 2);
+
+    const mstd::ChargedPairPotential realSpace(
+        spme.realSpacePotential(),
+        charges
+    );
+    const mstd::AllPairs<> pairs(box, cutoff);
+
+    std::vector<double> fx(n), fy(n), fz(n);
+
+    double energy =
+        mstd::computePairForces(pairs, realSpace, x, y, z, fx, fy, fz);
+    energy += spme.compute(x, y, z, charges, fx, fy, fz);
+    energy += spme.selfEnergy(charges);
+
+    REQUIRE(spme.neutralizingEnergy(charges) == 0.0);
+
+    // E = -M N / 2 for unit charges and distance
+    const double madelung = -2 * energy / static_cast<double>(n);
+    REQUIRE(madelung == Approx(1.747564594633).epsilon(1e-7));
+
+    // every ion of the perfect lattice is in equilibrium
+    for (size_t i = 0; i < n; ++i)
+    {
+        REQUIRE(fx[i] == Approx(0.0).margin(1e-6));
+        REQUIRE(fy[i] == Approx(0.0).margin(1e-6));
+        REQUIRE(fz[i] == Approx(0.0).margin(1e-6));
+    }
+}
@@ -0,0 +1,290 @@
+/*****************************************************************************
+<GPL_HEADER>
+
+    mstd library
+    Copyright (C) 2025-now  Jakob Gamper
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+<GPL_HEADER>
+******************************************************************************/
+
+#include <array>
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <utility>
+#include <vector>
+
+#include "mstd/physics/potentials/any_potential.hpp"
+#include "mstd/physics/potentials/lie_potential.hpp"
+#include "mstd/physics/potentials/static_lie_potential.hpp"
+#include "mstd/simd.hpp"
+
+TEST_CASE(
+    "Static Lie potentials match their virtual counterparts",
+    "[static_potential]"
+)
+{
+    using mstd::LiePotential;
+    using mstd::LJForceSwitchedPotential;
+    using mstd::LJShiftedPotential;
+    using mstd::StaticLiePotential;
+    using mstd::StaticLJForceSwitchedPotential;
+    using mstd::StaticLJShiftedPotential;
+
+    STATIC_REQUIRE(mstd::is_pair_potential_v<LiePotential<4, 8>>);
+    STATIC_REQUIRE(mstd::is_pair_potential_v<StaticLiePotential<4, 8>>);
+    STATIC_REQUIRE(mstd::is_pair_potential_v<StaticLJShiftedPotential<>>);
+    STATIC_REQUIRE(!std::is_polymorphic_v<StaticLJShiftedPotential<>>);
+
+    const LiePotential<4, 8>       virtualPotential(2.0, 0.75);
+    const StaticLiePotential<4, 8> staticPotential(2.0, 0.75);
+
+    const LJShiftedPotential<>       virtualShifted(1.0, 0.5, 2.5);
+    const StaticLJShiftedPotential<> staticShifted(1.0, 0.5, 2.5);
+
+    const mstd::LJSwitchedPotential<>       virtualSwitched(1.0, 0.5, 2.0, 2.5);
+    const mstd::StaticLJSwitchedPotential<> staticSwitched(1.0, 0.5, 2.0, 2.5);
+
+    const LJForceSwitchedPotential<>       virtualFSwitched(1.0, 0.5, 2.0, 2.5);
+    const StaticLJForceSwitchedPotential<> staticFSwitched(1.0, 0.5, 2.0, 2.5);
+
+    const std::array<double, 4> radii{0.75, 1.5, 2.2, 2.5};
+
+    for (const double r : radii)
+    {
+        REQUIRE(
+            staticPotential.evalEnergy(r) ==
+            Catch::Approx(virtualPotential.evalEnergy(r))
+        );
+        REQUIRE(
+            staticPotential.evalForce(r) ==
+            Catch::Approx(virtualPotential.evalForce(r))
+        );
+
+        REQUIRE(
+            staticSwitched.evalEnergy(r) ==
+            Catch::Approx(virtualSwitched.evalEnergy(r)).margin(1e-12)
+        );
+        REQUIRE(
+            staticSwitched.evalForce(r) ==
+            Catch::Approx(virtualSwitched.evalForce(r)).margin(1e-12)
+        );
+
+        REQUIRE(
+            staticFSwitched.evalEnergy(r) ==
+            Catch::Approx(virtualFSwitched.evalEnergy(r)).margin(1e-12)
+        );
+        REQUIRE(
+            staticFSwitched.evalForce(r) ==
+            Catch::Approx(virtualFSwitched.evalForce(r)).margin(1e-12)
+        );
+
+        const auto [energy, force] = staticShifted.eval(r);
+        REQUIRE(
+            energy == Catch::Approx(virtualShifted.evalEnergy(r)).margin(1e-12)
+        );
+        REQUIRE(
+            force == Catch::Approx(virtualShifted.evalForce(r)).margin(1e-12)
+        );
+    }
+}
+
+TEST_CASE(
+    "Static Lie potentials are usable in constant expressions",
+    "[static_potential]"
+)
+{
+    constexpr mstd::StaticLJShiftedPotential<> potential(1.0, 0.5, 2.0);
+    constexpr auto                             atCutoff = potential.eval(2.0);
+
+    STATIC_REQUIRE(atCutoff.first == 0.0);
+    STATIC_REQUIRE(atCutoff.second == 0.0);
+}
+
+TEST_CASE(
+    "Static Lie potentials evaluate SIMD lanes",
+    "[static_potential]"
+)
+{
+    using V = mstd::SimdVec<double>;
+
+    const mstd::StaticLJShiftedPotential<> potential(1.0, 0.5, 2.5);
+
+    V r{};
+    for (size_t i = 0; i < mstd::simd_size_v<V>; ++i)
+        r[i] = 0.9 + 0.2 * static_cast<double>(i);
+
+    const auto [energy, force] = potential.eval<V>(r);
+
+    for (size_t i = 0; i < mstd::simd_size_v<V>; ++i)
+    {
+        const auto [e, f] = potential.eval(r[i]);
+        REQUIRE(energy[i] == Catch::Approx(e).margin(1e-12));
+        REQUIRE(force[i] == Catch::Approx(f).margin(1e-12));
+    }
+}
+
+TEST_CASE(
+    "Static Lie potentials evaluate from squared distances",
+    "[static_potential]"
+)
+{
+    using V = mstd::SimdVec<double>;
+
+    const mstd::StaticLiePotential<4, 8>   even(2.0, 0.75);
+    const mstd::StaticLiePotential<5, 9>   odd(1.5, 0.25);
+    const mstd::StaticLJShiftedPotential<> shifted(1.0, 0.5, 2.5);
+
+    const auto check = [](const auto& potential)
+    {
+        V r2{};
+        for (size_t i = 0; i < mstd::simd_size_v<V>; ++i)
+        {
+            const double r = 0.9 + 0.2 * static_cast<double>(i);
+            r2[i]          = r * r;
+
+            const auto [energy, force] = potential.eval(r);
+            const auto [e, fOverR]     = potential.evalFromR2(r * r);
+            REQUIRE(e == Catch::Approx(energy).margin(1e-12));
+            REQUIRE(fOverR == Catch::Approx(force / r).margin(1e-12));
+        }
+
+        const auto [energies, forcesOverR] =
+            potential.template evalFromR2<V>(r2);
+
+        for (size_t i = 0; i < mstd::simd_size_v<V>; ++i)
+        {
+            const auto [e, fOverR] = potential.evalFromR2(r2[i]);
+            REQUIRE(energies[i] == Catch::Approx(e).margin(1e-12));
+            REQUIRE(forcesOverR[i] == Catch::Approx(fOverR).margin(1e-12));
+        }
+    };
+
+    check(even);
+    check(odd);
+    check(shifted);
+    check(mstd::StaticLJSwitchedPotential<>(1.0, 0.5, 2.0, 2.5));
+    check(mstd::StaticLJForceSwitchedPotential<>(1.0, 0.5, 2.0, 2.5));
+}
+
+TEST_CASE(
+    "AnyPotential wraps static and virtual potentials",
+    "[static_potential]"
+)
+{
+    using mstd::AnyPotential;
+
+    STATIC_REQUIRE(mstd::is_pair_potential_v<AnyPotential<>>);
+
+    const mstd::StaticLJShiftedPotential<> staticShifted(1.0, 0.5, 2.5);
+    const mstd::LiePotential<4, 8>         virtualPotential(2.0, 0.75);
+
+    AnyPotential<> shifted = staticShifted;
+    AnyPotential<> lie     = virtualPotential;
+
+    REQUIRE(
+        shifted.evalEnergy(1.2) ==
+        Catch::Approx(staticShifted.evalEnergy(1.2))
+    );
+    REQUIRE(
+        shifted.evalForce(1.2) == Catch::Approx(staticShifted.evalForce(1.2))
+    );
+    REQUIRE(
+        lie.eval(1.2).first == Catch::Approx(virtualPotential.eval(1.2).first)
+    );
+
+    // copies are deep and keep the wrapped potential
+    AnyPotential<> copy = shifted;
+    copy                = lie;
+    REQUIRE(
+        copy.evalEnergy(1.7) ==
+        Catch::Approx(virtualPotential.evalEnergy(1.7))
+    );
+    REQUIRE(
+        shifted.evalEnergy(1.7) ==
+        Catch::Approx(staticShifted.evalEnergy(1.7))
+    );
+
+    // moved-from potentials can still be copied and reassigned
+    const AnyPotential<> moved = std::move(copy);
+    AnyPotential<>       empty = copy;   // NOLINT(bugprone-use-after-move)
+    empty                      = copy;   // NOLINT(bugprone-use-after-move)
+    empty                      = moved;
+    REQUIRE(
+        empty.evalEnergy(1.7) ==
+        Catch::Approx(virtualPotential.evalEnergy(1.7))
+    );
+
+    std::vector<double> radii{0.9, 1.1, 1.3, 1.7, 2.1, 2.4, 2.5};
+    std::vector<double> energies(radii.size());
+    std::vector<double> forces(radii.size());
+
+    shifted.evalBatch(radii, energies, forces);
+
+    for (size_t i = 0; i < radii.size(); ++i)
+    {
+        const auto [energy, force] = staticShifted.eval(radii[i]);
+        REQUIRE(energies[i] == Catch::Approx(energy).margin(1e-12));
+        REQUIRE(forces[i] == Catch::Approx(force).margin(1e-12));
+
+        const auto [e, fOverR] = shifted.evalFromR2(radii[i] * radii[i]);
+        REQUIRE(e == Catch::Approx(energy).margin(1e-12));
+        REQUIRE(fOverR == Catch::Approx(force / radii[i]).margin(1e-12));
+    }
+}
+
+TEST_CASE(
+    "energyFromR2 matches the energy of evalFromR2",
+    "[static_potential]"
+)
+{
+    using mstd::SimdVec;
+
+    STATIC_REQUIRE(mstd::is_energy_pair_potential_v<mstd::LJPotential<>>);
+    STATIC_REQUIRE(
+        mstd::is_energy_pair_potential_v<mstd::StaticLJShiftedPotential<>>
+    );
+    STATIC_REQUIRE(!mstd::is_energy_pair_potential_v<mstd::AnyPotential<>>);
+
+    const auto check = [](const auto& potential)
+    {
+        for (const double r : {0.9, 1.1, 1.3, 1.7, 2.1, 2.4})
+            REQUIRE(
+                potential.energyFromR2(r * r) ==
+                Catch::Approx(potential.evalFromR2(r * r).first)
+                    .margin(1e-12)
+            );
+    };
+
+    check(mstd::LiePotential<4, 8>(2.0, 0.75));
+    check(mstd::LiePotential<3, 7>(2.0, 0.75));
+    check(mstd::LJShiftedPotential<>(1.0, 0.5, 2.5));
+    check(mstd::LJSwitchedPotential<>(1.0, 0.5, 2.0, 2.5));
+    check(mstd::LJForceSwitchedPotential<>(1.0, 0.5, 2.0, 2.5));
+    check(mstd::StaticLiePotential<4, 8>(2.0, 0.75));
+    check(mstd::StaticLiePotential<3, 7>(2.0, 0.75));
+    check(mstd::StaticLJShiftedPotential<>(1.0, 0.5, 2.5));
+    check(mstd::StaticLJSwitchedPotential<>(1.0, 0.5, 2.0, 2.5));
+    check(mstd::StaticLJForceSwitchedPotential<>(1.0, 0.5, 2.0, 2.5));
+
+    // lane-generic like evalFromR2
+    using V = SimdVec<double>;
+
+    const mstd::StaticLJShiftedPotential<> shifted(1.0, 0.5, 2.5);
+    const auto energies = shifted.energyFromR2<V>(mstd::simdBroadcast<V>(1.69));
+
+    for (size_t l = 0; l < mstd::simd_size_v<V>; ++l)
+        REQUIRE(energies[l] == Catch::Approx(shifted.energyFromR2(1.69)));
+}
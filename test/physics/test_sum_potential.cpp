@@ -0,0 +1,230 @@
+/*****************************************************************************
+<GPL_HEADER>
+
+    mstd library
+    Copyright (C) 2025-now  Jakob Gamper
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+<GPL_HEADER>
+******************************************************************************/
+
+#include <array>
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <cmath>
+#include <cstddef>
+#include <random>
+#include <vector>
+
+#include "mstd/physics/pair_forces.hpp"
+#include "mstd/physics/potentials/charged_pair_potential.hpp"
+#include "mstd/physics/potentials/coulomb_potential.hpp"
+#include "mstd/physics/potentials/exponential_potential.hpp"
+#include "mstd/physics/potentials/pair_distance.hpp"
+#include "mstd/physics/potentials/static_lie_potential.hpp"
+#include "mstd/physics/potentials/sum_potential.hpp"
+#include "mstd/physics/verlet_list.hpp"
+#include "mstd/simd.hpp"
+#include "mstd/type_traits/physics_traits.hpp"
+
+namespace
+{
+    using Catch::Approx;
+
+    constexpr double cutoff = 2.5;
+
+    /// evalFromDistance agrees with evalFromR2 for scalars and lanes
+    template <typename P>
+    void requireSharedDistance(const P& potential)
+    {
+        using V = mstd::SimdVec<double>;
+
+        V r2{};
+        for (size_t i = 0; i < mstd::simd_size_v<V>; ++i)
+            r2[i] = 0.8 + 0.55 * static_cast<double>(i);
+
+        const auto [e, f] = potential.template evalFromDistance<V>(
+            mstd::PairDistance<V>::fromR2(r2)
+        );
+
+        for (size_t i = 0; i < mstd::simd_size_v<V>; ++i)
+        {
+            const auto [energy, forceOverR] = potential.evalFromR2(r2[i]);
+            const auto [eScalar, fScalar]   = potential.evalFromDistance(
+                mstd::PairDistance<double>::fromR(std::sqrt(r2[i]))
+            );
+
+            REQUIRE(e[i] == Approx(energy).epsilon(1e-13));
+            REQUIRE(f[i] == Approx(forceOverR).epsilon(1e-13));
+            REQUIRE(eScalar == Approx(energy).epsilon(1e-13));
+            REQUIRE(fScalar == Approx(forceOverR).epsilon(1e-13));
+        }
+    }
+
+}   // namespace
+
+TEST_CASE("potentials evaluate from shared distance powers", "[sum]")
+{
+    requireSharedDistance(mstd::StaticLJPotential<>(1.0, 1.0));
+    requireSharedDistance(mstd::StaticLiePotential<5, 9>(1.0, 1.0));
+    requireSharedDistance(mstd::StaticLJShiftedPotential<>(1.0, 1.0, cutoff));
+    requireSharedDistance(
+        mstd::StaticLJSwitchedPotential<>(1.0, 1.0, 2.0, cutoff)
+    );
+    requireSharedDistance(mstd::CoulombPotential<>(2.0));
+    requireSharedDistance(mstd::CoulombShiftedPotential<>(2.0, cutoff));
+    requireSharedDistance(
+        mstd::CoulombReactionFieldPotential<>(2.0, cutoff, 78.0)
+    );
+    requireSharedDistance(mstd::CoulombEwaldPotential<>(2.0, 0.4));
+    requireSharedDistance(mstd::CoulombDSFPotential<>(2.0, 0.3, cutoff));
+    requireSharedDistance(mstd::CoulombWolfPotential<>(2.0, 0.3, cutoff));
+    requireSharedDistance(mstd::MorsePotential<>(1.0, 2.0, 1.1));
+    requireSharedDistance(mstd::BuckinghamPotential<>(100.0, 0.3, 1.0));
+    requireSharedDistance(
+        mstd::BuckinghamShiftedPotential<>(100.0, 0.3, 1.0, cutoff)
+    );
+}
+
+TEST_CASE("SumPotential adds its terms", "[sum]")
+{
+    using V = mstd::SimdVec<double>;
+
+    const mstd::StaticLJShiftedPotential<>      lj(1.0, 1.0, cutoff);
+    const mstd::CoulombReactionFieldPotential<> rf(2.0, cutoff, 78.0);
+    const mstd::BornMayerShiftedPotential<>     correction(50.0, 0.2, cutoff);
+
+    const mstd::SumPotential sum(lj, rf, correction);
+
+    STATIC_REQUIRE(decltype(sum)::size() == 3);
+    STATIC_REQUIRE(mstd::is_pair_potential_v<decltype(sum)>);
+
+    REQUIRE(
+        sum.term<1>().reactionFieldConstant() == rf.reactionFieldConstant()
+    );
+
+    std::vector<double> r2(2 * mstd::simd_size_v<V> + 3);
+    for (size_t i = 0; i < r2.size(); ++i)
+        r2[i] = 0.9 + 0.3 * static_cast<double>(i);
+
+    std::vector<double> energies(r2.size()), forcesOverR(r2.size());
+    sum.evalBatchFromR2(r2, energies, forcesOverR);
+
+    for (size_t i = 0; i < r2.size(); ++i)
+    {
+        const auto r = std::sqrt(r2[i]);
+
+        const double energy = lj.evalEnergy(r) + rf.evalEnergy(r) +
+                              correction.evalEnergy(r);
+        const double force =
+            lj.evalForce(r) + rf.evalForce(r) + correction.evalForce(r);
+
+        // terms cancel partially, so compare with an absolute margin
+        REQUIRE(sum.evalEnergy(r) == Approx(energy).margin(1e-13));
+        REQUIRE(sum.evalForce(r) == Approx(force).margin(1e-13));
+        REQUIRE(energies[i] == Approx(energy).margin(1e-13));
+        REQUIRE(forcesOverR[i] == Approx(force / r).margin(1e-13));
+    }
+
+    // nesting flattens to the same result
+    const mstd::SumPotential nested(mstd::SumPotential(lj, rf), correction);
+
+    for (const double r : {0.95, 1.3, 2.2})
+    {
+        REQUIRE(nested.evalEnergy(r) == Approx(sum.evalEnergy(r)));
+        REQUIRE(nested.evalForce(r) == Approx(sum.evalForce(r)));
+    }
+}
+
+TEST_CASE("SumPotential runs in a single pair kernel pass", "[sum]")
+{
+    constexpr size_t perSide = 6;
+    constexpr double spacing = 1.1;
+    constexpr double length  = perSide * spacing;
+
+    const std::array<double, 3> box{length, length, length};
+
+    std::mt19937_64                        engine(23);
+    std::uniform_real_distribution<double> jitter(-0.1, 0.1);
+
+    std::vector<double> x, y, z, charges;
+    for (size_t ix = 0; ix < perSide; ++ix)
+        for (size_t iy = 0; iy < perSide; ++iy)
+            for (size_t iz = 0; iz < perSide; ++iz)
+            {
+                x.push_back(spacing * static_cast<double>(ix) + jitter(engine));
+                y.push_back(spacing * static_cast<double>(iy) + jitter(engine));
+                z.push_back(spacing * static_cast<double>(iz) + jitter(engine));
+                charges.push_back((ix + iy + iz) % 2 == 0 ? 0.5 : -0.5);
+            }
+
+    const auto n = x.size();
+
+    const mstd::StaticLJShiftedPotential<> lj(1.0, 1.0, cutoff);
+    const mstd::MorseShiftedPotential<>    morse(0.2, 2.0, 1.2, cutoff);
+    const mstd::CoulombDSFPotential<>      dsf(1.0, 0.3, cutoff);
+
+    mstd::VerletList<> verletList(box, cutoff, 0.3);
+    verletList.update(x, y, z);
+
+    std::vector<double> fx(n), fy(n), fz(n);
+    std::vector<double> refX(n), refY(n), refZ(n);
+
+    const auto accumulate = [&](const auto& potential)
+    {
+        const auto energy = mstd::computePairForces(
+            verletList,
+            potential,
+            x,
+            y,
+            z,
+            fx,
+            fy,
+            fz
+        );
+
+        for (size_t i = 0; i < n; ++i)
+        {
+            refX[i] += fx[i];
+            refY[i] += fy[i];
+            refZ[i] += fz[i];
+        }
+
+        return energy;
+    };
+
+    // separate passes as reference
+    const mstd::ChargedPairPotential coulomb(dsf, charges);
+
+    const double reference =
+        accumulate(lj) + accumulate(morse) + accumulate(coulomb);
+
+    const mstd::ChargedPairPotential fused(
+        dsf,
+        charges,
+        mstd::SumPotential(lj, morse)
+    );
+
+    const double energy =
+        mstd::computePairForces(verletList, fused, x, y, z, fx, fy, fz);
+
+    REQUIRE(energy == Approx(reference).epsilon(1e-12));
+    for (size_t i = 0; i < n; ++i)
+    {
+        REQUIRE(fx[i] == Approx(refX[i]).margin(1e-10));
+        REQUIRE(fy[i] == Approx(refY[i]).margin(1e-10));
+        REQUIRE(fz[i] == Approx(refZ[i]).margin(1e-10));
+    }
+}
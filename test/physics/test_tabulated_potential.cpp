@@ -0,0 +1,231 @@
+/*****************************************************************************
+<GPL_HEADER>
+
+    mstd library
+    Copyright (C) 2025-now  Jakob Gamper
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+<GPL_HEADER>
+******************************************************************************/
+
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <stdexcept>
+#include <vector>
+
+#include "mstd/physics/potentials/lie_potential.hpp"
+#include "mstd/physics/potentials/static_lie_potential.hpp"
+#include "mstd/physics/potentials/tabulated_potential.hpp"
+#include "mstd/simd.hpp"
+
+TEST_CASE(
+    "TabulatedPotential reproduces the analytic potential",
+    "[tabulated_potential]"
+)
+{
+    using mstd::TableSpacing;
+    using mstd::TabulatedPotential;
+
+    const mstd::LJShiftedPotential<> potential(1.0, 1.0, 2.5);
+
+    const TabulatedPotential<double, TableSpacing::R2> tableR2(
+        potential,
+        0.8,
+        2.5,
+        4096
+    );
+    const TabulatedPotential<double, TableSpacing::R> tableR(
+        potential,
+        0.8,
+        2.5,
+        4096
+    );
+
+    STATIC_REQUIRE(mstd::is_pair_potential_v<decltype(tableR2)>);
+
+    REQUIRE(tableR2.size() == 4096);
+    REQUIRE(tableR2.memoryBytes() == 4096 * 4 * sizeof(double));
+    REQUIRE(tableR2.maxEnergyError() < 1e-6);
+    REQUIRE(tableR2.maxForceError() < 1e-4);
+    REQUIRE(tableR.maxError() < 1e-4);
+
+    for (double r = 0.85; r < 2.5; r += 0.0137)
+    {
+        const auto [energy, force] = potential.eval(r);
+
+        for (const auto& [e, f] : {tableR2.eval(r), tableR.eval(r)})
+        {
+            REQUIRE(e == Catch::Approx(energy).margin(1e-6));
+            REQUIRE(f == Catch::Approx(force).margin(1e-4));
+        }
+
+        const auto [e2, fOverR] = tableR2.evalFromR2(r * r);
+        REQUIRE(e2 == Catch::Approx(energy).margin(1e-6));
+        REQUIRE(fOverR == Catch::Approx(force / r).margin(1e-4));
+    }
+
+    // nodes are exact
+    REQUIRE(tableR.evalEnergy(0.8) == Catch::Approx(potential.evalEnergy(0.8)));
+
+    // zero at and beyond the cutoff
+    REQUIRE(tableR2.eval(2.5) == std::pair{0.0, 0.0});
+    REQUIRE(tableR2.eval(3.0) == std::pair{0.0, 0.0});
+    REQUIRE(tableR.evalFromR2(9.0) == std::pair{0.0, 0.0});
+}
+
+TEST_CASE(
+    "TabulatedPotential evaluates SIMD lanes and batches",
+    "[tabulated_potential]"
+)
+{
+    using V = mstd::SimdVec<double>;
+
+    const mstd::StaticLiePotential<5, 9> potential(1.5, 0.25);
+    const mstd::TabulatedPotential<>     table(potential, 0.7, 3.0, 2048);
+
+    V r2{};
+    for (size_t i = 0; i < mstd::simd_size_v<V>; ++i)
+    {
+        const auto r = 0.75 + 0.4 * static_cast<double>(i);
+        r2[i]        = r * r;
+    }
+
+    const auto [energies, forcesOverR] = table.evalFromR2<V>(r2);
+
+    for (size_t i = 0; i < mstd::simd_size_v<V>; ++i)
+    {
+        const auto [e, fOverR] = table.evalFromR2(r2[i]);
+        REQUIRE(energies[i] == Catch::Approx(e).margin(1e-12));
+        REQUIRE(forcesOverR[i] == Catch::Approx(fOverR).margin(1e-12));
+    }
+
+    std::vector<double> radii{0.7, 0.9, 1.3, 1.9, 2.6, 2.99, 3.0, 3.5, 4.0};
+    std::vector<double> energy(radii.size());
+    std::vector<double> force(radii.size());
+
+    table.evalBatch(radii, energy, force);
+
+    for (size_t i = 0; i < radii.size(); ++i)
+    {
+        const auto [e, f] = table.eval(radii[i]);
+        REQUIRE(energy[i] == Catch::Approx(e).margin(1e-12));
+        REQUIRE(force[i] == Catch::Approx(f).margin(1e-12));
+    }
+}
+
+TEST_CASE(
+    "TabulatedPotential picks the table size from a tolerance",
+    "[tabulated_potential]"
+)
+{
+    using mstd::TabulatedPotential;
+
+    const mstd::StaticLJShiftedPotential<> potential(1.0, 1.0, 2.5);
+
+    const auto coarse =
+        TabulatedPotential<>::withTolerance(potential, 0.9, 2.5, 1e-3);
+    const auto fine =
+        TabulatedPotential<>::withTolerance(potential, 0.9, 2.5, 1e-6);
+
+    REQUIRE(coarse.maxError() <= 1e-3);
+    REQUIRE(fine.maxError() <= 1e-6);
+    REQUIRE(fine.size() > coarse.size());
+
+    REQUIRE_THROWS_AS(
+        TabulatedPotential<>::withTolerance(potential, 0.9, 2.5, 1e-14, 256),
+        std::runtime_error
+    );
+    REQUIRE_THROWS_AS(
+        TabulatedPotential<>(potential, 2.5, 0.9, 128),
+        std::invalid_argument
+    );
+    REQUIRE_THROWS_AS(
+        TabulatedPotential<>(potential, 0.9, 2.5, 0),
+        std::invalid_argument
+    );
+}
+
+TEST_CASE(
+    "tabulateLiePotential builds the table at compile time",
+    "[tabulated_potential]"
+)
+{
+    using mstd::TableSpacing;
+    using mstd::TabulatedPotential;
+    using V = mstd::SimdVec<double>;
+
+    static constexpr auto table =
+        mstd::tabulateLiePotential<6, 12, 1024>(1.0, 1.0, 0.8, 2.5);
+    static constexpr auto tableR =
+        mstd::tabulateLiePotential<5, 9, 512, TableSpacing::R>(
+            1.5,
+            0.25,
+            0.7,
+            3.0
+        );
+
+    STATIC_REQUIRE(table.size() == 1024);
+    STATIC_REQUIRE(table.memoryBytes() == sizeof(double) * 4 * 1024);
+    STATIC_REQUIRE(table.maxError() < 1e-3);
+    STATIC_REQUIRE(table.evalEnergy(2.6) == 0.0);
+    STATIC_REQUIRE(mstd::is_pair_potential_v<decltype(table)>);
+
+    const mstd::StaticLJShiftedPotential<>      lj(1.0, 1.0, 2.5);
+    const mstd::StaticLieShiftedPotential<5, 9> lie(1.5, 0.25, 3.0);
+
+    const TabulatedPotential<> runtime(lj, 0.8, 2.5, 1024);
+    const TabulatedPotential<double, TableSpacing::R> runtimeR(
+        lie,
+        0.7,
+        3.0,
+        512
+    );
+
+    REQUIRE(table.spacing() == Catch::Approx(runtime.spacing()));
+    REQUIRE(
+        table.maxEnergyError() ==
+        Catch::Approx(runtime.maxEnergyError()).epsilon(1e-6)
+    );
+    REQUIRE(
+        tableR.maxForceError() ==
+        Catch::Approx(runtimeR.maxForceError()).epsilon(1e-6)
+    );
+
+    for (double r = 0.75; r < 3.2; r += 0.0173)
+    {
+        const auto [e, f]   = table.eval(r);
+        const auto [re, rf] = runtime.eval(r);
+        REQUIRE(e == Catch::Approx(re).margin(1e-12));
+        REQUIRE(f == Catch::Approx(rf).margin(1e-12));
+
+        const auto [eR, fOverR]   = tableR.evalFromR2(r * r);
+        const auto [reR, rfOverR] = runtimeR.evalFromR2(r * r);
+        REQUIRE(eR == Catch::Approx(reR).margin(1e-12));
+        REQUIRE(fOverR == Catch::Approx(rfOverR).margin(1e-12));
+    }
+
+    V r2{};
+    for (size_t i = 0; i < mstd::simd_size_v<V>; ++i)
+        r2[i] = 0.9 + 0.5 * static_cast<double>(i);
+
+    const auto [energies, forcesOverR] = table.evalFromR2<V>(r2);
+
+    for (size_t i = 0; i < mstd::simd_size_v<V>; ++i)
+    {
+        const auto [e, fOverR] = table.evalFromR2(r2[i]);
+        REQUIRE(energies[i] == Catch::Approx(e).margin(1e-12));
+        REQUIRE(forcesOverR[i] == Catch::Approx(fOverR).margin(1e-12));
+    }
+}
@@ -0,0 +1,185 @@
+/*****************************************************************************
+<GPL_HEADER>
+
+    mstd library
+    Copyright (C) 2025-now  Jakob Gamper
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+<GPL_HEADER>
+******************************************************************************/
+
+#include <algorithm>
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+#include "mstd/physics/particles.hpp"
+#include "mstd/physics/thermostat.hpp"
+#include "test_utils.hpp"
+
+namespace
+{
+    using Catch::Approx;
+
+    using test::HarmonicTrap;
+
+    /// particles spread around the trap centre with random velocities
+    mstd::ParticleArrays<double> randomParticles(
+        const size_t n,
+        const double positionScale = 1.0,
+        const double velocityScale = 1.0
+    )
+    {
+        mstd::ParticleArrays<double> particles(n, 2.0);
+
+        std::mt19937_64                  engine(3);
+        std::normal_distribution<double> normal(0.0, 1.0);
+
+        for (size_t i = 0; i < n; ++i)
+        {
+            particles.x[i]  = positionScale * normal(engine);
+            particles.y[i]  = positionScale * normal(engine);
+            particles.z[i]  = positionScale * normal(engine);
+            particles.vx[i] = velocityScale * normal(engine);
+            particles.vy[i] = velocityScale * normal(engine);
+            particles.vz[i] = velocityScale * normal(engine);
+        }
+
+        return particles;
+    }
+
+    /// runs Langevin dynamics on @p nThreads threads
+    mstd::ParticleArrays<double> runLangevin(
+        const size_t        nThreads,
+        const std::uint64_t seed
+    )
+    {
+        auto               particles = randomParticles(101);
+        const HarmonicTrap trap{1.0};
+
+        mstd::LangevinBAOAB<double> integrator(0.05, 1.0, 1.0, seed, nThreads);
+
+        integrator.setup(particles, trap);
+        for (size_t s = 0; s < 20; ++s)
+            integrator.step(particles, trap);
+
+        return particles;
+    }
+
+}   // namespace
+
+TEST_CASE("thermostats validate their parameters", "[thermostat]")
+{
+    using Langevin     = mstd::LangevinBAOAB<double>;
+    using NoseHoover   = mstd::NoseHooverChain<double>;
+    const auto invalid = [](auto&& make)
+    { REQUIRE_THROWS_AS(make(), std::invalid_argument); };
+
+    invalid([] { return Langevin(0.0, 1.0, 1.0, 1); });
+    invalid([] { return Langevin(0.1, -1.0, 1.0, 1); });
+    invalid([] { return Langevin(0.1, 1.0, -1.0, 1); });
+    invalid([] { return Langevin(0.1, 1.0, 1.0, 1, 0); });
+
+    invalid([] { return NoseHoover(0.0, 1.0, 1.0, 3.0); });
+    invalid([] { return NoseHoover(0.1, 0.0, 1.0, 3.0); });
+    invalid([] { return NoseHoover(0.1, 1.0, 0.0, 3.0); });
+    invalid([] { return NoseHoover(0.1, 1.0, 1.0, 0.0); });
+    invalid([] { return NoseHoover(0.1, 1.0, 1.0, 3.0, 0); });
+
+    REQUIRE(NoseHoover(0.1, 1.0, 1.0, 3.0).chainLength() == 3);
+}
+
+TEST_CASE("Langevin noise is independent of the thread count",
+          "[thermostat]")
+{
+    const auto reference = runLangevin(1, 11);
+
+    for (const size_t nThreads : std::vector<size_t>{2, 3, 4})
+    {
+        const auto particles = runLangevin(nThreads, 11);
+
+        REQUIRE(std::ranges::equal(particles.x, reference.x));
+        REQUIRE(std::ranges::equal(particles.vy, reference.vy));
+        REQUIRE(std::ranges::equal(particles.z, reference.z));
+    }
+
+    REQUIRE_FALSE(std::ranges::equal(runLangevin(1, 12).x, reference.x));
+}
+
+TEST_CASE("Langevin dynamics samples the canonical ensemble", "[thermostat]")
+{
+    // equipartition: <E_kin> = <E_pot> = 3 N kT / 2 in a harmonic trap
+    constexpr double kT = 1.5;
+    constexpr size_t n  = 500;
+
+    auto               particles = randomParticles(n);
+    const HarmonicTrap trap{4.0};
+
+    mstd::LangevinBAOAB<double> integrator(0.02, kT, 2.0, 5);
+    integrator.setup(particles, trap);
+
+    for (size_t s = 0; s < 500; ++s)
+        integrator.step(particles, trap);
+
+    double kinetic = 0.0, potential = 0.0;
+    for (size_t s = 0; s < 2000; ++s)
+    {
+        potential += integrator.step(particles, trap);
+        kinetic   += particles.kineticEnergy();
+    }
+
+    const double expected = 2000 * 1.5 * kT * n;
+
+    REQUIRE(integrator.stepCount() == 2500);
+    REQUIRE(kinetic == Approx(expected).epsilon(0.02));
+    REQUIRE(potential == Approx(expected).epsilon(0.02));
+}
+
+TEST_CASE("Nose-Hoover chain conserves its extended energy and thermalizes",
+          "[thermostat]")
+{
+    // trap at kT = 0.5 (k = 4), velocities start twice as hot (m = 2)
+    constexpr double kT = 0.5;
+    constexpr size_t n  = 500;
+
+    auto particles = randomParticles(n, std::sqrt(kT / 4), std::sqrt(kT));
+    const HarmonicTrap trap{4.0};
+
+    mstd::NoseHooverChain<double> integrator(0.01, kT, 0.2, 3.0 * n);
+
+    const double energy0 =
+        integrator.setup(particles, trap) + particles.kineticEnergy();
+
+    double maxDrift = 0.0, kinetic = 0.0;
+    for (size_t s = 0; s < 4000; ++s)
+    {
+        const double potential = integrator.step(particles, trap);
+        const double energy    = potential + particles.kineticEnergy() +
+                              integrator.energyOfThermostat();
+
+        maxDrift = std::max(maxDrift, std::abs(energy - energy0));
+
+        if (s >= 2000)
+            kinetic += particles.kineticEnergy();
+    }
+
+    REQUIRE(maxDrift < 5e-4 * energy0);
+    REQUIRE(kinetic == Approx(2000 * 1.5 * kT * n).epsilon(0.03));
+}
@@ -0,0 +1,246 @@
+/*****************************************************************************
+<GPL_HEADER>
+
+    mstd library
+    Copyright (C) 2025-now  Jakob Gamper
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+<GPL_HEADER>
+******************************************************************************/
+
+#include <catch2/catch_test_macros.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+#include "mstd/physics/io.hpp"
+#include "mstd/physics/particles.hpp"
+
+namespace
+{
+    struct Frame
+    {
+        std::vector<double> x, y, z;
+    };
+
+    std::vector<Frame> randomFrames(const size_t nFrames, const size_t n)
+    {
+        std::mt19937_64                        engine(7);
+        std::uniform_real_distribution<double> dist(-5.0, 5.0);
+
+        std::vector<Frame> frames(nFrames);
+        for (auto& frame : frames)
+            for (auto* coordinate : {&frame.x, &frame.y, &frame.z})
+            {
+                coordinate->resize(n);
+                for (auto& value : *coordinate)
+                    value = dist(engine);
+            }
+
+        return frames;
+    }
+
+    std::filesystem::path tempPath(const char* name)
+    {
+        return std::filesystem::temp_directory_path() / name;
+    }
+
+}   // namespace
+
+TEST_CASE("TrajectoryWriter frames read back unchanged", "[trajectory]")
+{
+    constexpr size_t nParticles = 1000;
+    constexpr size_t nFrames    = 25;
+
+    const auto path   = tempPath("mstd_test_trajectory_raw.trj");
+    const auto frames = randomFrames(nFrames, nParticles);
+
+    {
+        mstd::TrajectoryWriter<> writer(path, nParticles);
+
+        // more frames than staging buffers: write() has to wait in turn
+        for (size_t k = 0; k < nFrames; ++k)
+            writer.write(10 * k, frames[k].x, frames[k].y, frames[k].z);
+
+        writer.flush();
+
+        REQUIRE(writer.framesWritten() == nFrames);
+        REQUIRE(
+            writer.bytesWritten() ==
+            mstd::trajectory_format::headerBytes +
+                nFrames * (mstd::trajectory_format::frameHeaderBytes +
+                           3 * nParticles * sizeof(double))
+        );
+    }
+
+    REQUIRE(
+        std::filesystem::file_size(path) ==
+        mstd::trajectory_format::headerBytes +
+            nFrames * (mstd::trajectory_format::frameHeaderBytes +
+                       3 * nParticles * sizeof(double))
+    );
+
+    mstd::TrajectoryReader<> reader(path);
+    REQUIRE(reader.nParticles() == nParticles);
+
+    std::vector<double> x(nParticles), y(nParticles), z(nParticles);
+
+    for (size_t k = 0; k < nFrames; ++k)
+    {
+        const auto step = reader.read(x, y, z);
+
+        REQUIRE(step.has_value());
+        REQUIRE(*step == 10 * k);
+        REQUIRE(x == frames[k].x);
+        REQUIRE(y == frames[k].y);
+        REQUIRE(z == frames[k].z);
+    }
+
+    REQUIRE_FALSE(reader.read(x, y, z).has_value());
+
+    std::filesystem::remove(path);
+}
+
+TEST_CASE("TrajectoryWriter stages the caller's copy", "[trajectory]")
+{
+    const auto path = tempPath("mstd_test_trajectory_particles.trj");
+
+    mstd::ParticleArrays<double> particles(3);
+    particles.x = {1.0, 2.0, 3.0};
+
+    {
+        mstd::TrajectoryWriter<> writer(path, particles.size());
+        writer.write(0, particles);
+
+        // changing the particles after write() does not alter the frame
+        particles.x[0] = -1.0;
+        writer.write(1, particles);
+    }
+
+    mstd::TrajectoryReader<> reader(path);
+
+    std::vector<double> x(3), y(3), z(3);
+
+    REQUIRE(reader.read(x, y, z) == 0);
+    REQUIRE(x[0] == 1.0);
+    REQUIRE(reader.read(x, y, z) == 1);
+    REQUIRE(x[0] == -1.0);
+
+    std::filesystem::remove(path);
+}
+
+TEST_CASE("trajectory files report invalid input", "[trajectory]")
+{
+    REQUIRE_THROWS_AS(
+        mstd::TrajectoryWriter<>(
+            tempPath("mstd_no_such_directory") / "out.trj",
+            10
+        ),
+        std::runtime_error
+    );
+    REQUIRE_THROWS_AS(
+        mstd::TrajectoryReader<>(tempPath("mstd_no_such_file.trj")),
+        std::runtime_error
+    );
+
+    const auto path = tempPath("mstd_test_trajectory_invalid.trj");
+
+    {
+        std::ofstream file(path, std::ios::binary);
+        file << "not a trajectory file at all";
+    }
+    REQUIRE_THROWS_AS(mstd::TrajectoryReader<>(path), std::runtime_error);
+
+    {
+        mstd::TrajectoryWriter<> writer(path, 4);
+        const std::vector<double> zeros(4);
+        writer.write(0, zeros, zeros, zeros);
+    }
+
+    // truncate inside the payload of the only frame
+    std::filesystem::resize_file(path, std::filesystem::file_size(path) - 8);
+
+    mstd::TrajectoryReader<> reader(path);
+    std::vector<double>      x(4), y(4), z(4);
+    REQUIRE_THROWS_AS(reader.read(x, y, z), std::runtime_error);
+
+    std::filesystem::remove(path);
+}
+
+TEST_CASE("trajectory files reject corrupt frames", "[trajectory]")
+{
+    constexpr size_t nParticles = 4;
+
+    const auto path = tempPath("mstd_test_trajectory_corrupt.trj");
+
+    // overwrites the payload size of the first frame
+    const auto writeFrame = [&](const std::uint64_t payloadSize)
+    {
+        {
+            mstd::TrajectoryWriter<> writer(path, nParticles);
+            const std::vector<double> zeros(nParticles);
+            writer.write(0, zeros, zeros, zeros);
+        }
+
+        std::fstream file(
+            path,
+            std::ios::binary | std::ios::in | std::ios::out
+        );
+        file.seekp(
+            static_cast<std::streamoff>(
+                mstd::trajectory_format::headerBytes + sizeof(std::uint64_t)
+            )
+        );
+        file.write(
+            reinterpret_cast<const char*>(&payloadSize),
+            sizeof(payloadSize)
+        );
+    };
+
+    std::vector<double> x(nParticles), y(nParticles), z(nParticles);
+
+    SECTION("huge payload size")
+    {
+        writeFrame(~std::uint64_t{0});
+
+        mstd::TrajectoryReader<> reader(path);
+        REQUIRE_THROWS_AS(reader.read(x, y, z), std::runtime_error);
+    }
+
+    SECTION("payload size not matching the particles")
+    {
+        writeFrame(2 * nParticles * sizeof(double));
+
+        mstd::TrajectoryReader<> reader(path);
+        REQUIRE_THROWS_AS(reader.read(x, y, z), std::runtime_error);
+    }
+
+    SECTION("reading past the end of a payload")
+    {
+        const std::vector<std::byte> bytes(6);
+
+        size_t offset = 0;
+        REQUIRE_THROWS_AS(
+            mstd::details::readBytes<std::uint64_t>(bytes, offset),
+            std::runtime_error
+        );
+    }
+
+    std::filesystem::remove(path);
+}
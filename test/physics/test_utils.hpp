@@ -0,0 +1,241 @@
+/*****************************************************************************
+<GPL_HEADER>
+
+    mstd library
+    Copyright (C) 2025-now  Jakob Gamper
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+<GPL_HEADER>
+******************************************************************************/
+
+#ifndef __PHYSICS__TEST_UTILS_HPP__
+#define __PHYSICS__TEST_UTILS_HPP__
+
+#include <array>
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <cmath>
+#include <cstddef>
+#include <random>
+#include <set>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include "mstd/simd.hpp"
+#include "mstd/type_traits/physics_traits.hpp"
+
+namespace test
+{
+    /**
+     * @brief SoA particle coordinates for tests
+     */
+    struct Particles
+    {
+        std::vector<double> x;
+        std::vector<double> y;
+        std::vector<double> z;
+    };
+
+    /**
+     * @brief uniformly distributed particles in the box @p box
+     */
+    inline Particles randomParticles(
+        const size_t                 n,
+        const std::array<double, 3>& box,
+        const unsigned               seed
+    )
+    {
+        std::mt19937_64                        engine(seed);
+        std::uniform_real_distribution<double> unit(0.0, 1.0);
+
+        Particles particles;
+        for (size_t i = 0; i < n; ++i)
+        {
+            particles.x.push_back(box[0] * unit(engine));
+            particles.y.push_back(box[1] * unit(engine));
+            particles.z.push_back(box[2] * unit(engine));
+        }
+        return particles;
+    }
+
+    /**
+     * @brief all pairs `i < j` closer than @p cutoff under minimum image
+     */
+    inline std::set<std::pair<size_t, size_t>> bruteForcePairs(
+        const Particles&             p,
+        const std::array<double, 3>& box,
+        const double                 cutoff
+    )
+    {
+        std::set<std::pair<size_t, size_t>> pairs;
+
+        for (size_t i = 0; i < p.x.size(); ++i)
+            for (size_t j = i + 1; j < p.x.size(); ++j)
+            {
+                auto dx = p.x[i] - p.x[j];
+                auto dy = p.y[i] - p.y[j];
+                auto dz = p.z[i] - p.z[j];
+                dx     -= box[0] * std::nearbyint(dx / box[0]);
+                dy     -= box[1] * std::nearbyint(dy / box[1]);
+                dz     -= box[2] * std::nearbyint(dz / box[2]);
+
+                if (dx * dx + dy * dy + dz * dz < cutoff * cutoff)
+                    pairs.emplace(i, j);
+            }
+
+        return pairs;
+    }
+
+    /**
+     * @brief simple cubic lattice of `perSide^3` particles with a uniform
+     *        jitter of ±0.15, free of overlapping particles for spacings
+     *        around 1
+     */
+    inline Particles jitteredLattice(
+        const size_t   perSide,
+        const double   spacing,
+        const unsigned seed
+    )
+    {
+        std::mt19937_64                        engine(seed);
+        std::uniform_real_distribution<double> jitter(-0.15, 0.15);
+
+        Particles p;
+        for (size_t ix = 0; ix < perSide; ++ix)
+            for (size_t iy = 0; iy < perSide; ++iy)
+                for (size_t iz = 0; iz < perSide; ++iz)
+                {
+                    p.x.push_back(
+                        spacing * static_cast<double>(ix) + jitter(engine)
+                    );
+                    p.y.push_back(
+                        spacing * static_cast<double>(iy) + jitter(engine)
+                    );
+                    p.z.push_back(
+                        spacing * static_cast<double>(iz) + jitter(engine)
+                    );
+                }
+
+        return p;
+    }
+
+    /**
+     * @brief checks a pair potential against its own conventions
+     *
+     * At radii `rMin + i * rStep` the r2 path has to match eval(), the
+     * force the central difference of the energy and every SIMD lane the
+     * scalar result. With @p batch also evalBatch() is compared, over more
+     * radii than fit into one vector.
+     */
+    template <typename P>
+    void requireConsistentPotential(
+        const P&     potential,
+        const double rMin,
+        const double rStep,
+        const bool   batch = false
+    )
+    {
+        using Catch::Approx;
+        using V = mstd::SimdVec<double>;
+
+        constexpr size_t width = mstd::simd_size_v<V>;
+        constexpr double h     = 1e-6;
+
+        STATIC_REQUIRE(mstd::is_pair_potential_v<P>);
+
+        std::vector<double> r(batch ? 2 * width + 1 : width);
+        for (size_t i = 0; i < r.size(); ++i)
+            r[i] = rMin + rStep * static_cast<double>(i);
+
+        std::vector<double> energies(r.size()), forces(r.size());
+
+        for (size_t i = 0; i < r.size(); ++i)
+        {
+            const auto [energy, force] = potential.eval(r[i]);
+            const auto [e, fOverR]     = potential.evalFromR2(r[i] * r[i]);
+
+            REQUIRE(e == Approx(energy).epsilon(1e-12));
+            REQUIRE(fOverR == Approx(force / r[i]).epsilon(1e-12));
+
+            const double derivative = (potential.evalEnergy(r[i] + h) -
+                                       potential.evalEnergy(r[i] - h)) /
+                                      (2 * h);
+
+            REQUIRE(force == Approx(derivative).margin(1e-7));
+
+            energies[i] = energy;
+            forces[i]   = force;
+        }
+
+        if (batch)
+        {
+            std::vector<double> batchEnergies(r.size());
+            std::vector<double> batchForces(r.size());
+            potential.evalBatch(r, batchEnergies, batchForces);
+
+            for (size_t i = 0; i < r.size(); ++i)
+            {
+                REQUIRE(batchEnergies[i] == Approx(energies[i]).epsilon(1e-14));
+                REQUIRE(batchForces[i] == Approx(forces[i]).epsilon(1e-14));
+            }
+        }
+
+        V lanes{};
+        for (size_t i = 0; i < width; ++i)
+            lanes[i] = r[i];
+
+        const auto [e, f] = potential.template eval<V>(lanes);
+        for (size_t i = 0; i < width; ++i)
+        {
+            REQUIRE(e[i] == Approx(energies[i]).epsilon(1e-14));
+            REQUIRE(f[i] == Approx(forces[i]).epsilon(1e-14));
+        }
+    }
+
+    /**
+     * @brief isotropic harmonic trap `E = k r^2 / 2` around the origin,
+     *        a force provider for integrator and thermostat tests
+     */
+    struct HarmonicTrap
+    {
+        double k;
+
+        double operator()(
+            std::span<const double> x,
+            std::span<const double> y,
+            std::span<const double> z,
+            std::span<double>       fx,
+            std::span<double>       fy,
+            std::span<double>       fz
+        ) const
+        {
+            double energy = 0.0;
+
+            for (size_t i = 0; i < x.size(); ++i)
+            {
+                fx[i]   = -k * x[i];
+                fy[i]   = -k * y[i];
+                fz[i]   = -k * z[i];
+                energy += k * (x[i] * x[i] + y[i] * y[i] + z[i] * z[i]) / 2;
+            }
+
+            return energy;
+        }
+    };
+
+}   // namespace test
+
+#endif   // __PHYSICS__TEST_UTILS_HPP__
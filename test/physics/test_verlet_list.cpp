@@ -0,0 +1,182 @@
+/*****************************************************************************
+<GPL_HEADER>
+
+    mstd library
+    Copyright (C) 2025-now  Jakob Gamper
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+<GPL_HEADER>
+******************************************************************************/
+
+#include <algorithm>
+#include <array>
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <cmath>
+#include <random>
+#include <set>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "mstd/physics/verlet_list.hpp"
+#include "test_utils.hpp"
+
+namespace
+{
+    using test::bruteForcePairs;
+    using test::Particles;
+    using test::randomParticles;
+
+    /// moves every particle by a random vector of length @p step
+    void displace(Particles& p, const double step, const unsigned seed)
+    {
+        std::mt19937_64                  engine(seed);
+        std::normal_distribution<double> normal(0.0, 1.0);
+
+        for (size_t i = 0; i < p.x.size(); ++i)
+        {
+            const auto dx   = normal(engine);
+            const auto dy   = normal(engine);
+            const auto dz   = normal(engine);
+            const auto norm = std::sqrt(dx * dx + dy * dy + dz * dz);
+
+            p.x[i] += step * dx / norm;
+            p.y[i] += step * dy / norm;
+            p.z[i] += step * dz / norm;
+        }
+    }
+
+    std::set<std::pair<size_t, size_t>> listedPairs(
+        const mstd::VerletList<>& list,
+        const Particles&          p
+    )
+    {
+        std::set<std::pair<size_t, size_t>> found;
+        size_t                              visits = 0;
+
+        list.forEachPair(
+            p.x,
+            p.y,
+            p.z,
+            [&](size_t i,
+                size_t j,
+                double dx,
+                double dy,
+                double dz,
+                double r2)
+            {
+                ++visits;
+                found.emplace(i, j);
+
+                REQUIRE(i < j);
+                REQUIRE(r2 == Catch::Approx(dx * dx + dy * dy + dz * dz));
+            }
+        );
+
+        REQUIRE(visits == found.size());
+        return found;
+    }
+
+}   // namespace
+
+TEST_CASE("VerletList finds exactly the pairs within the cutoff", "[verlet]")
+{
+    const std::array<double, 3> box{12.0, 11.0, 13.0};
+    const auto                  particles = randomParticles(900, box, 3);
+
+    mstd::VerletList<> list(box, 2.5, 0.4);
+    REQUIRE(list.update(particles.x, particles.y, particles.z));
+
+    REQUIRE(list.listCutoff() == Catch::Approx(2.9));
+    REQUIRE(list.nParticles() == 900);
+    REQUIRE(list.offsets().size() == 901);
+    REQUIRE(list.nPairs() == bruteForcePairs(particles, box, 2.9).size());
+    REQUIRE(
+        listedPairs(list, particles) == bruteForcePairs(particles, box, 2.5)
+    );
+
+    // rows hold ascending partners with a larger index
+    for (size_t i = 0; i < list.nParticles(); ++i)
+    {
+        const auto row = list.neighbours(i);
+        REQUIRE(std::is_sorted(row.begin(), row.end()));
+        for (const auto j : row)
+            REQUIRE(j > i);
+    }
+
+    REQUIRE(
+        list.averageNeighbours() ==
+        Catch::Approx(2.0 * static_cast<double>(list.nPairs()) / 900.0)
+    );
+}
+
+TEST_CASE("VerletList rebuilds only beyond half the skin", "[verlet]")
+{
+    const std::array<double, 3> box{10.0, 10.0, 10.0};
+    auto                        particles = randomParticles(600, box, 11);
+
+    mstd::VerletList<> list(box, 2.5, 0.6);
+    list.update(particles.x, particles.y, particles.z);
+
+    // small moves keep the list but the pairs follow the new coordinates
+    displace(particles, 0.25, 5);
+    REQUIRE(
+        list.maxDisplacement(particles.x, particles.y, particles.z) ==
+        Catch::Approx(0.25)
+    );
+    REQUIRE_FALSE(list.update(particles.x, particles.y, particles.z));
+    REQUIRE(
+        listedPairs(list, particles) == bruteForcePairs(particles, box, 2.5)
+    );
+
+    // wrapping a particle into the box is no displacement
+    particles.x[0] += particles.x[0] < 5.0 ? 10.0 : -10.0;
+    REQUIRE_FALSE(list.update(particles.x, particles.y, particles.z));
+
+    displace(particles, 0.1, 6);
+    REQUIRE(list.update(particles.x, particles.y, particles.z));
+    REQUIRE(
+        listedPairs(list, particles) == bruteForcePairs(particles, box, 2.5)
+    );
+
+    REQUIRE(list.updateCount() == 4);
+    REQUIRE(list.rebuildCount() == 2);
+    REQUIRE(list.rebuildFrequency() == Catch::Approx(0.5));
+
+    // a changed particle count always rebuilds
+    particles.x.pop_back();
+    particles.y.pop_back();
+    particles.z.pop_back();
+    REQUIRE(list.update(particles.x, particles.y, particles.z));
+    REQUIRE(list.nParticles() == 599);
+}
+
+TEST_CASE("VerletList rejects invalid parameters", "[verlet]")
+{
+    REQUIRE_THROWS_AS(
+        mstd::VerletList<>({10.0, 10.0, 10.0}, 2.5, -0.1),
+        std::invalid_argument
+    );
+    REQUIRE_THROWS_AS(
+        mstd::VerletList<>({10.0, 10.0, 10.0}, 0.0, 0.5),
+        std::invalid_argument
+    );
+    // cutoff + skin must fit into half the box
+    REQUIRE_THROWS_AS(
+        mstd::VerletList<>({5.5, 10.0, 10.0}, 2.5, 0.5),
+        std::invalid_argument
+    );
+}
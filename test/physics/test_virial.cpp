@@ -0,0 +1,90 @@
+/*****************************************************************************
+<GPL_HEADER>
+
+    mstd library
+    Copyright (C) 2025-now  Jakob Gamper
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+<GPL_HEADER>
+******************************************************************************/
+
+#include <array>
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <cstddef>
+#include <vector>
+
+#include "mstd/physics/particles.hpp"
+#include "mstd/physics/virial.hpp"
+
+namespace
+{
+    using Catch::Approx;
+}   // namespace
+
+TEST_CASE("VirialTensor sums symmetric pair contributions", "[virial]")
+{
+    mstd::VirialTensor<> virial;
+
+    for (size_t a = 0; a < 3; ++a)
+        for (size_t b = 0; b < 3; ++b)
+            REQUIRE(virial(a, b) == 0.0);
+
+    // force on the first particle -2 d: repulsive with 2 * |d|^2
+    virial.addPair(2.0, 1.0, -2.0, 3.0);
+
+    const std::array<double, 3> d{1.0, -2.0, 3.0};
+    for (size_t a = 0; a < 3; ++a)
+        for (size_t b = 0; b < 3; ++b)
+            REQUIRE(virial(a, b) == Approx(-2.0 * d[a] * d[b]));
+
+    REQUIRE(virial.trace() == Approx(-28.0));
+
+    mstd::VirialTensor<> other;
+    other.addPair(-1.0, 0.0, 0.5, 0.0);
+
+    virial += other;
+    REQUIRE(virial(1, 1) == Approx(-8.0 + 0.25));
+    REQUIRE(virial(0, 1) == Approx(4.0));
+    REQUIRE(virial(1, 0) == Approx(4.0));
+}
+
+TEST_CASE("pressure combines kinetic and virial parts", "[virial]")
+{
+    mstd::ParticleArrays<double> particles(3);
+
+    const std::vector<double> masses{1.0, 2.0, 0.5};
+    particles.setMasses(masses);
+
+    particles.vx = {1.0, -0.5, 2.0};
+    particles.vy = {0.0, 1.0, -1.0};
+    particles.vz = {0.5, 0.5, 0.0};
+
+    mstd::VirialTensor<> virial;
+    virial.addPair(-0.5, 1.0, 1.0, 0.0);
+
+    const double volume = 8.0;
+    const auto   tensor = mstd::pressureTensor(particles, virial, volume);
+
+    // sum_i m_i vx_i vy_i = 0 - 1 - 1 = -2, virial xy = 0.5
+    REQUIRE(tensor[0][1] == Approx((-2.0 + 0.5) / volume));
+    REQUIRE(tensor[1][0] == tensor[0][1]);
+    // sum_i m_i vx_i^2 = 1 + 0.5 + 2 = 3.5, virial xx = 0.5
+    REQUIRE(tensor[0][0] == Approx((3.5 + 0.5) / volume));
+    REQUIRE(tensor[2][2] == Approx(0.75 / volume));
+
+    const auto p = mstd::pressure(particles, virial, volume);
+    REQUIRE(p == Approx((tensor[0][0] + tensor[1][1] + tensor[2][2]) / 3));
+}
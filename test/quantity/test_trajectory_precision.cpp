@@ -0,0 +1,58 @@
+/*****************************************************************************
+<GPL_HEADER>
+
+    mstd library
+    Copyright (C) 2025-now  Jakob Gamper
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+<GPL_HEADER>
+******************************************************************************/
+
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <cstddef>
+#include <vector>
+
+#include "mstd/physics/io/compressed_trajectory_codec.hpp"
+#include "mstd/quantity.hpp"
+
+TEST_CASE("CompressedTrajectoryCodec takes a Length precision", "[units]")
+{
+    using namespace mstd;
+    using namespace mstd::literals;
+
+    using Codec = CompressedTrajectoryCodec<double>;
+
+    const auto picometres = Codec::withPrecision<nm>(Length<pm>{2.0});
+    REQUIRE(picometres.precision() == Catch::Approx(2e-3));
+
+    const auto angstrom = Codec::withPrecision<Ang>(Length<pm>{1.0});
+    REQUIRE(angstrom.precision() == Catch::Approx(1e-2));
+
+    // coordinates in nm come back within half a pm
+    auto encoder = Codec::withPrecision<nm>(Length<pm>{1.0});
+
+    const std::vector<double> x{0.1234567, 2.5, -3.9999};
+
+    std::vector<std::byte> payload;
+    encoder.encode(x, x, x, payload);
+
+    Codec               decoder;
+    std::vector<double> rx(3), ry(3), rz(3);
+    decoder.decode(payload, rx, ry, rz);
+
+    for (size_t i = 0; i < x.size(); ++i)
+        REQUIRE(rx[i] == Catch::Approx(x[i]).margin(0.5e-3 + 1e-12));
+}
@@ -0,0 +1,172 @@
+/*****************************************************************************
+<GPL_HEADER>
+
+    mstd library
+    Copyright (C) 2025-now  Jakob Gamper
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+<GPL_HEADER>
+******************************************************************************/
+
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+#include "mstd/random/distributions.hpp"
+#include "mstd/random/philox.hpp"
+#include "mstd/simd/vec.hpp"
+
+using Catch::Approx;
+
+TEST_CASE("Philox4x32 reproduces the Random123 known answers", "[random]")
+{
+    using Philox = mstd::Philox4x32<>;
+
+    STATIC_REQUIRE(
+        Philox({0, 0})({0, 0, 0, 0}) ==
+        Philox::counter_type{0x6627e8d5, 0xe169c58d, 0xbc57ac4c, 0x9b00dbd8}
+    );
+
+    REQUIRE(
+        Philox({0xffffffff, 0xffffffff})(
+            {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}
+        ) ==
+        Philox::counter_type{0x408f276d, 0x41c83b0e, 0xa20bc7c6, 0x6d5451fd}
+    );
+
+    REQUIRE(
+        Philox({0xa4093822, 0x299f31d0})(
+            {0x243f6a88, 0x85a308d3, 0x13198a2e, 0x03707344}
+        ) ==
+        Philox::counter_type{0xd16cfe09, 0x94fdcceb, 0x5001e420, 0x24126ea1}
+    );
+}
+
+TEST_CASE("Philox4x64 reproduces the Random123 known answers", "[random]")
+{
+    using Philox = mstd::Philox4x64<>;
+
+    STATIC_REQUIRE(
+        Philox(Philox::key_type{0, 0})({0, 0, 0, 0}) ==
+        Philox::counter_type{
+            0x16554d9eca36314c,
+            0xdb20fe9d672d0fdc,
+            0xd7e772cee186176b,
+            0x7e68b68aec7ba23b
+        }
+    );
+
+    constexpr std::uint64_t ones = 0xffffffffffffffff;
+
+    REQUIRE(
+        Philox(Philox::key_type{ones, ones})({ones, ones, ones, ones}) ==
+        Philox::counter_type{
+            0x87b092c3013fe90b,
+            0x438c3c67be8d0224,
+            0x9cc7d7c69cd777b6,
+            0xa09caebf594f0ba0
+        }
+    );
+
+    REQUIRE(
+        Philox(Philox::key_type{0x452821e638d01377, 0xbe5466cf34e90c6c})(
+            {0x243f6a8885a308d3,
+             0x13198a2e03707344,
+             0xa4093822299f31d0,
+             0x082efa98ec4e6c89}
+        ) ==
+        Philox::counter_type{
+            0xa528f45403e61d95,
+            0x38c72dbd566e9788,
+            0xa5a1610e72fd18b5,
+            0x57bd43b5e52b7fe6
+        }
+    );
+}
+
+TEST_CASE("Philox bits agree between scalars and vector lanes", "[random]")
+{
+    using V = mstd::SimdVec<std::uint64_t>;
+
+    const mstd::Philox4x32<> philox32(std::uint64_t{99});
+    const mstd::Philox4x64<> philox64(std::uint64_t{99});
+
+    V index{};
+    for (size_t lane = 0; lane < mstd::simd_size_v<V>; ++lane)
+        index[lane] = 0xfffffffe + lane;
+
+    const auto bits32 = philox32.bits(index, 5);
+    const auto bits64 = philox64.bits(index, 5);
+
+    for (size_t lane = 0; lane < mstd::simd_size_v<V>; ++lane)
+    {
+        const std::uint64_t i = index[lane];
+
+        const auto words32 = philox32(i, 5);
+        const auto low  = words32[0] | std::uint64_t{words32[1]} << 32;
+        const auto high = words32[2] | std::uint64_t{words32[3]} << 32;
+
+        REQUIRE(bits32[0][lane] == low);
+        REQUIRE(bits32[1][lane] == high);
+
+        const auto words64 = philox64(i, 5);
+        for (size_t w = 0; w < 4; ++w)
+            REQUIRE(bits64[w][lane] == words64[w]);
+    }
+}
+
+TEST_CASE("Philox4x32 splits seeds, indices and steps into words", "[random]")
+{
+    const mstd::Philox4x32<> generator(std::uint64_t{0x0123456789abcdef});
+
+    REQUIRE(
+        generator.key() == mstd::Philox4x32<>::key_type{0x89abcdef, 0x01234567}
+    );
+    REQUIRE(
+        generator(std::uint64_t{0x100000002}, std::uint64_t{0x300000004}) ==
+        generator({2, 1, 4, 3})
+    );
+    REQUIRE(generator(1, 0) != generator(0, 1));
+}
+
+TEST_CASE("uniform and normal variates have the expected moments", "[random]")
+{
+    REQUIRE(mstd::uniformOpen(0) > 0.0);
+    REQUIRE(mstd::uniformOpen(0xffffffff) < 1.0);
+
+    const mstd::Philox4x32<> generator(std::uint64_t{7});
+    constexpr size_t         n = 100000;
+
+    double sum = 0.0, sumSquares = 0.0;
+    for (size_t i = 0; i < n; ++i)
+    {
+        const auto bits = generator(i, 0);
+        const auto [a, b] = mstd::boxMuller(
+            mstd::uniformOpen(bits[0]),
+            mstd::uniformOpen(bits[1])
+        );
+
+        sum        += a + b;
+        sumSquares += a * a + b * b;
+    }
+
+    const double mean     = sum / (2 * n);
+    const double variance = sumSquares / (2 * n) - mean * mean;
+
+    REQUIRE(mean == Approx(0.0).margin(0.01));
+    REQUIRE(variance == Approx(1.0).epsilon(0.01));
+}
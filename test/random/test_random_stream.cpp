@@ -0,0 +1,218 @@
+/*****************************************************************************
+<GPL_HEADER>
+
+    mstd library
+    Copyright (C) 2025-now  Jakob Gamper
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+<GPL_HEADER>
+******************************************************************************/
+
+#include <algorithm>
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <cmath>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <span>
+#include <vector>
+
+#include "mstd/random/distributions.hpp"
+#include "mstd/random/philox.hpp"
+#include "mstd/random/stream.hpp"
+#include "mstd/random/threefry.hpp"
+#include "mstd/type_traits/random_traits.hpp"
+
+namespace
+{
+    using Catch::Approx;
+
+    /// mean, variance and fourth central moment of @p values
+    struct Moments
+    {
+        double mean{}, variance{}, fourth{};
+
+        explicit Moments(std::span<const double> values)
+        {
+            const auto n = static_cast<double>(values.size());
+
+            for (const double value : values)
+                mean += value / n;
+
+            for (const double value : values)
+            {
+                const double d  = value - mean;
+                variance       += d * d / n;
+                fourth         += d * d * d * d / n;
+            }
+        }
+    };
+
+    /// the stream sequence against direct evaluation of the generator
+    template <typename Generator>
+    void requireSequenceLayout()
+    {
+        constexpr size_t words = Generator::words_per_call;
+        constexpr size_t group = mstd::RandomStream<Generator>::group_words;
+
+        const Generator               generator(std::uint64_t{4});
+        mstd::RandomStream<Generator> stream(generator, 9);
+
+        std::vector<std::uint64_t> bits(3 * group + 5);
+        stream.fillBits(bits);
+
+        for (size_t p = 0; p < bits.size(); ++p)
+        {
+            const size_t index = p / group * 8 + p % 8;
+            const size_t word  = p % group / 8;
+
+            const auto expected =
+                generator.template bits<std::uint64_t>(index, 9);
+
+            REQUIRE(bits[p] == expected[word]);
+        }
+
+        REQUIRE(stream.position() == bits.size());
+        REQUIRE(words * 8 == group);
+    }
+
+    /// the sequence does not depend on how it is drawn
+    template <typename Generator>
+    void requireSeamlessDraws()
+    {
+        mstd::RandomStream<Generator> reference(std::uint64_t{1}, 2);
+        mstd::RandomStream<Generator> pieces(std::uint64_t{1}, 2);
+
+        std::vector<std::uint64_t> expected(300);
+        reference.fillBits(expected);
+
+        std::vector<std::uint64_t> drawn(300);
+        pieces.fillBits(std::span(drawn).first(3));
+        drawn[3] = pieces();
+        pieces.fillBits(std::span(drawn).subspan(4, 101));
+        pieces.fillBits(std::span(drawn).subspan(105));
+
+        REQUIRE(drawn == expected);
+
+        pieces.seek(37);
+        REQUIRE(pieces() == expected[37]);
+    }
+
+}   // namespace
+
+TEST_CASE("generators satisfy the concepts", "[random]")
+{
+    STATIC_REQUIRE(mstd::is_counter_based_generator_v<mstd::Philox4x32<>>);
+    STATIC_REQUIRE(mstd::is_counter_based_generator_v<mstd::Philox4x64<>>);
+    STATIC_REQUIRE(mstd::is_counter_based_generator_v<mstd::Threefry4x64<>>);
+    STATIC_REQUIRE_FALSE(mstd::is_counter_based_generator_v<std::mt19937_64>);
+
+    STATIC_REQUIRE(std::uniform_random_bit_generator<mstd::RandomStream<>>);
+}
+
+TEST_CASE("RandomStream evaluates groups word-major", "[random]")
+{
+    requireSequenceLayout<mstd::Philox4x32<>>();
+    requireSequenceLayout<mstd::Philox4x64<>>();
+    requireSequenceLayout<mstd::Threefry4x64<>>();
+}
+
+TEST_CASE("RandomStream continues its sequence across calls", "[random]")
+{
+    requireSeamlessDraws<mstd::Philox4x32<>>();
+    requireSeamlessDraws<mstd::Philox4x64<>>();
+    requireSeamlessDraws<mstd::Threefry4x64<>>();
+
+    mstd::RandomStream<> bitsStream(std::uint64_t{5});
+    mstd::RandomStream<> valueStream(std::uint64_t{5});
+
+    std::vector<double> values(77);
+    valueStream.fill(values);
+
+    for (const double value : values)
+        REQUIRE(value == mstd::uniformFromBits(bitsStream()));
+}
+
+TEST_CASE("RandomStream splits into independent streams", "[random]")
+{
+    const mstd::RandomStream<> root(std::uint64_t{8});
+
+    auto first  = root.split(0);
+    auto again  = root.split(0);
+    auto second = root.split(1);
+    auto nested = first.split(0);
+
+    std::vector<std::uint64_t> a(64), b(64), c(64), d(64);
+    first.fillBits(a);
+    again.fillBits(b);
+    second.fillBits(c);
+    nested.fillBits(d);
+
+    REQUIRE(a == b);
+    REQUIRE(a != c);
+    REQUIRE(a != d);
+    REQUIRE(first.generator().key() != root.generator().key());
+
+    mstd::RandomStream<> stream0(std::uint64_t{8}, 0);
+    mstd::RandomStream<> stream1(std::uint64_t{8}, 1);
+    REQUIRE(stream0() != stream1());
+}
+
+TEST_CASE("uniform values have the expected moments", "[random]")
+{
+    mstd::RandomStream<mstd::Threefry4x64<>> stream(std::uint64_t{3});
+
+    std::vector<double> values(200001);
+    stream.fill(values);
+
+    REQUIRE(std::ranges::all_of(
+        values,
+        [](double u) { return u >= 0.0 && u < 1.0; }
+    ));
+
+    const Moments moments(values);
+    REQUIRE(moments.mean == Approx(0.5).margin(0.003));
+    REQUIRE(moments.variance == Approx(1.0 / 12).epsilon(0.01));
+}
+
+TEST_CASE("normal values have the expected moments and tails", "[random]")
+{
+    using mstd::NormalMethod;
+
+    for (const auto method : {NormalMethod::Ziggurat, NormalMethod::BoxMuller})
+    {
+        mstd::RandomStream<> stream(std::uint64_t{11});
+
+        std::vector<double> values(400001);
+        stream.fillNormal(values, 1.0, 2.0, method);
+
+        const Moments moments(values);
+        REQUIRE(moments.mean == Approx(1.0).margin(0.01));
+        REQUIRE(moments.variance == Approx(4.0).epsilon(0.01));
+        REQUIRE(moments.fourth == Approx(3 * 16.0).epsilon(0.03));
+
+        // P(|z| > 3) = 2.6998e-3, beyond the Ziggurat base at 3.44
+        const auto outliers = std::ranges::count_if(
+            values,
+            [](double value) { return std::abs(value - 1.0) > 6.0; }
+        );
+        const auto fraction =
+            static_cast<double>(outliers) / static_cast<double>(values.size());
+
+        REQUIRE(fraction == Approx(2.6998e-3).epsilon(0.1));
+    }
+}
@@ -0,0 +1,80 @@
+/*****************************************************************************
+<GPL_HEADER>
+
+    mstd library
+    Copyright (C) 2025-now  Jakob Gamper
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+<GPL_HEADER>
+******************************************************************************/
+
+#include <catch2/catch_test_macros.hpp>
+#include <cstddef>
+#include <cstdint>
+
+#include "mstd/random/threefry.hpp"
+#include "mstd/simd/vec.hpp"
+
+TEST_CASE("Threefry4x64 reproduces the Random123 known answers", "[random]")
+{
+    using Threefry = mstd::Threefry4x64<>;
+
+    STATIC_REQUIRE(
+        Threefry(Threefry::key_type{0, 0, 0, 0})({0, 0, 0, 0}) ==
+        Threefry::counter_type{
+            0x09218ebde6c85537,
+            0x55941f5266d86105,
+            0x4bd25e16282434dc,
+            0xee29ec846bd2e40b
+        }
+    );
+
+    constexpr std::uint64_t ones = 0xffffffffffffffff;
+
+    REQUIRE(
+        Threefry(Threefry::key_type{ones, ones, ones, ones})(
+            {ones, ones, ones, ones}
+        ) ==
+        Threefry::counter_type{
+            0x29c24097942bba1b,
+            0x0371bbfb0f6f4e11,
+            0x3c231ffa33f83a1c,
+            0xcd29113fde32d168
+        }
+    );
+}
+
+TEST_CASE("Threefry bits agree between scalars and vector lanes", "[random]")
+{
+    using V = mstd::SimdVec<std::uint64_t>;
+
+    const mstd::Threefry4x64<> threefry(std::uint64_t{123});
+
+    V index{};
+    for (size_t lane = 0; lane < mstd::simd_size_v<V>; ++lane)
+        index[lane] = 1000 * lane;
+
+    const auto bits = threefry.bits(index, 8);
+
+    for (size_t lane = 0; lane < mstd::simd_size_v<V>; ++lane)
+    {
+        const auto words = threefry(index[lane], 8);
+
+        for (size_t w = 0; w < 4; ++w)
+            REQUIRE(bits[w][lane] == words[w]);
+    }
+
+    REQUIRE(threefry(1, 0) != threefry(0, 1));
+}
@@ -0,0 +1,349 @@
+/*****************************************************************************
+<GPL_HEADER>
+
+    mstd library
+    Copyright (C) 2025-now  Jakob Gamper
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+<GPL_HEADER>
+******************************************************************************/
+
+#include <array>
+#include <catch2/catch_test_macros.hpp>
+#include <cmath>
+#include <limits>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "mstd/simd.hpp"
+
+TEST_CASE("simd traits distinguish scalars and vectors", "[simd]")
+{
+    using mstd::SimdVec;
+
+    STATIC_REQUIRE(!mstd::is_simd_vec_v<double>);
+    STATIC_REQUIRE(!mstd::is_simd_vec_v<std::array<double, 4>>);
+    STATIC_REQUIRE(mstd::is_simd_vec_v<SimdVec<double>>);
+    STATIC_REQUIRE(mstd::is_simd_vec_v<SimdVec<float, 4>>);
+
+    STATIC_REQUIRE(std::is_same_v<mstd::simd_scalar_t<double>, double>);
+    STATIC_REQUIRE(
+        std::is_same_v<mstd::simd_scalar_t<SimdVec<float>>, float>
+    );
+
+    STATIC_REQUIRE(mstd::simd_size_v<double> == 1);
+    STATIC_REQUIRE(mstd::simd_size_v<SimdVec<double, 4>> == 4);
+    STATIC_REQUIRE(
+        mstd::simd_size_v<SimdVec<double>> ==
+        mstd::simd_register_bytes / sizeof(double)
+    );
+}
+
+TEST_CASE("simd load/store/broadcast round trip", "[simd]")
+{
+    using V = mstd::SimdVec<double>;
+
+    std::array<double, mstd::simd_width_v<double> + 1> data{};
+    for (size_t i = 0; i < data.size(); ++i)
+        data[i] = static_cast<double>(i);
+
+    // deliberately unaligned load
+    const auto v = mstd::simdLoad<V>(data.data() + 1);
+    for (size_t i = 0; i < mstd::simd_size_v<V>; ++i)
+        REQUIRE(v[i] == data[i + 1]);
+
+    const auto w = v * mstd::simdBroadcast<V>(2.0);
+    mstd::simdStore(data.data(), w);
+    for (size_t i = 0; i < mstd::simd_size_v<V>; ++i)
+        REQUIRE(data[i] == 2.0 * static_cast<double>(i + 1));
+
+    REQUIRE(mstd::simdBroadcast<double>(3.0) == 3.0);
+}
+
+TEST_CASE("simdTransform covers vector body and scalar tail", "[simd]")
+{
+    std::array<double, 11> in{};
+    std::array<double, 11> square{};
+    std::array<double, 11> negated{};
+
+    for (size_t i = 0; i < in.size(); ++i)
+        in[i] = static_cast<double>(i) - 3.0;
+
+    mstd::simdTransform<double>(
+        in,
+        square,
+        negated,
+        []<typename T>(const T x) { return std::pair<T, T>{x * x, -x}; }
+    );
+
+    for (size_t i = 0; i < in.size(); ++i)
+    {
+        REQUIRE(square[i] == in[i] * in[i]);
+        REQUIRE(negated[i] == -in[i]);
+    }
+}
+
+TEST_CASE("simdSqrt matches std::sqrt lane-wise", "[simd]")
+{
+    using VD = mstd::SimdVec<double>;
+    using VF = mstd::SimdVec<float>;
+
+    VD d{};
+    for (size_t i = 0; i < mstd::simd_size_v<VD>; ++i)
+        d[i] = 0.5 + static_cast<double>(i);
+
+    VF f{};
+    for (size_t i = 0; i < mstd::simd_size_v<VF>; ++i)
+        f[i] = 0.25F + static_cast<float>(i);
+
+    const auto sd = mstd::simdSqrt(d);
+    const auto sf = mstd::simdSqrt(f);
+
+    for (size_t i = 0; i < mstd::simd_size_v<VD>; ++i)
+        REQUIRE(sd[i] == std::sqrt(d[i]));
+
+    for (size_t i = 0; i < mstd::simd_size_v<VF>; ++i)
+        REQUIRE(sf[i] == std::sqrt(f[i]));
+
+    REQUIRE(mstd::simdSqrt(2.0) == std::sqrt(2.0));
+}
+
+TEST_CASE("simdSqrt is usable in constant expressions", "[simd]")
+{
+    static constexpr std::array<double, 6> inputs{
+        1e-300,
+        0.04,
+        0.5,
+        2.0,
+        7.3,
+        1e300
+    };
+
+    constexpr auto roots = []
+    {
+        std::array<double, inputs.size()> out{};
+        for (size_t i = 0; i < inputs.size(); ++i)
+            out[i] = mstd::simdSqrt(inputs[i]);
+        return out;
+    }();
+
+    // within one ulp of the correctly rounded root
+    for (size_t i = 0; i < inputs.size(); ++i)
+    {
+        const auto root = std::sqrt(inputs[i]);
+        REQUIRE(roots[i] >= std::nextafter(root, 0.0));
+        REQUIRE(roots[i] <= std::nextafter(root, 1e308));
+    }
+
+    STATIC_REQUIRE(mstd::simdSqrt(4.0) == 2.0);
+    STATIC_REQUIRE(mstd::simdSqrt(0.0) == 0.0);
+    STATIC_REQUIRE(mstd::simdSqrt(2.25F) == 1.5F);
+}
+
+TEST_CASE("simdNearbyint matches std::nearbyint lane-wise", "[simd]")
+{
+    using VD = mstd::SimdVec<double>;
+    using VF = mstd::SimdVec<float>;
+
+    VD d{};
+    for (size_t i = 0; i < mstd::simd_size_v<VD>; ++i)
+        d[i] = -2.5 + 1.25 * static_cast<double>(i);
+
+    VF f{};
+    for (size_t i = 0; i < mstd::simd_size_v<VF>; ++i)
+        f[i] = -3.5F + 0.75F * static_cast<float>(i);
+
+    const auto rd = mstd::simdNearbyint(d);
+    const auto rf = mstd::simdNearbyint(f);
+
+    for (size_t i = 0; i < mstd::simd_size_v<VD>; ++i)
+        REQUIRE(rd[i] == std::nearbyint(d[i]));
+
+    for (size_t i = 0; i < mstd::simd_size_v<VF>; ++i)
+        REQUIRE(rf[i] == std::nearbyint(f[i]));
+
+    REQUIRE(mstd::simdNearbyint(2.5) == 2.0);
+    REQUIRE(mstd::simdNearbyint(-0.6) == -1.0);
+}
+
+TEST_CASE("simdFloor matches std::floor lane-wise", "[simd]")
+{
+    using VD = mstd::SimdVec<double>;
+    using VF = mstd::SimdVec<float>;
+
+    VD d{};
+    for (size_t i = 0; i < mstd::simd_size_v<VD>; ++i)
+        d[i] = -2.5 + 1.25 * static_cast<double>(i);
+
+    VF f{};
+    for (size_t i = 0; i < mstd::simd_size_v<VF>; ++i)
+        f[i] = -3.5F + 0.75F * static_cast<float>(i);
+
+    const auto rd = mstd::simdFloor(d);
+    const auto rf = mstd::simdFloor(f);
+
+    for (size_t i = 0; i < mstd::simd_size_v<VD>; ++i)
+        REQUIRE(rd[i] == std::floor(d[i]));
+
+    for (size_t i = 0; i < mstd::simd_size_v<VF>; ++i)
+        REQUIRE(rf[i] == std::floor(f[i]));
+
+    REQUIRE(mstd::simdFloor(-0.5) == -1.0);
+
+    // ties, large magnitudes and values just below an integer
+    const std::array<double, 8> edge{
+        -0.5,
+        1.5,
+        -2.5,
+        0x1p52 + 1.0,
+        -1e300,
+        0x1p51 + 0.5,
+        -0x1p51 - 0.5,
+        3.0 - 0x1p-51
+    };
+
+    for (size_t start = 0; start < edge.size(); ++start)
+    {
+        VD value{};
+        for (size_t i = 0; i < mstd::simd_size_v<VD>; ++i)
+            value[i] = edge[(start + i) % edge.size()];
+
+        const auto nearest = mstd::simdNearbyint(value);
+        const auto floored = mstd::simdFloor(value);
+
+        for (size_t i = 0; i < mstd::simd_size_v<VD>; ++i)
+        {
+            REQUIRE(nearest[i] == std::nearbyint(value[i]));
+            REQUIRE(floored[i] == std::floor(value[i]));
+        }
+    }
+}
+
+TEST_CASE("simdReduceAdd sums all lanes", "[simd]")
+{
+    using V = mstd::SimdVec<double>;
+
+    V      v{};
+    double expected = 0.0;
+    for (size_t i = 0; i < mstd::simd_size_v<V>; ++i)
+    {
+        v[i]      = 1.5 * static_cast<double>(i + 1);
+        expected += v[i];
+    }
+
+    REQUIRE(mstd::simdReduceAdd(v) == expected);
+    REQUIRE(mstd::simdReduceAdd(2.5) == 2.5);
+}
+
+TEST_CASE("simdGather loads indexed lanes", "[simd]")
+{
+    using V = mstd::SimdVec<double>;
+
+    std::vector<double> data(32);
+    for (size_t i = 0; i < data.size(); ++i)
+        data[i] = 0.5 * static_cast<double>(i);
+
+    std::vector<size_t> indices;
+    for (size_t l = 0; l < mstd::simd_size_v<V>; ++l)
+        indices.push_back((7 * l + 3) % data.size());
+
+    const auto gathered = mstd::simdGather<V>(data.data(), indices.data());
+
+    for (size_t l = 0; l < mstd::simd_size_v<V>; ++l)
+        REQUIRE(gathered[l] == data[indices[l]]);
+}
+
+TEST_CASE("simdExp stays within one ulp of std::exp", "[simd]")
+{
+    using VD = mstd::SimdVec<double>;
+    using VF = mstd::SimdVec<float>;
+
+    const auto ulps = []<typename S>(const S value, const S reference)
+    {
+        const auto ulp =
+            std::nextafter(reference, std::numeric_limits<S>::infinity()) -
+            reference;
+        return std::fabs(value - reference) / ulp;
+    };
+
+    std::mt19937_64                        engine(3);
+    std::uniform_real_distribution<double> doubles(-700.0, 700.0);
+    std::uniform_real_distribution<double> floats(-85.0, 85.0);
+
+    for (size_t it = 0; it < 1000; ++it)
+    {
+        VD d{};
+        for (size_t i = 0; i < mstd::simd_size_v<VD>; ++i)
+            d[i] = doubles(engine);
+
+        VF f{};
+        for (size_t i = 0; i < mstd::simd_size_v<VF>; ++i)
+            f[i] = static_cast<float>(floats(engine));
+
+        const auto ed = mstd::simdExp(d);
+        const auto ef = mstd::simdExp(f);
+
+        for (size_t i = 0; i < mstd::simd_size_v<VD>; ++i)
+            REQUIRE(ulps(ed[i], std::exp(d[i])) <= 1.0);
+
+        for (size_t i = 0; i < mstd::simd_size_v<VF>; ++i)
+        {
+            const auto reference =
+                static_cast<float>(std::exp(static_cast<double>(f[i])));
+            REQUIRE(ulps(ef[i], reference) <= 1.0F);
+        }
+    }
+
+    constexpr auto infinity = std::numeric_limits<double>::infinity();
+
+    REQUIRE(mstd::simdExp(0.0) == 1.0);
+    REQUIRE(mstd::simdExp(1000.0) == infinity);
+    REQUIRE(mstd::simdExp(-1000.0) == 0.0);
+    REQUIRE(mstd::simdExp(-744.0) == std::exp(-744.0));
+    REQUIRE(std::isnan(mstd::simdExp(std::nan(""))));
+}
+
+TEST_CASE("simdErfc approximates std::erfc", "[simd]")
+{
+    using VD = mstd::SimdVec<double>;
+    using VF = mstd::SimdVec<float>;
+
+    for (size_t it = 0; it < 200; ++it)
+    {
+        VD d{};
+        for (size_t i = 0; i < mstd::simd_size_v<VD>; ++i)
+            d[i] = -2.0 + 0.01 * static_cast<double>(it * 7 + i);
+
+        VF f{};
+        for (size_t i = 0; i < mstd::simd_size_v<VF>; ++i)
+            f[i] = -2.0F + 0.005F * static_cast<float>(it * 15 + i);
+
+        const auto [erfc, gauss] = mstd::simdErfcAndExp(d);
+        const auto erfcFloat     = mstd::simdErfc(f);
+
+        for (size_t i = 0; i < mstd::simd_size_v<VD>; ++i)
+        {
+            REQUIRE(std::fabs(erfc[i] - std::erfc(d[i])) < 3e-15);
+            REQUIRE(gauss[i] == mstd::simdExp(-d[i] * d[i]));
+        }
+
+        for (size_t i = 0; i < mstd::simd_size_v<VF>; ++i)
+            REQUIRE(std::fabs(erfcFloat[i] - std::erfc(f[i])) < 5e-7F);
+    }
+
+    REQUIRE(mstd::simdErfc(30.0) == 0.0);
+    REQUIRE(mstd::simdErfc(-30.0) == 2.0);
+}